@@ -11,15 +11,39 @@ namespace PHiLiP {
 using FadType = Sacado::Fad::DFad<double>; ///< Sacado AD type for first derivatives.
 using FadFadType = Sacado::Fad::DFad<FadType>; ///< Sacado AD type that allows 2nd derivatives.
 
-static constexpr int dimForwardAD = 1; ///< Size of the forward vector mode for CoDiPack.
-static constexpr int dimReverseAD = 1; ///< Size of the reverse vector mode for CoDiPack.
+#ifndef PHILIP_AD_FORWARD_WIDTH
+#define PHILIP_AD_FORWARD_WIDTH 4 ///< Default number of tangent directions carried per forward sweep.
+#endif
+#ifndef PHILIP_AD_REVERSE_WIDTH
+#define PHILIP_AD_REVERSE_WIDTH 4 ///< Default number of adjoint directions carried per reverse sweep.
+#endif
+
+/// Size of the forward vector mode for CoDiPack.
+/** Each tangent sweep through a tape propagates this many directions at once,
+ *  such that the Hessian of a cell with n inputs requires ceil(n/dimForwardAD) sweeps.
+ *  Selected at configure time through -DPHILIP_AD_FORWARD_WIDTH.
+ */
+static constexpr int dimForwardAD = PHILIP_AD_FORWARD_WIDTH;
+/// Size of the reverse vector mode for CoDiPack.
+/** Each reverse sweep of the Jacobian tape propagates this many output adjoints at once,
+ *  such that the Jacobian of a cell with m residuals requires ceil(m/dimReverseAD) sweeps.
+ *  Selected at configure time through -DPHILIP_AD_REVERSE_WIDTH.
+ */
+static constexpr int dimReverseAD = PHILIP_AD_REVERSE_WIDTH;
+/// Size of the reverse vector mode of the Hessian type.
+/** The second derivatives are always taken of the scalar dual-weighted residual,
+ *  so a single adjoint direction suffices and wider widths would only inflate the tape adjoints.
+ */
+static constexpr int dimReverseHessianAD = 1;
+
+static_assert(dimForwardAD > 0 && dimReverseAD > 0, "CoDiPack vector widths must be positive.");
 
 using codi_FadType = codi::RealForwardGen<double, codi::Direction<double,dimForwardAD>>; ///< Tapeless forward mode.
 //using codi_FadType = codi::RealForwardGen<double, codi::DirectionVar<double>>;
 
 using codi_JacobianComputationType = codi::RealReverseIndexVec<dimReverseAD>; ///< Reverse mode type for Jacobian computation using TapeHelper.
 using codi_HessianComputationType  = codi::RealReversePrimalIndexGen< codi::RealForwardVec<dimForwardAD>,
-                                                  codi::Direction< codi::RealForwardVec<dimForwardAD>, dimReverseAD>
+                                                  codi::Direction< codi::RealForwardVec<dimForwardAD>, dimReverseHessianAD>
                                                 >; ///< Nested reverse-forward mode type for Jacobian and Hessian computation using TapeHelper.
 
 //using RadFadType = Sacado::Rad::ADvar<FadType>; ///< Sacado AD type that allows 2nd derivatives.
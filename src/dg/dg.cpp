@@ -1,5 +1,7 @@
+#include<array>
 #include<limits>
 #include<fstream>
+#include<future>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/tensor.h>
 
@@ -8,6 +10,7 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria.h>
+#include <deal.II/distributed/solution_transfer.h>
 
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_refinement.h>
@@ -110,6 +113,7 @@ DGBase<dim,real,MeshType>::DGBase(
     , freeze_artificial_dissipation(false)
     , max_artificial_dissipation_coeff(0.0)
 {
+    artificial_dissipation_sensor_is_assembled = false;
 
     dof_handler.initialize(*triangulation, fe_collection);
     dof_handler_artificial_dissipation.initialize(*triangulation, fe_q_artificial_dissipation);
@@ -458,6 +462,94 @@ bool DGBase<dim,real,MeshType>::current_cell_should_do_the_work (
     return false;
 }
 
+template <int dim, typename real, typename MeshType>
+bool DGBase<dim,real,MeshType>::cell_is_next_to_ghost_cell (
+    const typename dealii::DoFHandler<dim>::active_cell_iterator &cell) const
+{
+    for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+        const auto face = cell->face(iface);
+        if (face->at_boundary() && !cell->has_periodic_neighbor(iface)) continue;
+        if (face->has_children()) return true;
+
+        const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+        if (neighbor_cell->has_children()) return true;
+        if (!neighbor_cell->is_locally_owned()) return true;
+    }
+    return false;
+}
+
+template <int dim, typename real, typename MeshType>
+template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
+void DGBase<dim,real,MeshType>::assemble_face_term_from_neighbor_trace (
+    const DoFCellAccessorType1 &current_cell,
+    const DoFCellAccessorType2 &current_metric_cell,
+    const unsigned int iface,
+    const std::vector<dealii::types::global_dof_index> &current_metric_dofs_indices,
+    const std::vector<dealii::types::global_dof_index> &current_dofs_indices,
+    dealii::hp::FEFaceValues<dim,dim> &fe_values_collection_face_int,
+    dealii::hp::FEFaceValues<dim,dim> &fe_values_collection_face_ext,
+    dealii::Vector<real> &current_cell_rhs)
+{
+    const auto neighbor_cell = current_cell->neighbor_or_periodic_neighbor(iface);
+    const bool is_periodic = current_cell->face(iface)->at_boundary();
+    const unsigned int neighbor_iface = is_periodic ? current_cell->periodic_neighbor_of_periodic_neighbor(iface)
+                                                    : current_cell->neighbor_of_neighbor(iface);
+
+    const double *const neighbor_face_trace = face_trace_exchange.get_received_trace(current_cell->active_cell_index(), iface);
+    Assert(neighbor_face_trace != nullptr, dealii::ExcMessage("The face trace of the ghost neighbor has not been received."));
+
+    const int i_fele = current_cell->active_fe_index(), i_quad = i_fele, i_mapp = 0;
+    fe_values_collection_face_int.reinit (current_cell, iface, i_quad, i_mapp, i_fele);
+    const dealii::FEFaceValues<dim,dim> &fe_values_face_int = fe_values_collection_face_int.get_present_fe_values();
+
+    const int i_fele_n = neighbor_cell->active_fe_index(), i_quad_n = i_fele_n, i_mapp_n = 0;
+    fe_values_collection_face_ext.reinit (neighbor_cell, neighbor_iface, i_quad_n, i_mapp_n, i_fele_n);
+    const dealii::FEFaceValues<dim,dim> &fe_values_face_ext = fe_values_collection_face_ext.get_present_fe_values();
+
+    const real penalty1 = evaluate_penalty_scaling (current_cell, iface, fe_collection);
+    const real penalty2 = evaluate_penalty_scaling (neighbor_cell, neighbor_iface, fe_collection);
+    const real penalty = 0.5 * (penalty1 + penalty2);
+
+    const unsigned int n_metric_dofs_cell = high_order_grid->fe_system.dofs_per_cell;
+    std::vector<dealii::types::global_dof_index> neighbor_metric_dofs_indices(n_metric_dofs_cell);
+    const auto metric_neighbor_cell = current_metric_cell->neighbor_or_periodic_neighbor(iface);
+    metric_neighbor_cell->get_dof_indices(neighbor_metric_dofs_indices);
+
+    // Both processors integrate the face with the quadrature used to evaluate the face trace.
+    const dealii::Quadrature<dim-1> &used_face_quadrature = face_quadrature_collection[std::max(i_quad, i_quad_n)];
+    std::pair<unsigned int, int> face_subface_int = std::make_pair(iface, -1);
+    std::pair<unsigned int, int> face_subface_ext = std::make_pair(neighbor_iface, -1);
+    const auto face_data_set_int = dealii::QProjector<dim>::DataSetDescriptor::face (
+                                                                                  dealii::ReferenceCell::get_hypercube(dim),
+                                                                                  iface,
+                                                                                  current_cell->face_orientation(iface),
+                                                                                  current_cell->face_flip(iface),
+                                                                                  current_cell->face_rotation(iface),
+                                                                                  used_face_quadrature.size());
+    const auto face_data_set_ext = dealii::QProjector<dim>::DataSetDescriptor::face (
+                                                                                  dealii::ReferenceCell::get_hypercube(dim),
+                                                                                  neighbor_iface,
+                                                                                  neighbor_cell->face_orientation(neighbor_iface),
+                                                                                  neighbor_cell->face_flip(neighbor_iface),
+                                                                                  neighbor_cell->face_rotation(neighbor_iface),
+                                                                                  used_face_quadrature.size());
+    assemble_face_term_from_trace (
+        current_cell,
+        current_cell->active_cell_index(),
+        neighbor_cell->active_cell_index(),
+        face_subface_int, face_subface_ext,
+        face_data_set_int,
+        face_data_set_ext,
+        fe_values_face_int, fe_values_face_ext,
+        penalty,
+        fe_collection[i_fele], fe_collection[i_fele_n],
+        used_face_quadrature,
+        current_metric_dofs_indices, neighbor_metric_dofs_indices,
+        current_dofs_indices,
+        neighbor_face_trace,
+        current_cell_rhs);
+}
+
 template <int dim, typename real, typename MeshType>
 template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
 void DGBase<dim,real,MeshType>::assemble_cell_residual (
@@ -491,6 +583,8 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
 
     fe_values_collection_volume.reinit (current_cell, i_quad, i_mapp, i_fele);
     const dealii::FEValues<dim,dim> &fe_values_volume = fe_values_collection_volume.get_present_fe_values();
+    // Kept for the residual norms reduced at the end of assemble_residual().
+    cell_JxW[current_cell->active_cell_index()] = fe_values_volume.get_JxW_values();
 
     dealii::TriaIterator<dealii::CellAccessor<dim,dim>> cell_iterator = static_cast<dealii::TriaIterator<dealii::CellAccessor<dim,dim>> > (current_cell);
     //if (!(all_parameters->use_weak_form)) fe_values_collection_volume_lagrange.reinit (current_cell, i_quad, i_mapp, i_fele);
@@ -588,7 +682,15 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             //std::cout << "periodic neighbour on face " << iface << " is " << neighbor_cell->index() << std::endl;
 
 
-            if (!current_cell->periodic_neighbor_is_coarser(iface) && current_cell_should_do_the_work(current_cell, neighbor_cell)) {
+            if (assemble_with_face_traces && !neighbor_cell->has_children() && neighbor_cell->is_ghost()) {
+
+                assemble_face_term_from_neighbor_trace (
+                    current_cell, current_metric_cell, iface,
+                    current_metric_dofs_indices, current_dofs_indices,
+                    fe_values_collection_face_int, fe_values_collection_face_ext,
+                    current_cell_rhs);
+
+            } else if (!current_cell->periodic_neighbor_is_coarser(iface) && current_cell_should_do_the_work(current_cell, neighbor_cell)) {
 
                 Assert (current_cell->periodic_neighbor(iface).state() == dealii::IteratorState::valid, dealii::ExcInternalError());
 
@@ -771,7 +873,20 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
             for (unsigned int i=0; i<n_dofs_neigh_cell; ++i) {
                 rhs[neighbor_dofs_indices[i]] += neighbor_cell_rhs[i];
             }
-        // CASE 5: NEIGHBOR CELL HAS SAME COARSENESS
+        // CASE 5: NEIGHBOR CELL HAS SAME COARSENESS AND BELONGS TO ANOTHER PROCESSOR
+        // Only assemble the current cell's side of the face from the received face trace.
+        // The other processor assembles its own side.
+        } else if ( assemble_with_face_traces
+                    && !current_cell->neighbor(iface)->has_children()
+                    && current_cell->neighbor(iface)->is_ghost() ) {
+
+            assemble_face_term_from_neighbor_trace (
+                current_cell, current_metric_cell, iface,
+                current_metric_dofs_indices, current_dofs_indices,
+                fe_values_collection_face_int, fe_values_collection_face_ext,
+                current_cell_rhs);
+
+        // CASE 6: NEIGHBOR CELL HAS SAME COARSENESS
         // Therefore, we need to choose one of them to do the work
         } else if ( current_cell_should_do_the_work(current_cell, current_cell->neighbor(iface)) ) {
             Assert (current_cell->neighbor(iface).state() == dealii::IteratorState::valid, dealii::ExcInternalError());
@@ -867,6 +982,60 @@ void DGBase<dim,real,MeshType>::assemble_cell_residual (
     }
 }
 
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::evaluate_face_trace(
+    typename dealii::DoFHandler<dim>::active_cell_iterator /*cell*/,
+    const unsigned int /*face_number*/,
+    const dealii::Quadrature<dim-1> &/*face_quadrature*/,
+    const std::vector<dealii::types::global_dof_index> &/*metric_dof_indices*/,
+    const std::vector<dealii::types::global_dof_index> &/*soln_dof_indices*/,
+    double *const /*face_trace*/)
+{
+    Assert(false, dealii::ExcNotImplemented());
+}
+
+template <int dim, typename real, typename MeshType>
+bool DGBase<dim,real,MeshType>::face_trace_includes_gradients () const
+{
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+    const PDE_enum pde_type = all_parameters->pde_type;
+    const bool inviscid = (pde_type == PDE_enum::euler
+                           || pde_type == PDE_enum::advection
+                           || pde_type == PDE_enum::advection_vector
+                           || pde_type == PDE_enum::burgers_inviscid);
+    return !inviscid;
+}
+
+template <int dim, typename real, typename MeshType>
+unsigned int DGBase<dim,real,MeshType>::n_face_trace_values_per_point () const
+{
+    return face_trace_includes_gradients() ? nstate*(1+dim) : nstate;
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::assemble_face_term_from_trace(
+    typename dealii::DoFHandler<dim>::active_cell_iterator /*cell*/,
+    const dealii::types::global_dof_index /*current_cell_index*/,
+    const dealii::types::global_dof_index /*neighbor_cell_index*/,
+    const std::pair<unsigned int, int> /*face_subface_int*/,
+    const std::pair<unsigned int, int> /*face_subface_ext*/,
+    const typename dealii::QProjector<dim>::DataSetDescriptor /*face_data_set_int*/,
+    const typename dealii::QProjector<dim>::DataSetDescriptor /*face_data_set_ext*/,
+    const dealii::FEFaceValuesBase<dim,dim>     &/*fe_values_int*/,
+    const dealii::FEFaceValuesBase<dim,dim>     &/*fe_values_ext*/,
+    const real /*penalty*/,
+    const dealii::FESystem<dim,dim> &/*fe_int*/,
+    const dealii::FESystem<dim,dim> &/*fe_ext*/,
+    const dealii::Quadrature<dim-1> &/*face_quadrature*/,
+    const std::vector<dealii::types::global_dof_index> &/*metric_dof_indices_int*/,
+    const std::vector<dealii::types::global_dof_index> &/*metric_dof_indices_ext*/,
+    const std::vector<dealii::types::global_dof_index> &/*soln_dof_indices_int*/,
+    const double *const /*neighbor_face_trace*/,
+    dealii::Vector<real>          &/*local_rhs_int_cell*/)
+{
+    Assert(false, dealii::ExcNotImplemented());
+}
+
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::set_dual(const dealii::LinearAlgebra::distributed::Vector<real> &dual_input)
 {
@@ -876,6 +1045,32 @@ void DGBase<dim,real,MeshType>::set_dual(const dealii::LinearAlgebra::distribute
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::update_artificial_dissipation_discontinuity_sensor()
 {
+    // The coefficients are only frozen if they have been evaluated since the last allocation.
+    if (freeze_artificial_dissipation && artificial_dissipation_sensor_is_assembled) return;
+    // The coefficients are only used when the artificial dissipation is added.
+    if (!all_parameters->artificial_dissipation_param.add_artificial_dissipation) return;
+
+    // Avoid the additional pass over the mesh if the sensor has been evaluated
+    // on the same grid, and a solution within the update tolerance.
+    if (artificial_dissipation_sensor_is_assembled) {
+        auto diff_node = high_order_grid->volume_nodes;
+        diff_node -= volume_nodes_artificial_dissipation;
+        const double l2_norm_node = diff_node.l2_norm();
+
+        if (l2_norm_node == 0.0) {
+            auto diff_sol = solution;
+            diff_sol -= solution_artificial_dissipation;
+            const double l2_norm_sol = diff_sol.l2_norm();
+
+            const double tolerance = all_parameters->artificial_dissipation_param.sensor_update_tolerance;
+            if (l2_norm_sol <= tolerance) return;
+        }
+    }
+    solution_artificial_dissipation = solution;
+    volume_nodes_artificial_dissipation = high_order_grid->volume_nodes;
+    artificial_dissipation_sensor_is_assembled = true;
+    max_artificial_dissipation_coeff = 0.0;
+
     const auto mapping = (*(high_order_grid->mapping_fe_field));
     dealii::hp::MappingCollection<dim> mapping_collection(mapping);
     const dealii::UpdateFlags update_flags = dealii::update_values | dealii::update_JxW_values;
@@ -887,7 +1082,10 @@ void DGBase<dim,real,MeshType>::update_artificial_dissipation_discontinuity_sens
     const unsigned int n_dofs_arti_diss = fe_q_artificial_dissipation.dofs_per_cell;
     std::vector<dealii::types::global_dof_index> dof_indices_artificial_dissipation(n_dofs_arti_diss);
 
-    if (freeze_artificial_dissipation) return;
+    // Lower degree bases and projection quadratures, constructed once per active FE index.
+    std::vector< std::unique_ptr<dealii::FESystem<dim,dim>> > fe_lower_collection(fe_collection.size());
+    std::vector< std::unique_ptr<dealii::QGauss<dim>> > projection_quadrature_collection(fe_collection.size());
+
     artificial_dissipation_c0 *= 0.0;
     for (auto cell : dof_handler.active_cell_iterators()) {
         if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
@@ -922,13 +1120,17 @@ void DGBase<dim,real,MeshType>::update_artificial_dissipation_discontinuity_sens
             soln_coeff_high[idof] = solution[dof_indices[idof]];
         }
 
-        // Lower degree basis.
-        const unsigned int lower_degree = degree-1;
-        const dealii::FE_DGQLegendre<dim> fe_dgq_lower(lower_degree);
-        const dealii::FESystem<dim,dim> fe_lower(fe_dgq_lower, nstate);
+        if (!fe_lower_collection[i_fele]) {
+            // Lower degree basis.
+            const unsigned int lower_degree = degree-1;
+            const dealii::FE_DGQLegendre<dim> fe_dgq_lower(lower_degree);
+            fe_lower_collection[i_fele] = std::make_unique<dealii::FESystem<dim,dim>>(fe_dgq_lower, nstate);
 
-        // Projection quadrature.
-        const dealii::QGauss<dim> projection_quadrature(degree+5);
+            // Projection quadrature.
+            projection_quadrature_collection[i_fele] = std::make_unique<dealii::QGauss<dim>>(degree+5);
+        }
+        const dealii::FESystem<dim,dim> &fe_lower = *(fe_lower_collection[i_fele]);
+        const dealii::QGauss<dim> &projection_quadrature = *(projection_quadrature_collection[i_fele]);
         std::vector< double > soln_coeff_lower = project_function<dim,double>( soln_coeff_high, fe_high, fe_lower, projection_quadrature);
 
         // Quadrature used for solution difference.
@@ -1067,7 +1269,6 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         &&  !(compute_dRdX && compute_d2R)
             , dealii::ExcMessage("Can only do one at a time compute_dRdW or compute_dRdX or compute_d2R"));
 
-    max_artificial_dissipation_coeff = 0.0;
     //pcout << "Assembling DG residual...";
     if (compute_dRdW) {
         pcout << " with dRdW...";
@@ -1128,7 +1329,9 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         }
         dRdXv = 0;
     }
-    if (compute_d2R) {
+    if (compute_d2R && d2R_product_w) {
+        pcout << " with matrix-free d2R products...";
+    } else if (compute_d2R) {
         pcout << " with d2RdWdW, d2RdWdX, d2RdXdX...";
         auto diff_sol = solution;
         diff_sol -= solution_d2R;
@@ -1167,6 +1370,7 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         d2RdXdX = 0;
     }
     right_hand_side = 0;
+    residual_norms_up_to_date = false;
 
     //pcout << std::endl;
 
@@ -1185,28 +1389,32 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
 
     dealii::hp::FEValues<dim,dim>        fe_values_collection_volume_lagrange (mapping_collection, fe_collection_lagrange, volume_quadrature_collection, this->volume_update_flags);
 
-    solution.update_ghost_values();
-
-    int assembly_error = 0;
-    try {
-
-        update_artificial_dissipation_discontinuity_sensor();
+    // The halo exchanges are overlapped with the cells that are not next to a ghost cell.
+    // Those are split in two halves: the first is assembled while the ghost values of the solution
+    // are received, and the second while the ghost contributions of the right-hand side are sent.
+    std::vector<bool> is_next_to_ghost_cell(triangulation->n_active_cells(), false);
+    unsigned int n_interior_cells = 0;
+    for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell) {
+        if (!soln_cell->is_locally_owned()) continue;
+        is_next_to_ghost_cell[soln_cell->active_cell_index()] = cell_is_next_to_ghost_cell(soln_cell);
+        if (!is_next_to_ghost_cell[soln_cell->active_cell_index()]) ++n_interior_cells;
+    }
+    const unsigned int n_first_interior_cells = n_interior_cells / 2;
 
+    enum class CellSubset { first_interior_cells, next_to_ghost_cells, last_interior_cells };
+    const auto assemble_cell_subset = [&] (const CellSubset cell_subset) {
+        unsigned int i_interior_cell = 0;
         auto metric_cell = high_order_grid->dof_handler_grid.begin_active();
         for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) {
-        //for (auto cell = triangulation->begin_active(); cell != triangulation->end(); ++cell) {
             if (!soln_cell->is_locally_owned()) continue;
 
-            //const int tria_level = cell->level();
-            //const int tria_index = cell->index();
-            //dealii::DoFCellAccessor<dim,dim,false> soln_cell(triangulation.get(), tria_level, tria_index, &dof_handler);
-            //dealii::DoFCellAccessor<dim,dim,false> metric_cell(triangulation.get(), tria_level, tria_index, &high_order_grid->dof_handler_grid);
-
-            //dealii::TriaActiveIterator< dealii::DoFCellAccessor<dim,dim,false> >
-
-            //DoFCellAccessor<dim,dim,false> soln_cell(triangulation.get(), tria_level, tria_index, &dof_handler);
-            //dealii::DoFCellAccessor<dim,dim,false> metric_cell(triangulation.get(), tria_level, tria_index, &high_order_grid->dof_handler_grid);
-
+            if (is_next_to_ghost_cell[soln_cell->active_cell_index()]) {
+                if (cell_subset != CellSubset::next_to_ghost_cells) continue;
+            } else {
+                const bool is_first_interior_cell = (i_interior_cell++ < n_first_interior_cells);
+                if (cell_subset == CellSubset::next_to_ghost_cells) continue;
+                if (is_first_interior_cell != (cell_subset == CellSubset::first_interior_cells)) continue;
+            }
 
             // Add right-hand side contributions this cell can compute
             assemble_cell_residual (
@@ -1220,16 +1428,100 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
                 fe_values_collection_volume_lagrange,
                 right_hand_side);
         } // end of cell loop
-    } catch(...) {
-        assembly_error = 1;
+    };
+
+    // The face traces replace the ghost cells' solution when only the residual is assembled.
+    // The discontinuity sensor still needs the ghost cells' solution.
+    assemble_with_face_traces = face_trace_exchange.is_enabled()
+                                && !compute_dRdW && !compute_dRdX && !compute_d2R
+                                && !all_parameters->artificial_dissipation_param.add_artificial_dissipation;
+
+    // Every processor goes through all the communication steps, even if its assembly failed,
+    // such that the neighbouring processors are not left waiting.
+    int assembly_error = 0;
+    if (assemble_with_face_traces) {
+        // The faces shared with other processors are assembled by both processors. Therefore, neither the
+        // ghost values of the solution nor the ghost contributions of the right-hand side are exchanged.
+        bool trace_exchange_started = false;
+        try {
+            for (const auto &sent_face : face_trace_exchange.get_sent_faces()) {
+                const auto &soln_cell = sent_face.cell;
+                const typename dealii::DoFHandler<dim>::active_cell_iterator metric_cell(
+                    triangulation.get(), soln_cell->level(), soln_cell->index(), &(high_order_grid->dof_handler_grid));
+
+                std::vector<dealii::types::global_dof_index> soln_dofs_indices(fe_collection[soln_cell->active_fe_index()].n_dofs_per_cell());
+                std::vector<dealii::types::global_dof_index> metric_dofs_indices(high_order_grid->fe_system.dofs_per_cell);
+                soln_cell->get_dof_indices (soln_dofs_indices);
+                metric_cell->get_dof_indices (metric_dofs_indices);
+
+                evaluate_face_trace (
+                    soln_cell,
+                    sent_face.face_number,
+                    face_quadrature_collection[sent_face.quadrature_index],
+                    metric_dofs_indices,
+                    soln_dofs_indices,
+                    face_trace_exchange.get_sent_trace(sent_face));
+            }
+            face_trace_exchange.start_exchange();
+            trace_exchange_started = true;
+
+            assemble_cell_subset (CellSubset::first_interior_cells);
+            assemble_cell_subset (CellSubset::last_interior_cells);
+
+            face_trace_exchange.finish_exchange();
+
+            assemble_cell_subset (CellSubset::next_to_ghost_cells);
+        } catch(...) {
+            assembly_error = 1;
+        }
+        if (!trace_exchange_started) face_trace_exchange.start_exchange();
+        face_trace_exchange.finish_exchange();
+    } else {
+        bool ghost_update_finished = false;
+        bool rhs_compress_started = false;
+
+        solution.update_ghost_values_start();
+
+        try {
+            // The discontinuity sensor is evaluated on the ghost cells and is needed by every cell.
+            if (all_parameters->artificial_dissipation_param.add_artificial_dissipation) {
+                solution.update_ghost_values_finish();
+                ghost_update_finished = true;
+                update_artificial_dissipation_discontinuity_sensor();
+            }
+
+            assemble_cell_subset (CellSubset::first_interior_cells);
+
+            if (!ghost_update_finished) {
+                solution.update_ghost_values_finish();
+                ghost_update_finished = true;
+            }
+
+            assemble_cell_subset (CellSubset::next_to_ghost_cells);
+
+            right_hand_side.compress_start(0, dealii::VectorOperation::add);
+            rhs_compress_started = true;
+
+            assemble_cell_subset (CellSubset::last_interior_cells);
+        } catch(...) {
+            assembly_error = 1;
+        }
+        if (!ghost_update_finished) solution.update_ghost_values_finish();
+        if (!rhs_compress_started) right_hand_side.compress_start(0, dealii::VectorOperation::add);
+        right_hand_side.compress_finish(dealii::VectorOperation::add);
     }
-    const int mpi_assembly_error = dealii::Utilities::MPI::sum(assembly_error, mpi_communicator);
+    assemble_with_face_traces = false;
+
+    // The residual norms are reduced along with the assembly error,
+    // such that the ODE solvers do not loop over the grid again.
+    const int mpi_assembly_error = reduce_residual_norms (assembly_error);
 
     if (mpi_assembly_error != 0) {
         std::cout << "Invalid residual assembly encountered..."
                   << " Filling up RHS with 1s. " << std::endl;
         right_hand_side *= 0.0;
         right_hand_side.add(1.0);
+        residual_norms_up_to_date = false;
         if (compute_dRdW) {
             std::cout << " Filling up Jacobian with mass matrix. " << std::endl;
             const bool do_inverse_mass_matrix = false;
@@ -1246,7 +1538,6 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         //}
     }
 
-    right_hand_side.compress(dealii::VectorOperation::add);
     right_hand_side.update_ghost_values();
     if ( compute_dRdW ) {
         system_matrix.compress(dealii::VectorOperation::add);
@@ -1292,7 +1583,10 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
         //dRdW_preconditioner_builder.ConstructPreconditioner(condition_estimate);
     }
     if ( compute_dRdX ) dRdXv.compress(dealii::VectorOperation::add);
-    if ( compute_d2R ) {
+    if ( compute_d2R && d2R_product_w ) {
+        d2R_product_w->compress(dealii::VectorOperation::add);
+        d2R_product_x->compress(dealii::VectorOperation::add);
+    } else if ( compute_d2R ) {
         d2RdWdW.compress(dealii::VectorOperation::add);
         d2RdXdX.compress(dealii::VectorOperation::add);
         d2RdWdX.compress(dealii::VectorOperation::add);
@@ -1302,8 +1596,149 @@ void DGBase<dim,real,MeshType>::assemble_residual (const bool compute_dRdW, cons
 
 } // end of assemble_system_explicit ()
 
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::apply_d2R (
+    const dealii::LinearAlgebra::distributed::Vector<double> &direction_w,
+    const dealii::LinearAlgebra::distributed::Vector<double> &direction_x,
+    dealii::LinearAlgebra::distributed::Vector<double> &d2R_w,
+    dealii::LinearAlgebra::distributed::Vector<double> &d2R_x)
+{
+    // Ghosted copies since the cells read and write the DoFs of their neighbours.
+    dealii::LinearAlgebra::distributed::Vector<double> ghosted_direction_w(solution);
+    ghosted_direction_w.copy_locally_owned_data_from(direction_w);
+    ghosted_direction_w.update_ghost_values();
+    dealii::LinearAlgebra::distributed::Vector<double> ghosted_direction_x(high_order_grid->volume_nodes);
+    ghosted_direction_x.copy_locally_owned_data_from(direction_x);
+    ghosted_direction_x.update_ghost_values();
+
+    dealii::LinearAlgebra::distributed::Vector<double> ghosted_d2R_w(solution);
+    ghosted_d2R_w *= 0.0;
+    dealii::LinearAlgebra::distributed::Vector<double> ghosted_d2R_x(high_order_grid->volume_nodes);
+    ghosted_d2R_x *= 0.0;
+
+    dual.update_ghost_values();
+    high_order_grid->volume_nodes.update_ghost_values();
+
+    d2R_direction_w = &ghosted_direction_w;
+    d2R_direction_x = &ghosted_direction_x;
+    d2R_product_w = &ghosted_d2R_w;
+    d2R_product_x = &ghosted_d2R_x;
+
+    const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = true;
+    assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+
+    d2R_direction_w = nullptr;
+    d2R_direction_x = nullptr;
+    d2R_product_w = nullptr;
+    d2R_product_x = nullptr;
+
+    d2R_w.copy_locally_owned_data_from(ghosted_d2R_w);
+    d2R_w.update_ghost_values();
+    d2R_x.copy_locally_owned_data_from(ghosted_d2R_x);
+    d2R_x.update_ghost_values();
+}
+
+namespace {
+/// Number of residual reductions that are summed, the remaining ones being maximized.
+constexpr int n_summed_residual_reductions = 3;
+/// MPI operation combining the residual reductions of two processors.
+void combine_residual_reductions (void *input, void *input_output, int *length, MPI_Datatype *)
+{
+    const double *in = static_cast<const double *>(input);
+    double *inout = static_cast<double *>(input_output);
+    for (int i = 0; i < *length; ++i) {
+        if (i < n_summed_residual_reductions) inout[i] += in[i];
+        else inout[i] = std::max(inout[i], in[i]);
+    }
+}
+} // anonymous namespace
+
+template <int dim, typename real, typename MeshType>
+int DGBase<dim,real,MeshType>::reduce_residual_norms (const int assembly_error)
+{
+    // Shape values of the reference cell, which are the ones of get_residual_l2norm()'s FEValues
+    // since the shape functions of the solution do not depend on the mapping.
+    if (residual_shape_values.size() != fe_collection.size()) {
+        residual_shape_values.resize(fe_collection.size());
+        for (unsigned int i_fele = 0; i_fele < fe_collection.size(); ++i_fele) {
+            const dealii::FESystem<dim,dim> &fe_ref = fe_collection[i_fele];
+            const dealii::Quadrature<dim> &quadrature = volume_quadrature_collection[i_fele];
+            const unsigned int n_dofs = fe_ref.n_dofs_per_cell();
+            const unsigned int n_quad = quadrature.size();
+
+            residual_shape_values[i_fele].reinit(n_quad, n_dofs);
+            for (unsigned int iquad = 0; iquad < n_quad; ++iquad) {
+                for (unsigned int idof = 0; idof < n_dofs; ++idof) {
+                    const unsigned int istate = fe_ref.system_to_component_index(idof).first;
+                    residual_shape_values[i_fele](iquad, idof) = fe_ref.shape_value_component(idof, quadrature.point(iquad), istate);
+                }
+            }
+        }
+    }
+
+    double residual_l2_norm = 0.0;
+    double domain_volume = 0.0;
+    double residual_linf_norm = 0.0;
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    for (const auto cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        const unsigned int cell_index = cell->active_cell_index();
+        const dealii::FullMatrix<double> &shape_values = residual_shape_values[cell->active_fe_index()];
+        const std::vector<double> &JxW = cell_JxW[cell_index];
+        const unsigned int n_dofs = shape_values.n();
+        const unsigned int n_quad = shape_values.m();
+
+        dofs_indices.resize(n_dofs);
+        cell->get_dof_indices (dofs_indices);
+
+        for (unsigned int iquad = 0; iquad < n_quad; ++iquad) {
+            double residual_val = 0.0;
+            for (unsigned int idof = 0; idof < n_dofs; ++idof) {
+                residual_val += right_hand_side[dofs_indices[idof]] * shape_values(iquad, idof);
+            }
+            residual_l2_norm += residual_val*residual_val * JxW[iquad];
+            domain_volume += JxW[iquad];
+            residual_linf_norm = std::max(residual_linf_norm, std::abs(residual_val));
+        }
+    }
+
+    // Summed entries first.
+    std::array<double,4> reductions {{ static_cast<double>(assembly_error), residual_l2_norm, domain_volume, residual_linf_norm }};
+    MPI_Op combine_op;
+    MPI_Op_create(&combine_residual_reductions, 1, &combine_op);
+    MPI_Allreduce(MPI_IN_PLACE, reductions.data(), static_cast<int>(reductions.size()), MPI_DOUBLE, combine_op, mpi_communicator);
+    MPI_Op_free(&combine_op);
+
+    residual_l2norm = std::sqrt(reductions[1]) / reductions[2];
+    residual_linfnorm = reductions[3];
+    residual_norms_up_to_date = true;
+
+    return static_cast<int>(reductions[0]);
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::invalidate_residual_norms ()
+{
+    residual_norms_up_to_date = false;
+}
+
 template <int dim, typename real, typename MeshType>
 double DGBase<dim,real,MeshType>::get_residual_linfnorm () const
+{
+    if (residual_norms_up_to_date) return residual_linfnorm;
+    return evaluate_residual_linfnorm();
+}
+
+template <int dim, typename real, typename MeshType>
+double DGBase<dim,real,MeshType>::get_residual_l2norm () const
+{
+    if (residual_norms_up_to_date) return residual_l2norm;
+    return evaluate_residual_l2norm();
+}
+
+template <int dim, typename real, typename MeshType>
+double DGBase<dim,real,MeshType>::evaluate_residual_linfnorm () const
 {
     pcout << "Evaluating residual Linf-norm..." << std::endl;
     const auto mapping = (*(high_order_grid->mapping_fe_field));
@@ -1341,7 +1776,7 @@ double DGBase<dim,real,MeshType>::get_residual_linfnorm () const
                 const unsigned int istate = fe_values_vol.get_fe().system_to_component_index(idof).first;
                 residual_val += right_hand_side[dofs_indices[idof]] * fe_values_vol.shape_value_component(idof, iquad, istate);
             }
-            residual_linf_norm = std::max(std::abs(residual_val), residual_val);
+            residual_linf_norm = std::max(residual_linf_norm, std::abs(residual_val));
         }
 
     }
@@ -1351,7 +1786,7 @@ double DGBase<dim,real,MeshType>::get_residual_linfnorm () const
 
 
 template <int dim, typename real, typename MeshType>
-double DGBase<dim,real,MeshType>::get_residual_l2norm () const
+double DGBase<dim,real,MeshType>::evaluate_residual_l2norm () const
 {
     //return get_residual_linfnorm ();
     //return right_hand_side.l2_norm();
@@ -1360,6 +1795,7 @@ double DGBase<dim,real,MeshType>::get_residual_l2norm () const
     //global_mass_matrix.vmult(scaled_residual, right_hand_side);
     //return scaled_residual.l2_norm();
     //pcout << "Evaluating residual L2-norm..." << std::endl;
+
     const auto mapping = (*(high_order_grid->mapping_fe_field));
     dealii::hp::MappingCollection<dim> mapping_collection(mapping);
 
@@ -1696,6 +2132,51 @@ void DGBase<dim,real,MeshType>::output_face_results_vtk (const unsigned int cycl
 }
 #endif
 
+/// Patches, dataset names and flags of a DataOut that no longer depend on the DoFHandler or data vectors.
+/** Allows the compression and writing of the .vtu files to be done on a background thread
+ *  while the solver keeps modifying the solution.
+ */
+template <int dim>
+class DataOutPatchesSnapshot : public dealii::DataOutInterface<dim,dim>
+{
+public:
+    /// Type returned by DataOutInterface::get_nonscalar_data_ranges().
+    using NonscalarDataRanges = std::vector<std::tuple<unsigned int, unsigned int, std::string, dealii::DataComponentInterpretation::DataComponentInterpretation>>;
+
+    /// Constructor. Takes ownership of the patches.
+    DataOutPatchesSnapshot(
+        std::vector<dealii::DataOutBase::Patch<dim,dim>> &&patches_input,
+        const std::vector<std::string> &dataset_names_input,
+        const NonscalarDataRanges &nonscalar_data_ranges_input)
+        : patches(std::move(patches_input))
+        , dataset_names(dataset_names_input)
+        , nonscalar_data_ranges(nonscalar_data_ranges_input)
+    {}
+
+protected:
+    const std::vector<dealii::DataOutBase::Patch<dim,dim>> &get_patches () const override { return patches; }
+    std::vector<std::string> get_dataset_names () const override { return dataset_names; }
+    NonscalarDataRanges get_nonscalar_data_ranges () const override { return nonscalar_data_ranges; }
+
+private:
+    const std::vector<dealii::DataOutBase::Patch<dim,dim>> patches; ///< Copied patches.
+    const std::vector<std::string> dataset_names; ///< Names of the output variables.
+    const NonscalarDataRanges nonscalar_data_ranges; ///< Vector-valued variables.
+};
+
+/// DataOut able to hand over its built patches to a DataOutPatchesSnapshot.
+template <int dim>
+class SnapshotDataOut : public dealii::DataOut<dim, dealii::DoFHandler<dim>>
+{
+public:
+    /// Copies the patches built by build_patches() such that this DataOut and its vectors can be released.
+    std::shared_ptr<DataOutPatchesSnapshot<dim>> snapshot () const
+    {
+        std::vector<dealii::DataOutBase::Patch<dim,dim>> patches_copy = this->get_patches();
+        return std::make_shared<DataOutPatchesSnapshot<dim>>(std::move(patches_copy), this->get_dataset_names(), this->get_nonscalar_data_ranges());
+    }
+};
+
 template <int dim, typename real, typename MeshType>
 void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle)// const
 {
@@ -1703,7 +2184,7 @@ void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle)//
     output_face_results_vtk (cycle);
 #endif
 
-    dealii::DataOut<dim, dealii::DoFHandler<dim>> data_out;
+    SnapshotDataOut<dim> data_out;
 
     data_out.attach_dof_handler (dof_handler);
 
@@ -1783,20 +2264,50 @@ void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle)//
     data_out.build_patches(mapping, n_subdivisions, curved);
     //const bool write_higher_order_cells = (dim>1 && max_degree > 1) ? true : false;
     const bool write_higher_order_cells = (dim>1 && grid_degree > 1) ? true : false;
-    dealii::DataOutBase::VtkFlags vtkflags(0.0,cycle,true,dealii::DataOutBase::VtkFlags::ZlibCompressionLevel::best_compression,write_higher_order_cells);
-    data_out.set_flags(vtkflags);
+    if (all_parameters->ode_solver_param.output_format == Parameters::ODESolverParam::OutputFormatEnum::hdf5) {
+#ifdef DEAL_II_WITH_HDF5
+        // Collective write of a single file, therefore not done in the background.
+        // HDF5 does not support high-order cells, the subdivided patches are written instead.
+        const std::string basename = "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2);
+        const std::string h5_filename = basename + "-" + dealii::Utilities::int_to_string(cycle, 4) + ".h5";
+
+        const bool filter_duplicate_vertices = false;
+        const bool xdmf_hdf5_output = true;
+        dealii::DataOutBase::DataOutFilter data_filter(dealii::DataOutBase::DataOutFilterFlags(filter_duplicate_vertices, xdmf_hdf5_output));
+        data_out.write_filtered_data(data_filter);
+        data_out.write_hdf5_parallel(data_filter, h5_filename, mpi_communicator);
+
+        xdmf_entries.push_back(data_out.create_xdmf_entry(data_filter, h5_filename, cycle, mpi_communicator));
+        data_out.write_xdmf_file(xdmf_entries, basename + ".xdmf", mpi_communicator);
+#else
+        AssertThrow(false, dealii::ExcMessage("output_format = hdf5 requires deal.II to be configured with HDF5."));
+#endif
+        return;
+    }
+
+    using ZlibCompressionLevel = dealii::DataOutBase::VtkFlags::ZlibCompressionLevel;
+    ZlibCompressionLevel compression_level = ZlibCompressionLevel::best_compression;
+    using CompressionEnum = Parameters::ODESolverParam::OutputCompressionEnum;
+    const CompressionEnum compression = all_parameters->ode_solver_param.output_compression;
+    if (compression == CompressionEnum::no_compression)      compression_level = ZlibCompressionLevel::no_compression;
+    if (compression == CompressionEnum::best_speed)          compression_level = ZlibCompressionLevel::best_speed;
+    if (compression == CompressionEnum::default_compression) compression_level = ZlibCompressionLevel::default_compression;
+    dealii::DataOutBase::VtkFlags vtkflags(0.0,cycle,true,compression_level,write_higher_order_cells);
+
+    // Everything below only needs the patches, which are copied such that the solver can keep going
+    // while the compression and file writing is done in the background.
+    const std::shared_ptr<DataOutPatchesSnapshot<dim>> patches = data_out.snapshot();
+    patches->set_flags(vtkflags);
 
     const int iproc = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
     std::string filename = "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
     filename += dealii::Utilities::int_to_string(cycle, 4) + ".";
     filename += dealii::Utilities::int_to_string(iproc, 4);
     filename += ".vtu";
-    std::ofstream output(filename);
-    data_out.write_vtu(output);
-    //std::cout << "Writing out file: " << filename << std::endl;
 
+    std::vector<std::string> filenames;
+    std::string master_fn;
     if (iproc == 0) {
-        std::vector<std::string> filenames;
         for (unsigned int iproc = 0; iproc < dealii::Utilities::MPI::n_mpi_processes(mpi_communicator); ++iproc) {
             std::string fn = "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
             fn += dealii::Utilities::int_to_string(cycle, 4) + ".";
@@ -1804,12 +2315,88 @@ void DGBase<dim,real,MeshType>::output_results_vtk (const unsigned int cycle)//
             fn += ".vtu";
             filenames.push_back(fn);
         }
-        std::string master_fn = "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
+        master_fn = "solution-" + dealii::Utilities::int_to_string(dim, 1) +"D_maxpoly"+dealii::Utilities::int_to_string(max_degree, 2)+"-";
         master_fn += dealii::Utilities::int_to_string(cycle, 4) + ".pvtu";
-        std::ofstream master_output(master_fn);
-        data_out.write_pvtu_record(master_output, filenames);
     }
 
+    // No MPI calls are made from here on, such that the writing can safely be done by another thread.
+    auto write_files = [patches, filename, filenames, master_fn] () {
+        std::ofstream output(filename);
+        patches->write_vtu(output);
+        if (!master_fn.empty()) {
+            std::ofstream master_output(master_fn);
+            patches->write_pvtu_record(master_output, filenames);
+        }
+    };
+
+    // Only keep one output in flight to bound the memory used by the copied patches.
+    // get() also rethrows any exception raised while writing the previous files.
+    if (output_results_future.valid()) output_results_future.get();
+    if (all_parameters->ode_solver_param.output_asynchronous) {
+        output_results_future = std::async(std::launch::async, write_files);
+    } else {
+        write_files();
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::save_checkpoint (const std::string &filename)
+{
+    if constexpr (std::is_same_v<MeshType, dealii::parallel::distributed::Triangulation<dim>>) {
+        pcout << "Writing checkpoint " << filename << "..." << std::endl;
+
+        // Attach everything to the triangulation in the same order as load_checkpoint().
+        dof_handler.prepare_for_serialization_of_active_fe_indices();
+
+        solution.update_ghost_values();
+        dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>>
+            solution_transfer(dof_handler);
+        solution_transfer.prepare_for_serialization(solution);
+
+        high_order_grid->volume_nodes.update_ghost_values();
+        dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>>
+            grid_transfer(high_order_grid->dof_handler_grid);
+        grid_transfer.prepare_for_serialization(high_order_grid->volume_nodes);
+
+        triangulation->save(filename);
+    } else {
+        (void) filename;
+        AssertThrow(false, dealii::ExcMessage("Checkpointing is only available for parallel::distributed::Triangulation."));
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void DGBase<dim,real,MeshType>::load_checkpoint (const std::string &filename)
+{
+    if constexpr (std::is_same_v<MeshType, dealii::parallel::distributed::Triangulation<dim>>) {
+        pcout << "Reading checkpoint " << filename << "..." << std::endl;
+
+        // Triangulation::load() requires the current triangulation to be the unrefined coarse mesh.
+        triangulation->load(filename);
+
+        dof_handler.deserialize_active_fe_indices();
+        allocate_system ();
+
+        dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>>
+            solution_transfer(dof_handler);
+        solution.zero_out_ghosts();
+        solution_transfer.deserialize(solution);
+        solution.update_ghost_values();
+
+        high_order_grid->allocate();
+        dealii::parallel::distributed::SolutionTransfer<dim, dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<dim>>
+            grid_transfer(high_order_grid->dof_handler_grid);
+        high_order_grid->volume_nodes.zero_out_ghosts();
+        grid_transfer.deserialize(high_order_grid->volume_nodes);
+        high_order_grid->volume_nodes.update_ghost_values();
+
+        high_order_grid->ensure_conforming_mesh();
+        high_order_grid->update_surface_nodes();
+        high_order_grid->update_mapping_fe_field();
+    } else {
+        (void) filename;
+        AssertThrow(false, dealii::ExcMessage("Checkpointing is only available for parallel::distributed::Triangulation."));
+    }
 }
 
 template <int dim, typename real, typename MeshType>
@@ -1866,6 +2453,7 @@ void DGBase<dim,real,MeshType>::allocate_system ()
     artificial_dissipation_se.reinit(triangulation->n_active_cells());
     max_dt_cell.reinit(triangulation->n_active_cells());
     cell_volume.reinit(triangulation->n_active_cells());
+    cell_JxW.resize(triangulation->n_active_cells());
 
     solution.reinit(locally_owned_dofs, ghost_dofs, mpi_communicator);
     solution *= 0.0;
@@ -1873,8 +2461,22 @@ void DGBase<dim,real,MeshType>::allocate_system ()
     //right_hand_side.reinit(locally_owned_dofs, mpi_communicator);
     right_hand_side.reinit(locally_owned_dofs, ghost_dofs, mpi_communicator);
     right_hand_side.add(1.0); // Avoid 0 initial residual for output and logarithmic visualization.
+    residual_norms_up_to_date = false;
     dual.reinit(locally_owned_dofs, ghost_dofs, mpi_communicator);
 
+    if (all_parameters->use_face_trace_exchange) {
+        if (all_parameters->use_weak_form) {
+            face_trace_exchange.reinit(dof_handler, n_face_trace_values_per_point(), face_quadrature_collection, mpi_communicator);
+            if (!face_trace_exchange.is_enabled()) {
+                pcout << "Some faces shared by two processors are non-conforming. "
+                      << "The ghost cells' solution is exchanged instead of the face traces." << std::endl;
+            }
+        } else {
+            pcout << "The face trace exchange is only available with the weak form. "
+                  << "The ghost cells' solution is exchanged instead." << std::endl;
+        }
+    }
+
     // System matrix allocation
     dealii::DynamicSparsityPattern dsp(locally_relevant_dofs);
     dealii::DoFTools::make_flux_sparsity_pattern(dof_handler, dsp);
@@ -1947,6 +2549,10 @@ void DGBase<dim,real,MeshType>::allocate_system ()
     volume_nodes_d2R *= 0.0;
     dual_d2R.reinit(dual);
     dual_d2R *= 0.0;
+
+    solution_artificial_dissipation.reinit(solution);
+    volume_nodes_artificial_dissipation.reinit(high_order_grid->volume_nodes);
+    artificial_dissipation_sensor_is_assembled = false;
 }
 
 template <int dim, typename real, typename MeshType>
@@ -2712,4 +3318,10 @@ template RadType DGBase<PHILIP_DIM,double,dealii::parallel::shared::Triangulatio
 template FadFadType DGBase<PHILIP_DIM,double,dealii::parallel::shared::Triangulation<PHILIP_DIM>>::discontinuity_sensor(const dealii::Quadrature<PHILIP_DIM> &volume_quadrature, const std::vector< FadFadType > &soln_coeff_high, const dealii::FiniteElement<PHILIP_DIM,PHILIP_DIM> &fe_high, const std::vector<FadFadType>  &jac_det);
 template RadFadType DGBase<PHILIP_DIM,double,dealii::parallel::shared::Triangulation<PHILIP_DIM>>::discontinuity_sensor(const dealii::Quadrature<PHILIP_DIM> &volume_quadrature, const std::vector< RadFadType > &soln_coeff_high, const dealii::FiniteElement<PHILIP_DIM,PHILIP_DIM> &fe_high, const std::vector<RadFadType>  &jac_det);
 
+template double DGBase<PHILIP_DIM,double,dealii::Triangulation<PHILIP_DIM>>::evaluate_penalty_scaling(const dealii::DoFHandler<PHILIP_DIM>::active_cell_iterator &cell, const int iface, const dealii::hp::FECollection<PHILIP_DIM> fe_collection) const;
+template double DGBase<PHILIP_DIM,double,dealii::parallel::shared::Triangulation<PHILIP_DIM>>::evaluate_penalty_scaling(const dealii::DoFHandler<PHILIP_DIM>::active_cell_iterator &cell, const int iface, const dealii::hp::FECollection<PHILIP_DIM> fe_collection) const;
+#if PHILIP_DIM!=1
+template double DGBase<PHILIP_DIM,double,dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::evaluate_penalty_scaling(const dealii::DoFHandler<PHILIP_DIM>::active_cell_iterator &cell, const int iface, const dealii::hp::FECollection<PHILIP_DIM> fe_collection) const;
+#endif
+
 } // PHiLiP namespace
@@ -1,7 +1,10 @@
 #ifndef __DISCONTINUOUSGALERKIN_H__
 #define __DISCONTINUOUSGALERKIN_H__
 
+#include <future>
+
 #include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/data_out_base.h>
 #include <deal.II/base/parameter_handler.h>
 
 #include <deal.II/base/qprojector.h>
@@ -20,6 +23,7 @@
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/fe_values.h>
 
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
@@ -39,6 +43,7 @@
 #include "numerical_flux/viscous_numerical_flux.hpp"
 #include "parameters/all_parameters.h"
 #include "artificial_dissipation_factory.h"
+#include "face_trace_exchange.h"
 
 // Template specialization of MappingFEField
 //extern template class dealii::MappingFEField<PHILIP_DIM,PHILIP_DIM,dealii::LinearAlgebra::distributed::Vector<double>, dealii::DoFHandler<PHILIP_DIM> >;
@@ -156,6 +161,19 @@ public:
     /** Must be done after setting the mesh and before assembling the system. */
     virtual void allocate_system ();
 
+    /// Writes the triangulation, active FE indices, solution and high-order grid nodes to a checkpoint.
+    /** Uses the parallel::distributed::Triangulation serialization such that all processors write
+     *  into a single file through MPI-IO. Only available for distributed triangulations.
+     */
+    void save_checkpoint (const std::string &filename);
+
+    /// Restores the state written by save_checkpoint().
+    /** The current triangulation must be the same coarse mesh from which the checkpoint was
+     *  generated, and must not have been refined. The number of processors may differ.
+     *  The system is re-allocated and the high-order grid mapping is re-built.
+     */
+    void load_checkpoint (const std::string &filename);
+
 private:
     /// Allocates the second derivatives.
     /** Is called when assembling the residual's second derivatives, and is currently empty
@@ -204,8 +222,24 @@ public:
      */
     void add_time_scaled_mass_matrices();
 
-    double get_residual_l2norm () const; ///< Returns the L2-norm of the right_hand_side vector
-    double get_residual_linfnorm () const; ///< Returns the Linf-norm of the right_hand_side vector
+    /// Returns the L2-norm of the right_hand_side vector
+    /** Returns the norm reduced by the last assemble_residual() if the right_hand_side has not been
+     *  modified since, otherwise evaluates it with evaluate_residual_l2norm().
+     *  Modifications of the right_hand_side outside of the DG must call invalidate_residual_norms().
+     */
+    double get_residual_l2norm () const;
+    /// Returns the Linf-norm of the right_hand_side vector
+    /** Same as get_residual_l2norm(), with evaluate_residual_linfnorm() as the fallback. */
+    double get_residual_linfnorm () const;
+
+    double evaluate_residual_l2norm () const; ///< Evaluates the L2-norm of the right_hand_side vector by looping over the grid
+    double evaluate_residual_linfnorm () const; ///< Evaluates the Linf-norm of the right_hand_side vector by looping over the grid
+
+    /// Invalidates the residual norms reduced by assemble_residual().
+    /** Must be called whenever the right_hand_side is modified outside of assemble_residual(),
+     *  such that get_residual_l2norm() and get_residual_linfnorm() evaluate the norms of the modified vector.
+     */
+    void invalidate_residual_norms ();
 
     unsigned int n_dofs() const; ///< Number of degrees of freedom
 
@@ -331,6 +365,15 @@ private:
     /// Dual variables to compute d2R last
     /// Will be used to avoid recomputing d2R.
     dealii::LinearAlgebra::distributed::Vector<double> dual_d2R;
+
+    /// Modal coefficients of the solution used to evaluate the discontinuity sensor last
+    /// Will be used to avoid re-evaluating the sensor.
+    dealii::LinearAlgebra::distributed::Vector<double> solution_artificial_dissipation;
+    /// Modal coefficients of the grid nodes used to evaluate the discontinuity sensor last
+    /// Will be used to avoid re-evaluating the sensor.
+    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_artificial_dissipation;
+    /// Whether the discontinuity sensor has been evaluated since the last allocation.
+    bool artificial_dissipation_sensor_is_assembled;
 public:
 
     /// Time it takes for the maximum wavespeed to cross the cell domain.
@@ -416,10 +459,41 @@ public:
      */
     dealii::SparsityPattern get_d2RdWdXs_sparsity_pattern ();
 
-    /// Evaluate dRdX using finite-differences
-    /*  Where R represents the residual and X represents the grid degrees of freedom stored as high_order_grid.volume_nodes.
+    /// Evaluate dRdW using colored central finite-differences.
+    /** Where R represents the residual and W represents the solution degrees of freedom.
+     *  All the columns of a color are perturbed at once, see color_residual_stencil().
+     */
+    dealii::TrilinosWrappers::SparseMatrix get_dRdW_finite_differences (
+        const dealii::SparsityPattern &dRdW_sparsity_pattern,
+        const double perturbation);
+
+    /// Evaluate dRdX using colored central finite-differences.
+    /** Where R represents the residual and X represents the grid degrees of freedom stored as high_order_grid.volume_nodes.
+     *  All the columns of a color are perturbed at once, see color_residual_stencil().
+     */
+    dealii::TrilinosWrappers::SparseMatrix get_dRdX_finite_differences (
+        const dealii::SparsityPattern &dRdX_sparsity_pattern,
+        const double perturbation);
+
+    /// Greedy distance-2 coloring of the columns of a residual sparsity pattern.
+    /** Two columns receive different colors whenever they appear in the same row,
+     *  such that a single residual evaluation perturbing all the columns of a color
+     *  recovers each of their derivatives without overlap.
+     *  The locally owned rows are gathered on every process, which then computes the same coloring.
+     *  Returns the number of colors.
      */
-    dealii::TrilinosWrappers::SparseMatrix get_dRdX_finite_differences (dealii::SparsityPattern dRdX_sparsity_pattern);
+    unsigned int color_residual_stencil (
+        const dealii::SparsityPattern &sparsity_pattern,
+        std::vector<unsigned int> &column_colors) const;
+
+    /// Compare a finite-difference sensitivity against its automatic differentiation counterpart entry by entry.
+    /** Every entry of @p fd_matrix whose difference with @p ad_matrix exceeds @p tolerance is printed.
+     *  Returns the maximum absolute difference over all processes.
+     */
+    double report_sensitivity_errors (
+        const dealii::TrilinosWrappers::SparseMatrix &fd_matrix,
+        const dealii::TrilinosWrappers::SparseMatrix &ad_matrix,
+        const double tolerance) const;
 
     void initialize_manufactured_solution (); ///< Virtual function defined in DG
 
@@ -462,6 +536,19 @@ public:
     //void assemble_residual_dRdW ();
     void assemble_residual (const bool compute_dRdW=false, const bool compute_dRdX=false, const bool compute_d2R=false, const double CFL_mass = 0.0);
 
+    /// Matrix-free products with the second derivatives of the dual-weighted residual.
+    /** Evaluates
+     *  d2R_w = d2RdWdW * direction_w + d2RdWdX * direction_x and
+     *  d2R_x = d2RdWdX^T * direction_w + d2RdXdX * direction_x
+     *  using the current dual, by forward-over-reverse AD on each cell, without assembling
+     *  the second derivative matrices.
+     */
+    void apply_d2R (
+        const dealii::LinearAlgebra::distributed::Vector<double> &direction_w,
+        const dealii::LinearAlgebra::distributed::Vector<double> &direction_x,
+        dealii::LinearAlgebra::distributed::Vector<double> &d2R_w,
+        dealii::LinearAlgebra::distributed::Vector<double> &d2R_x);
+
     /// Used in assemble_residual().
     /** IMPORTANT: This does not fully compute the cell residual since it might not
      *  perform the work on all the faces.
@@ -583,6 +670,42 @@ protected:
         dealii::Vector<real>          &local_rhs_ext_cell,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R) = 0;
 
+    /// Evaluate the solution values and gradients at the face quadrature points sent to the neighbouring processor.
+    /** Each quadrature point holds the nstate values, followed by the nstate*dim gradient components
+     *  if face_trace_includes_gradients().
+     *  Only the weak DG supports the face trace exchange.
+     */
+    virtual void evaluate_face_trace(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const unsigned int face_number,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        double *const face_trace);
+    /// Evaluate the integral over a face shared with another processor from the neighbour's face trace.
+    /** Only the right-hand side of the current cell is assembled.
+     *  Only the weak DG supports the face trace exchange.
+     */
+    virtual void assemble_face_term_from_trace(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::types::global_dof_index neighbor_cell_index,
+        const std::pair<unsigned int, int> face_subface_int,
+        const std::pair<unsigned int, int> face_subface_ext,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_int,
+        const dealii::FESystem<dim,dim> &fe_ext,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+        const double *const neighbor_face_trace,
+        dealii::Vector<real>          &local_rhs_int_cell);
+
     /// Evaluate the integral over the cell volume
     virtual void assemble_volume_term_explicit(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
@@ -628,12 +751,55 @@ protected:
 protected:
     MPI_Comm mpi_communicator; ///< MPI communicator
     dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
-private:
+
+    /// Background compression and writing of the .vtu files launched by output_results_vtk().
+    /** At most one write is in flight. A std::future obtained from std::async blocks on destruction,
+     *  therefore all the files are on disk once the DGBase is destroyed.
+     */
+    std::future<void> output_results_future;
+
+    /// Entries of the .xdmf file describing every HDF5 solution output written so far.
+    std::vector<dealii::XDMFEntry> xdmf_entries;
+
+    /// Solution direction of the products computed by apply_d2R().
+    /** The d2R_* pointers are only set during apply_d2R(), in which case the derived classes
+     *  accumulate the Hessian-vector products instead of the second derivative matrices.
+     */
+    const dealii::LinearAlgebra::distributed::Vector<double> *d2R_direction_w = nullptr;
+    /// Volume nodes direction of the products computed by apply_d2R().
+    const dealii::LinearAlgebra::distributed::Vector<double> *d2R_direction_x = nullptr;
+    /// Solution component of the products computed by apply_d2R().
+    dealii::LinearAlgebra::distributed::Vector<double> *d2R_product_w = nullptr;
+    /// Volume nodes component of the products computed by apply_d2R().
+    dealii::LinearAlgebra::distributed::Vector<double> *d2R_product_x = nullptr;
+
+    /// Exchange of the face traces used instead of the ghost cells' solution.
+    /** Only set up if use_face_trace_exchange is requested with the weak form. */
+    FaceTraceExchange<dim> face_trace_exchange;
+    /// Whether the faces shared with other processors are assembled from the received face traces.
+    /** Only set during assemble_residual() when neither derivatives nor artificial dissipation are needed,
+     *  in which case both processors assemble their own side of the faces they share.
+     */
+    bool assemble_with_face_traces = false;
+    /// Whether the face traces hold the solution gradients in addition to its values.
+    /** The gradients are only needed by the dissipative terms, so only the values are sent for inviscid physics. */
+    bool face_trace_includes_gradients () const;
+    /// Number of values per face quadrature point in the face traces.
+    unsigned int n_face_trace_values_per_point () const;
+
+    /// JxW values of the volume quadrature of each locally owned cell, stored by assemble_cell_residual().
+    std::vector<std::vector<double>> cell_JxW;
+    /// Values of the shape functions at the volume quadrature points of each finite element in the collection.
+    /** Used to evaluate the residual at the quadrature points without reinitializing FEValues. */
+    std::vector<dealii::FullMatrix<double>> residual_shape_values;
 
     /** Evaluate the average penalty term at the face.
      *  For a cell with solution of degree p, and Hausdorff measure h,
      *  which represents the element dimension orthogonal to the face,
      *  the penalty term is given by p*(p+1)/h .
+     *
+     *  Explicitly instantiated for the active cell iterators of the DoFHandler,
+     *  such that the derived classes can evaluate the same penalty.
      */
     template<typename DoFCellAccessorType>
     real evaluate_penalty_scaling (
@@ -641,6 +807,32 @@ private:
         const int iface,
         const dealii::hp::FECollection<dim> fe_collection) const;
 
+    /// Colored central finite-differences of the residual with respect to @p perturbed_vector.
+    /** Used by get_dRdW_finite_differences() and get_dRdX_finite_differences().
+     *  The columns of a color are perturbed on every process holding them,
+     *  such that the ghost values stay consistent without communication.
+     */
+    dealii::TrilinosWrappers::SparseMatrix colored_residual_finite_differences (
+        dealii::LinearAlgebra::distributed::Vector<double> &perturbed_vector,
+        const dealii::IndexSet &locally_owned_columns,
+        const dealii::IndexSet &locally_relevant_columns,
+        const dealii::SparsityPattern &sparsity_pattern,
+        const double perturbation);
+private:
+    /// Residual L2-norm reduced at the end of assemble_residual().
+    double residual_l2norm;
+    /// Residual Linf-norm reduced at the end of assemble_residual().
+    double residual_linfnorm;
+    /// Whether the residual norms reduced by assemble_residual() correspond to the right_hand_side.
+    bool residual_norms_up_to_date = false;
+
+    /// Reduces the residual norms along with the assembly error of assemble_residual().
+    /** The partial sums of the locally owned cells are evaluated from the stored JxW and shape values,
+     *  and are combined with the assembly error through a single MPI_Allreduce.
+     *  Returns the number of processors whose assembly failed.
+     */
+    int reduce_residual_norms (const int assembly_error);
+
     /// In the case that two cells have the same coarseness, this function decides if the current cell should perform the work.
     /** In the case the neighbor is a ghost cell, we let the processor with the lower rank do the work on that face.
      *  We cannot use the cell->index() because the index is relative to the distributed triangulation.
@@ -652,6 +844,25 @@ private:
     template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
     bool current_cell_should_do_the_work (const DoFCellAccessorType1 &current_cell, const DoFCellAccessorType2 &neighbor_cell) const;
 
+    /// Assemble the current cell's side of a conforming face shared with another processor.
+    /** The neighbour's solution is only known through the face trace it sent. */
+    template<typename DoFCellAccessorType1, typename DoFCellAccessorType2>
+    void assemble_face_term_from_neighbor_trace (
+        const DoFCellAccessorType1 &current_cell,
+        const DoFCellAccessorType2 &current_metric_cell,
+        const unsigned int iface,
+        const std::vector<dealii::types::global_dof_index> &current_metric_dofs_indices,
+        const std::vector<dealii::types::global_dof_index> &current_dofs_indices,
+        dealii::hp::FEFaceValues<dim,dim> &fe_values_collection_face_int,
+        dealii::hp::FEFaceValues<dim,dim> &fe_values_collection_face_ext,
+        dealii::Vector<real> &current_cell_rhs);
+
+    /// Whether the residual of a locally owned cell depends on, or contributes to, a ghost cell.
+    /** Such cells need the ghost values of the solution and write to the ghost entries of the right-hand side.
+     *  A neighbor that has children is conservatively treated as a ghost cell.
+     */
+    bool cell_is_next_to_ghost_cell (const typename dealii::DoFHandler<dim>::active_cell_iterator &cell) const;
+
     /// Used in the delegated constructor
     /** The main reason we use this weird function is because all of the above objects
      *  need to be looped with the various p-orders. This function allows us to do this in a
@@ -661,10 +872,16 @@ private:
 
 public:
     /// Flag to freeze artificial dissipation.
+    /** The coefficients are held constant in the residual and its derivatives.
+     *  They are still evaluated once after the system is (re)allocated.
+     */
     bool freeze_artificial_dissipation;
     /// Stores maximum artificial dissipation while assembling the residual.
     double max_artificial_dissipation_coeff;
     /// Update discontinuity sensor.
+    /** Skipped if the sensor has already been evaluated on the same grid and on a solution
+     *  that differs by less than the sensor_update_tolerance in the L2 norm.
+     */
     void update_artificial_dissipation_discontinuity_sensor();
 
 }; // end of DGBase class
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <tuple>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/cell_id.h>
+
+#include "face_trace_exchange.h"
+
+namespace PHiLiP {
+
+template <int dim>
+void FaceTraceExchange<dim>::reinit (
+    const dealii::DoFHandler<dim> &dof_handler,
+    const unsigned int n_values_per_point,
+    const dealii::hp::QCollection<dim-1> &face_quadrature_collection,
+    const MPI_Comm mpi_communicator_input)
+{
+    finish_exchange();
+
+    mpi_communicator = mpi_communicator_input;
+    neighbor_ranks.clear();
+    sent_faces.clear();
+    send_buffers.clear();
+    receive_buffers.clear();
+    received_traces.clear();
+
+    // Faces shared with each neighbouring processor, identified by the cell sending the trace.
+    struct SharedFace {
+        dealii::CellId sender_cell_id;
+        unsigned int sender_face_number;
+        typename dealii::DoFHandler<dim>::active_cell_iterator owned_cell;
+        unsigned int owned_face_number;
+        unsigned int quadrature_index;
+
+        bool operator< (const SharedFace &other) const {
+            return std::tie(sender_cell_id, sender_face_number) < std::tie(other.sender_cell_id, other.sender_face_number);
+        }
+    };
+    std::map<unsigned int, std::vector<SharedFace>> sent_per_rank;
+    std::map<unsigned int, std::vector<SharedFace>> received_per_rank;
+
+    bool all_shared_faces_conforming = true;
+    for (auto cell = dof_handler.begin_active(); cell != dof_handler.end(); ++cell) {
+        if (!cell->is_locally_owned()) continue;
+
+        for (unsigned int iface=0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+            const auto face = cell->face(iface);
+            const bool is_periodic = face->at_boundary() && cell->has_periodic_neighbor(iface);
+            if (face->at_boundary() && !is_periodic) continue;
+
+            if (face->has_children()) {
+                for (unsigned int isubface = 0; isubface < face->n_children(); ++isubface) {
+                    const auto neighbor_child = is_periodic ? cell->periodic_neighbor_child_on_subface(iface, isubface)
+                                                            : cell->neighbor_child_on_subface(iface, isubface);
+                    if (!neighbor_child->is_locally_owned()) all_shared_faces_conforming = false;
+                }
+                continue;
+            }
+
+            const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+            // Finer neighbours are flagged by the processor owning them, through neighbor_is_coarser().
+            if (neighbor_cell->has_children()) continue;
+            if (neighbor_cell->is_locally_owned()) continue;
+
+            const bool neighbor_is_coarser = is_periodic ? cell->periodic_neighbor_is_coarser(iface)
+                                                         : cell->neighbor_is_coarser(iface);
+            if (neighbor_is_coarser) {
+                all_shared_faces_conforming = false;
+                continue;
+            }
+
+            const unsigned int neighbor_iface = is_periodic ? cell->periodic_neighbor_of_periodic_neighbor(iface)
+                                                            : cell->neighbor_of_neighbor(iface);
+            const unsigned int quadrature_index = std::max(cell->active_fe_index(), neighbor_cell->active_fe_index());
+            const unsigned int neighbor_rank = neighbor_cell->subdomain_id();
+
+            sent_per_rank[neighbor_rank].push_back({cell->id(), iface, cell, iface, quadrature_index});
+            received_per_rank[neighbor_rank].push_back({neighbor_cell->id(), neighbor_iface, cell, iface, quadrature_index});
+        }
+    }
+
+    enabled = (dealii::Utilities::MPI::min(all_shared_faces_conforming ? 1u : 0u, mpi_communicator) == 1u);
+    if (!enabled) return;
+
+    // The neighbouring relation is symmetric, therefore both maps have the same processors.
+    for (auto &rank_and_faces : sent_per_rank) {
+        const unsigned int neighbor_index = neighbor_ranks.size();
+        const unsigned int neighbor_rank = rank_and_faces.first;
+        neighbor_ranks.push_back(neighbor_rank);
+
+        std::vector<SharedFace> &faces_to_send = rank_and_faces.second;
+        std::sort(faces_to_send.begin(), faces_to_send.end());
+        unsigned int offset = 0;
+        for (const auto &shared_face : faces_to_send) {
+            sent_faces.push_back({shared_face.owned_cell, shared_face.owned_face_number, shared_face.quadrature_index, neighbor_index, offset});
+            offset += face_quadrature_collection[shared_face.quadrature_index].size() * n_values_per_point;
+        }
+        send_buffers.emplace_back(offset);
+
+        std::vector<SharedFace> &faces_to_receive = received_per_rank[neighbor_rank];
+        std::sort(faces_to_receive.begin(), faces_to_receive.end());
+        offset = 0;
+        for (const auto &shared_face : faces_to_receive) {
+            const auto owned_face = std::make_pair(shared_face.owned_cell->active_cell_index(), shared_face.owned_face_number);
+            received_traces[owned_face] = std::make_pair(neighbor_index, offset);
+            offset += face_quadrature_collection[shared_face.quadrature_index].size() * n_values_per_point;
+        }
+        receive_buffers.emplace_back(offset);
+    }
+}
+
+template <int dim>
+bool FaceTraceExchange<dim>::is_enabled () const
+{
+    return enabled;
+}
+
+template <int dim>
+const std::vector<typename FaceTraceExchange<dim>::SentFace> &FaceTraceExchange<dim>::get_sent_faces () const
+{
+    return sent_faces;
+}
+
+template <int dim>
+double *FaceTraceExchange<dim>::get_sent_trace (const SentFace &sent_face)
+{
+    return send_buffers[sent_face.neighbor_index].data() + sent_face.offset;
+}
+
+template <int dim>
+const double *FaceTraceExchange<dim>::get_received_trace (const unsigned int active_cell_index, const unsigned int face_number) const
+{
+    const auto received_trace = received_traces.find(std::make_pair(active_cell_index, face_number));
+    if (received_trace == received_traces.end()) return nullptr;
+
+    const unsigned int neighbor_index = received_trace->second.first;
+    const unsigned int offset = received_trace->second.second;
+    return receive_buffers[neighbor_index].data() + offset;
+}
+
+template <int dim>
+void FaceTraceExchange<dim>::start_exchange ()
+{
+    const int tag = 7308; // Arbitrary tag used by the face trace messages.
+    const unsigned int n_neighbors = neighbor_ranks.size();
+    requests.resize(2*n_neighbors);
+    for (unsigned int ineighbor = 0; ineighbor < n_neighbors; ++ineighbor) {
+        MPI_Irecv(receive_buffers[ineighbor].data(), static_cast<int>(receive_buffers[ineighbor].size()), MPI_DOUBLE,
+                  neighbor_ranks[ineighbor], tag, mpi_communicator, &requests[ineighbor]);
+    }
+    for (unsigned int ineighbor = 0; ineighbor < n_neighbors; ++ineighbor) {
+        MPI_Isend(send_buffers[ineighbor].data(), static_cast<int>(send_buffers[ineighbor].size()), MPI_DOUBLE,
+                  neighbor_ranks[ineighbor], tag, mpi_communicator, &requests[n_neighbors + ineighbor]);
+    }
+}
+
+template <int dim>
+void FaceTraceExchange<dim>::finish_exchange ()
+{
+    if (requests.empty()) return;
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    requests.clear();
+}
+
+template class FaceTraceExchange <PHILIP_DIM>;
+
+} // PHiLiP namespace
@@ -0,0 +1,104 @@
+#ifndef __FACE_TRACE_EXCHANGE_H__
+#define __FACE_TRACE_EXCHANGE_H__
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/hp/q_collection.h>
+
+namespace PHiLiP {
+
+/// Exchanges the solution traces on the faces shared by two processors.
+/** Instead of the solution coefficients of the ghost cells, each processor sends the values, and if needed
+ *  the gradients, of its solution at the face quadrature points of the faces it shares with another processor.
+ *  Every face shared by two processors is then assembled by both of them, each one only assembling
+ *  the right-hand side of its own cell.
+ *
+ *  The traces of a face are ordered by quadrature point, each one holding the n_values_per_point given to reinit().
+ *  Both processors order the faces by the CellId of the cell sending the trace and its face number,
+ *  such that no indices need to be communicated.
+ *
+ *  Only conforming faces are supported. If any face shared by two processors is non-conforming,
+ *  the exchange is disabled on every processor.
+ */
+template <int dim>
+class FaceTraceExchange
+{
+public:
+    /// Face of a locally owned cell whose trace is sent to a neighbouring processor.
+    struct SentFace {
+        /// Locally owned cell.
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell;
+        /// Face of the cell shared with the other processor.
+        unsigned int face_number;
+        /// Index of the face quadrature in the collection.
+        unsigned int quadrature_index;
+        /// Index of the neighbouring processor in neighbor_ranks.
+        unsigned int neighbor_index;
+        /// Position of the trace in the buffer sent to the neighbouring processor.
+        unsigned int offset;
+    };
+
+    /// Finds the faces shared with other processors and allocates the buffers.
+    /** Must be called once the degrees of freedom are distributed.
+     *  The face quadrature is the one of the highest active finite element index of the two cells,
+     *  such that both processors integrate the face with the same quadrature.
+     */
+    void reinit (
+        const dealii::DoFHandler<dim> &dof_handler,
+        const unsigned int n_values_per_point,
+        const dealii::hp::QCollection<dim-1> &face_quadrature_collection,
+        const MPI_Comm mpi_communicator_input);
+
+    /// Whether the face traces can be used instead of the ghost cells' solution.
+    bool is_enabled () const;
+
+    /// Faces whose traces must be evaluated before start_exchange().
+    const std::vector<SentFace> &get_sent_faces () const;
+
+    /// Location of the trace of a sent face.
+    double *get_sent_trace (const SentFace &sent_face);
+
+    /// Trace of the neighbouring cell on a face of a locally owned cell.
+    /** Returns a nullptr if the face is not shared with another processor. */
+    const double *get_received_trace (const unsigned int active_cell_index, const unsigned int face_number) const;
+
+    /// Posts the non-blocking sends and receives of the face traces.
+    void start_exchange ();
+
+    /// Waits for the face traces. Does nothing if no exchange was started.
+    void finish_exchange ();
+
+private:
+    /// Whether every face shared by two processors is conforming.
+    bool enabled = false;
+
+    /// MPI communicator.
+    MPI_Comm mpi_communicator;
+
+    /// Processors sharing at least one face with this processor.
+    std::vector<unsigned int> neighbor_ranks;
+
+    /// Faces whose traces are sent, ordered by neighbouring processor.
+    std::vector<SentFace> sent_faces;
+
+    /// Traces sent to each neighbouring processor.
+    std::vector<std::vector<double>> send_buffers;
+
+    /// Traces received from each neighbouring processor.
+    std::vector<std::vector<double>> receive_buffers;
+
+    /// Location of the received traces, given the active cell index and face number of the locally owned cell.
+    std::map<std::pair<unsigned int, unsigned int>, std::pair<unsigned int, unsigned int>> received_traces;
+
+    /// Pending sends and receives.
+    std::vector<MPI_Request> requests;
+};
+
+} // PHiLiP namespace
+
+#endif
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <cmath>
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+#include "dg.h"
+
+namespace PHiLiP {
+
+template <int dim, typename real, typename MeshType>
+unsigned int DGBase<dim,real,MeshType>::color_residual_stencil (
+    const dealii::SparsityPattern &sparsity_pattern,
+    std::vector<unsigned int> &column_colors) const
+{
+    using dealii::types::global_dof_index;
+
+    // Pack the locally owned rows as [row, n_entries, columns...].
+    std::vector<global_dof_index> local_rows;
+    for (const auto row : locally_owned_dofs) {
+        local_rows.push_back(row);
+        local_rows.push_back(sparsity_pattern.row_length(row));
+        for (auto entry = sparsity_pattern.begin(row); entry != sparsity_pattern.end(row); ++entry) {
+            local_rows.push_back(entry->column());
+        }
+    }
+    const std::vector<std::vector<global_dof_index>> all_rows = dealii::Utilities::MPI::all_gather(mpi_communicator, local_rows);
+
+    const global_dof_index n_cols = sparsity_pattern.n_cols();
+    std::vector<std::vector<global_dof_index>> row_columns(sparsity_pattern.n_rows());
+    std::vector<std::vector<global_dof_index>> column_rows(n_cols);
+    for (const auto &process_rows : all_rows) {
+        for (auto it = process_rows.begin(); it != process_rows.end(); ) {
+            const global_dof_index row = *(it++);
+            const global_dof_index n_entries = *(it++);
+            row_columns[row].assign(it, it + n_entries);
+            for (global_dof_index ientry = 0; ientry < n_entries; ++ientry) {
+                column_rows[*(it++)].push_back(row);
+            }
+        }
+    }
+
+    // Columns are visited in the same global order on every process,
+    // hence the greedy coloring is identical everywhere without further communication.
+    const unsigned int invalid_color = dealii::numbers::invalid_unsigned_int;
+    column_colors.assign(n_cols, invalid_color);
+    std::vector<global_dof_index> forbidden_by_column;
+    unsigned int n_colors = 0;
+    for (global_dof_index col = 0; col < n_cols; ++col) {
+        for (const auto row : column_rows[col]) {
+            for (const auto neighbor_col : row_columns[row]) {
+                const unsigned int neighbor_color = column_colors[neighbor_col];
+                if (neighbor_color != invalid_color) forbidden_by_column[neighbor_color] = col;
+            }
+        }
+        unsigned int color = 0;
+        while (color < n_colors && forbidden_by_column[color] == col) ++color;
+        if (color == n_colors) {
+            ++n_colors;
+            forbidden_by_column.push_back(dealii::numbers::invalid_dof_index);
+        }
+        column_colors[col] = color;
+    }
+    return n_colors;
+}
+
+template <int dim, typename real, typename MeshType>
+dealii::TrilinosWrappers::SparseMatrix DGBase<dim,real,MeshType>::colored_residual_finite_differences (
+    dealii::LinearAlgebra::distributed::Vector<double> &perturbed_vector,
+    const dealii::IndexSet &locally_owned_columns,
+    const dealii::IndexSet &locally_relevant_columns,
+    const dealii::SparsityPattern &sparsity_pattern,
+    const double perturbation)
+{
+    std::vector<unsigned int> column_colors;
+    const unsigned int n_colors = color_residual_stencil(sparsity_pattern, column_colors);
+    pcout << "Colored finite-differences with " << n_colors << " colors for "
+          << sparsity_pattern.n_cols() << " columns." << std::endl;
+
+    dealii::TrilinosWrappers::SparseMatrix fd_matrix;
+    fd_matrix.reinit(locally_owned_dofs, locally_owned_columns, sparsity_pattern, mpi_communicator);
+
+    perturbed_vector.update_ghost_values();
+    const dealii::LinearAlgebra::distributed::Vector<double> unperturbed_vector = perturbed_vector;
+
+    const auto perturb_color = [&](const unsigned int color, const double step) {
+        for (const auto col : locally_relevant_columns) {
+            if (column_colors[col] == color) perturbed_vector(col) = unperturbed_vector[col] + step;
+        }
+    };
+
+    for (unsigned int color = 0; color < n_colors; ++color) {
+        perturb_color(color, perturbation);
+        assemble_residual();
+        dealii::LinearAlgebra::distributed::Vector<double> perturbed_residual_p = right_hand_side;
+
+        perturb_color(color, -perturbation);
+        assemble_residual();
+        const dealii::LinearAlgebra::distributed::Vector<double> &perturbed_residual_m = right_hand_side;
+
+        perturb_color(color, 0.0);
+
+        perturbed_residual_p -= perturbed_residual_m;
+        perturbed_residual_p /= (2.0*perturbation);
+
+        // Within a row, at most one column has the current color.
+        for (const auto row : locally_owned_dofs) {
+            for (auto entry = sparsity_pattern.begin(row); entry != sparsity_pattern.end(row); ++entry) {
+                if (column_colors[entry->column()] == color) {
+                    fd_matrix.set(row, entry->column(), perturbed_residual_p[row]);
+                }
+            }
+        }
+    }
+    fd_matrix.compress(dealii::VectorOperation::insert);
+
+    // Leave the residual consistent with the unperturbed state.
+    assemble_residual();
+
+    return fd_matrix;
+}
+
+template <int dim, typename real, typename MeshType>
+dealii::TrilinosWrappers::SparseMatrix DGBase<dim,real,MeshType>::get_dRdW_finite_differences (
+    const dealii::SparsityPattern &dRdW_sparsity_pattern,
+    const double perturbation)
+{
+    return colored_residual_finite_differences(solution, locally_owned_dofs, locally_relevant_dofs, dRdW_sparsity_pattern, perturbation);
+}
+
+template <int dim, typename real, typename MeshType>
+dealii::TrilinosWrappers::SparseMatrix DGBase<dim,real,MeshType>::get_dRdX_finite_differences (
+    const dealii::SparsityPattern &dRdX_sparsity_pattern,
+    const double perturbation)
+{
+    return colored_residual_finite_differences(
+        high_order_grid->volume_nodes,
+        high_order_grid->locally_owned_dofs_grid,
+        high_order_grid->locally_relevant_dofs_grid,
+        dRdX_sparsity_pattern,
+        perturbation);
+}
+
+template <int dim, typename real, typename MeshType>
+double DGBase<dim,real,MeshType>::report_sensitivity_errors (
+    const dealii::TrilinosWrappers::SparseMatrix &fd_matrix,
+    const dealii::TrilinosWrappers::SparseMatrix &ad_matrix,
+    const double tolerance) const
+{
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+
+    double max_error = 0.0;
+    unsigned int n_failed_entries = 0;
+    for (const auto row : locally_owned_dofs) {
+        for (auto entry = fd_matrix.begin(row); entry != fd_matrix.end(row); ++entry) {
+            const double fd_value = entry->value();
+            const double ad_value = ad_matrix.el(row, entry->column());
+            const double error = std::abs(fd_value - ad_value);
+            max_error = std::max(max_error, error);
+            if (error > tolerance) {
+                ++n_failed_entries;
+                std::cout << "Process " << mpi_rank
+                          << " entry (" << row << ", " << entry->column() << ")"
+                          << " FD: " << fd_value
+                          << " AD: " << ad_value
+                          << " error: " << error << std::endl;
+            }
+        }
+    }
+    max_error = dealii::Utilities::MPI::max(max_error, mpi_communicator);
+    n_failed_entries = dealii::Utilities::MPI::sum(n_failed_entries, mpi_communicator);
+    pcout << "Maximum FD-AD entry error: " << max_error
+          << " with " << n_failed_entries << " entries above " << tolerance << std::endl;
+
+    return max_error;
+}
+
+template class DGBase <PHILIP_DIM, double, dealii::Triangulation<PHILIP_DIM>>;
+template class DGBase <PHILIP_DIM, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>;
+#if PHILIP_DIM!=1
+template class DGBase <PHILIP_DIM, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>;
+#endif
+
+} // namespace PHiLiP
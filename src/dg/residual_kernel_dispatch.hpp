@@ -0,0 +1,96 @@
+#ifndef __RESIDUAL_KERNEL_DISPATCH_H__
+#define __RESIDUAL_KERNEL_DISPATCH_H__
+
+#include <typeinfo>
+
+#include "physics/physics.h"
+#include "physics/euler.h"
+#include "physics/navier_stokes.h"
+#include "physics/convection_diffusion.h"
+#include "numerical_flux/convective_numerical_flux.hpp"
+#include "numerical_flux/viscous_numerical_flux.hpp"
+
+namespace PHiLiP {
+
+/// Returns @p object as Derived if its dynamic type is exactly Derived, and nullptr otherwise.
+/** Classes derived from Derived are not matched, since their functions may be overridden.
+ */
+template <typename Derived, typename Base>
+const Derived *exact_dynamic_cast (const Base &object)
+{
+    if (typeid(object) != typeid(Derived)) return nullptr;
+    return static_cast<const Derived *>(&object);
+}
+
+/// Calls @p kernel(physics) with the physics cast to its concrete type if it is one of the common ones.
+/** The kernel is a generic lambda, which is therefore instantiated for each concrete physics,
+ *  whose calls are then bound at compile time. Other physics go through the virtual functions.
+ */
+template <int dim, int nstate, typename real, typename Kernel>
+void dispatch_volume_kernel (
+    const Physics::PhysicsBase<dim,nstate,real> &physics,
+    const Kernel &kernel)
+{
+    if constexpr (nstate == 1) {
+        if (const auto *convection_diffusion = exact_dynamic_cast<Physics::ConvectionDiffusion<dim,nstate,real>>(physics)) {
+            return kernel(*convection_diffusion);
+        }
+    }
+    if constexpr (nstate == dim+2) {
+        if (const auto *euler = exact_dynamic_cast<Physics::Euler<dim,nstate,real>>(physics)) {
+            return kernel(*euler);
+        }
+        if (const auto *navier_stokes = exact_dynamic_cast<Physics::NavierStokes<dim,nstate,real>>(physics)) {
+            return kernel(*navier_stokes);
+        }
+    }
+    kernel(physics);
+}
+
+/// Calls @p kernel(physics, conv_num_flux, diss_num_flux) with concrete types for the common combinations.
+/** The statically dispatched combinations are
+ *  - ConvectionDiffusion with LaxFriedrichs and SymmetricInternalPenalty,
+ *  - Euler with RoePike or LaxFriedrichs, where the dissipative flux remains virtual since it vanishes,
+ *  - NavierStokes with RoePike or LaxFriedrichs and BassiRebay2.
+ *
+ *  All other combinations go through the virtual functions.
+ *  The explicit instantiations of the physics-templated numerical fluxes must cover the above.
+ */
+template <int dim, int nstate, typename real, typename Kernel>
+void dispatch_face_kernel (
+    const Physics::PhysicsBase<dim,nstate,real> &physics,
+    const NumericalFlux::NumericalFluxConvective<dim,nstate,real> &conv_num_flux,
+    const NumericalFlux::NumericalFluxDissipative<dim,nstate,real> &diss_num_flux,
+    const Kernel &kernel)
+{
+    using LaxFriedrichs = NumericalFlux::LaxFriedrichs<dim,nstate,real>;
+    if constexpr (nstate == 1) {
+        using SymmetricInternalPenalty = NumericalFlux::SymmetricInternalPenalty<dim,nstate,real>;
+        const auto *convection_diffusion = exact_dynamic_cast<Physics::ConvectionDiffusion<dim,nstate,real>>(physics);
+        const auto *lax_friedrichs = exact_dynamic_cast<LaxFriedrichs>(conv_num_flux);
+        const auto *sipg = exact_dynamic_cast<SymmetricInternalPenalty>(diss_num_flux);
+        if (convection_diffusion && lax_friedrichs && sipg) {
+            return kernel(*convection_diffusion, *lax_friedrichs, *sipg);
+        }
+    }
+    if constexpr (nstate == dim+2) {
+        using RoePike = NumericalFlux::RoePike<dim,nstate,real>;
+        const auto *roe_pike = exact_dynamic_cast<RoePike>(conv_num_flux);
+        const auto *lax_friedrichs = exact_dynamic_cast<LaxFriedrichs>(conv_num_flux);
+        if (const auto *euler = exact_dynamic_cast<Physics::Euler<dim,nstate,real>>(physics)) {
+            if (roe_pike) return kernel(*euler, *roe_pike, diss_num_flux);
+            if (lax_friedrichs) return kernel(*euler, *lax_friedrichs, diss_num_flux);
+        }
+        const auto *navier_stokes = exact_dynamic_cast<Physics::NavierStokes<dim,nstate,real>>(physics);
+        const auto *bassi_rebay_2 = exact_dynamic_cast<NumericalFlux::BassiRebay2<dim,nstate,real>>(diss_num_flux);
+        if (navier_stokes && bassi_rebay_2) {
+            if (roe_pike) return kernel(*navier_stokes, *roe_pike, *bassi_rebay_2);
+            if (lax_friedrichs) return kernel(*navier_stokes, *lax_friedrichs, *bassi_rebay_2);
+        }
+    }
+    kernel(physics, conv_num_flux, diss_num_flux);
+}
+
+} // PHiLiP namespace
+
+#endif
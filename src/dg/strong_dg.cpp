@@ -12,6 +12,7 @@
 #include <deal.II/fe/fe_dgq.h> // Used for flux interpolation
 
 #include "strong_dg.hpp"
+#include "two_point_flux_divergence.hpp"
 
 namespace PHiLiP {
 
@@ -23,7 +24,12 @@ DGStrong<dim,nstate,real,MeshType>::DGStrong(
     const unsigned int grid_degree_input,
     const std::shared_ptr<Triangulation> triangulation_input)
     : DGBaseState<dim,nstate,real,MeshType>::DGBaseState(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
-{ }
+{
+    // The Lagrange basis is collocated on the 1D quadrature nodes.
+    for (unsigned int i_fe=0; i_fe<this->oned_quadrature_collection.size(); ++i_fe) {
+        oned_lagrange_derivative.push_back(build_oned_lagrange_derivative(this->oned_quadrature_collection[i_fe]));
+    }
+}
 // Destructor
 template <int dim, int nstate, typename real, typename MeshType>
 DGStrong<dim,nstate,real,MeshType>::~DGStrong ()
@@ -508,7 +514,7 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
 
 template <int dim, int nstate, typename real, typename MeshType>
 void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_explicit(
-    typename dealii::DoFHandler<dim>::active_cell_iterator /*cell*/,
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
     const dealii::types::global_dof_index current_cell_index,
     const dealii::FEValues<dim,dim> &fe_values_vol,
     const std::vector<dealii::types::global_dof_index> &cell_dofs_indices,
@@ -579,16 +585,19 @@ void DGStrong<dim,nstate,real,MeshType>::assemble_volume_term_explicit(
     // Since we have nodal values of the flux, we use the Lagrange polynomials to obtain the gradients at the quadrature points.
     //const dealii::FEValues<dim,dim> &fe_values_lagrange = this->fe_values_collection_volume_lagrange.get_present_fe_values();
     std::vector<realArray> flux_divergence(n_quad_pts);
-    for (int istate = 0; istate<nstate; ++istate) {
-        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-            flux_divergence[iquad][istate] = 0.0;
-            for ( unsigned int flux_basis = 0; flux_basis < n_quad_pts; ++flux_basis ) {
-                if (this->all_parameters->use_split_form == true)
-                {
-                    flux_divergence[iquad][istate] += 2* DGBaseState<dim,nstate,real,MeshType>::pde_physics_double->convective_numerical_split_flux(soln_at_q[iquad],soln_at_q[flux_basis])[istate] *  fe_values_lagrange.shape_grad(flux_basis,iquad);
-                }
-                else
-                {
+    if (this->all_parameters->use_split_form == true) {
+        // Flux differencing with the two-point split flux, evaluated along the 1D lines of volume nodes.
+        two_point_flux_divergence_sum_factorized<dim,nstate,real>(
+            *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_double),
+            soln_at_q,
+            oned_lagrange_derivative[cell->active_fe_index()],
+            fe_values_vol,
+            flux_divergence);
+    } else {
+        for (int istate = 0; istate<nstate; ++istate) {
+            for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+                flux_divergence[iquad][istate] = 0.0;
+                for ( unsigned int flux_basis = 0; flux_basis < n_quad_pts; ++flux_basis ) {
                     flux_divergence[iquad][istate] += conv_phys_flux_at_q[flux_basis][istate] * fe_values_lagrange.shape_grad(flux_basis,iquad);
                 }
             }
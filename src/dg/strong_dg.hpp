@@ -1,8 +1,14 @@
 #ifndef __STRONG_DISCONTINUOUSGALERKIN_H__
 #define __STRONG_DISCONTINUOUSGALERKIN_H__
 
+#include <deal.II/lac/full_matrix.h>
+
 #include "dg.h"
 
+#ifdef PHILIP_USE_KOKKOS
+#include "strong_dg_kokkos.hpp"
+#endif
+
 namespace PHiLiP {
 
 /// DGStrong class templated on the number of state variables
@@ -30,7 +36,32 @@ public:
     /// Destructor
     ~DGStrong();
 
+#ifdef PHILIP_USE_KOKKOS
+    /// Assembles the right_hand_side of the explicit strong form with Kokkos kernels.
+    /** Same right-hand side as assemble_residual() without derivatives, evaluated by Kokkos::parallel_for
+     *  over the flat data of StrongDGKokkosData. The data is re-evaluated when the grid or the volume nodes change.
+     *  Used by the unsteady time steps of the ExplicitODESolver if use_kokkos_residual is set.
+     *  Kokkos must be initialized by the caller, and supports_kokkos_residual() must be true.
+     */
+    void assemble_residual_kokkos ();
+
+    /// Whether assemble_residual_kokkos() supports the current discretization.
+    /** Only conforming grids with standard face orientations and a single polynomial degree,
+     *  without the split form and the artificial dissipation, are supported.
+     *  Evaluated once per grid by reinit_kokkos_data(), which is called if the grid or the volume nodes changed.
+     */
+    bool supports_kokkos_residual ();
+#endif
+
 private:
+#ifdef PHILIP_USE_KOKKOS
+    /// Evaluates the flat geometry, connectivity, and reference basis used by assemble_residual_kokkos().
+    /** Only evaluates whether the discretization is supported if it is not. */
+    void reinit_kokkos_data ();
+
+    /// Flat data of assemble_residual_kokkos(). Only allocated once supports_kokkos_residual() is called.
+    std::unique_ptr<StrongDGKokkosData> kokkos_data;
+#endif
 
     /// Evaluate the integral over the cell volume and the specified derivatives.
     /** Compute both the right-hand side and the corresponding block of dRdW, dRdX, and/or d2R. */
@@ -114,6 +145,12 @@ private:
         dealii::Vector<real>          &current_cell_rhs,
         dealii::Vector<real>          &neighbor_cell_rhs);
 
+    /// 1D Lagrange derivative operator on the nodes of each entry of the oned_quadrature_collection.
+    /** Entry (i,j) is the derivative of the j-th Lagrange polynomial evaluated at the i-th node.
+     *  Used by the sum-factorized split form volume kernel.
+     */
+    std::vector< dealii::FullMatrix<double> > oned_lagrange_derivative;
+
     using DGBase<dim,real,MeshType>::all_parameters; ///< Pointer to all parameters
     using DGBase<dim,real,MeshType>::mpi_communicator; ///< MPI communicator
     using DGBase<dim,real,MeshType>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
@@ -0,0 +1,645 @@
+#include <array>
+
+#include <deal.II/base/qprojector.h>
+
+#include <deal.II/fe/fe_values.h>
+
+#include "strong_dg.hpp"
+
+namespace PHiLiP {
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::reinit_kokkos_data ()
+{
+    using KokkosData = StrongDGKokkosData;
+    kokkos_data = std::make_unique<StrongDGKokkosData>();
+    StrongDGKokkosData &data = *kokkos_data;
+    data.n_dofs = this->dof_handler.n_dofs();
+    data.volume_nodes = this->high_order_grid->volume_nodes;
+
+    // The split form and the artificial dissipation are not implemented in the kernels.
+    // A single polynomial degree is supported, such that the reference basis is shared by all the cells.
+    // The faces must be conforming with the standard orientation, such that both sides share the face quadrature points.
+    bool supported = !all_parameters->use_split_form && !all_parameters->artificial_dissipation_param.add_artificial_dissipation;
+    unsigned int min_fe_index = this->fe_collection.size(), max_fe_index = 0;
+    for (const auto &cell : this->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        min_fe_index = std::min(min_fe_index, cell->active_fe_index());
+        max_fe_index = std::max(max_fe_index, cell->active_fe_index());
+        for (unsigned int iface = 0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) {
+            const auto face = cell->face(iface);
+            const bool is_periodic = face->at_boundary() && cell->has_periodic_neighbor(iface);
+            if (face->at_boundary() && !is_periodic) continue;
+
+            const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+            const bool neighbor_is_coarser = is_periodic ? cell->periodic_neighbor_is_coarser(iface) : cell->neighbor_is_coarser(iface);
+            const bool standard_orientation = cell->face_orientation(iface) && !cell->face_flip(iface) && !cell->face_rotation(iface);
+            if (face->has_children() || neighbor_cell->has_children() || neighbor_is_coarser || !standard_orientation) supported = false;
+        }
+    }
+    min_fe_index = dealii::Utilities::MPI::min(min_fe_index, mpi_communicator);
+    max_fe_index = dealii::Utilities::MPI::max(max_fe_index, mpi_communicator);
+    if (min_fe_index != max_fe_index) supported = false;
+    data.supported = (dealii::Utilities::MPI::min(static_cast<unsigned int>(supported), mpi_communicator) == 1);
+    if (!data.supported) return;
+    const unsigned int i_fele = max_fe_index;
+
+    const dealii::FESystem<dim,dim> &fe = this->fe_collection[i_fele];
+    const dealii::FiniteElement<dim,dim> &base_fe = fe.base_element(0);
+    const dealii::FiniteElement<dim,dim> &lagrange_fe = this->fe_collection_lagrange[i_fele];
+    const dealii::Quadrature<dim> &quadrature = this->volume_quadrature_collection[i_fele];
+    const dealii::Quadrature<dim-1> &face_quadrature = this->face_quadrature_collection[i_fele];
+    const unsigned int n_dofs_cell = fe.n_dofs_per_cell();
+    const unsigned int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+
+    data.n_quad_pts = quadrature.size();
+    data.n_face_quad_pts = face_quadrature.size();
+    data.n_basis = base_fe.n_dofs_per_cell();
+    const unsigned int n_quad_pts = data.n_quad_pts;
+    const unsigned int n_face_quad_pts = data.n_face_quad_pts;
+    const unsigned int n_basis = data.n_basis;
+
+    // Reference basis
+    data.dof_state = KokkosData::View<unsigned int*>("dof_state", n_dofs_cell);
+    data.dof_basis = KokkosData::View<unsigned int*>("dof_basis", n_dofs_cell);
+    for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+        data.dof_state(idof) = fe.system_to_component_index(idof).first;
+        data.dof_basis(idof) = fe.system_to_component_index(idof).second;
+    }
+    data.basis_value = KokkosData::View<double**>("basis_value", n_quad_pts, n_basis);
+    data.basis_grad = KokkosData::View<double***>("basis_grad", n_quad_pts, n_basis, dim);
+    data.lagrange_grad = KokkosData::View<double***>("lagrange_grad", n_quad_pts, n_quad_pts, dim);
+    for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+        const dealii::Point<dim> &point = quadrature.point(iquad);
+        for (unsigned int ibasis = 0; ibasis < n_basis; ++ibasis) {
+            data.basis_value(iquad, ibasis) = base_fe.shape_value(ibasis, point);
+            const dealii::Tensor<1,dim> grad = base_fe.shape_grad(ibasis, point);
+            for (int d = 0; d < dim; ++d) data.basis_grad(iquad, ibasis, d) = grad[d];
+        }
+        for (unsigned int flux_basis = 0; flux_basis < n_quad_pts; ++flux_basis) {
+            const dealii::Tensor<1,dim> grad = lagrange_fe.shape_grad(flux_basis, point);
+            for (int d = 0; d < dim; ++d) data.lagrange_grad(iquad, flux_basis, d) = grad[d];
+        }
+    }
+    data.face_basis_value = KokkosData::View<double***>("face_basis_value", faces_per_cell, n_face_quad_pts, n_basis);
+    data.face_basis_grad = KokkosData::View<double****>("face_basis_grad", faces_per_cell, n_face_quad_pts, n_basis, dim);
+    for (unsigned int iface = 0; iface < faces_per_cell; ++iface) {
+        const dealii::Quadrature<dim> face_points = dealii::QProjector<dim>::project_to_face(dealii::ReferenceCell::get_hypercube(dim), face_quadrature, iface);
+        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+            for (unsigned int ibasis = 0; ibasis < n_basis; ++ibasis) {
+                data.face_basis_value(iface, iquad, ibasis) = base_fe.shape_value(ibasis, face_points.point(iquad));
+                const dealii::Tensor<1,dim> grad = base_fe.shape_grad(ibasis, face_points.point(iquad));
+                for (int d = 0; d < dim; ++d) data.face_basis_grad(iface, iquad, ibasis, d) = grad[d];
+            }
+        }
+    }
+
+    // Number the locally owned cells, followed by the ghost cells sharing a face with them.
+    // Each face is integrated from the same side as DGBase::current_cell_should_do_the_work().
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> cells;
+    std::vector<int> cell_numbers(this->triangulation->n_active_cells(), -1);
+    for (const auto &cell : this->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        cell_numbers[cell->active_cell_index()] = cells.size();
+        cells.push_back(cell);
+    }
+    data.n_locally_owned_cells = cells.size();
+
+    struct FaceCells {
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell[2];
+        unsigned int face_number[2];
+    };
+    std::vector<FaceCells> faces;
+    std::vector<std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, unsigned int>> boundary_faces;
+    std::vector<std::array<unsigned int,2*dim>> cell_face(data.n_locally_owned_cells);
+    std::vector<std::array<unsigned int,2*dim>> cell_face_side(data.n_locally_owned_cells);
+    for (unsigned int icell = 0; icell < data.n_locally_owned_cells; ++icell) {
+        const auto &cell = cells[icell];
+        for (unsigned int iface = 0; iface < faces_per_cell; ++iface) {
+            const auto face = cell->face(iface);
+            const bool is_periodic = face->at_boundary() && cell->has_periodic_neighbor(iface);
+
+            if (face->at_boundary() && !is_periodic) {
+                cell_face[icell][iface] = boundary_faces.size();
+                cell_face_side[icell][iface] = 2;
+                boundary_faces.push_back(std::make_pair(cell, iface));
+                continue;
+            }
+
+            const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+            const bool neighbor_is_coarser = is_periodic ? cell->periodic_neighbor_is_coarser(iface) : cell->neighbor_is_coarser(iface);
+            const bool standard_orientation = cell->face_orientation(iface) && !cell->face_flip(iface) && !cell->face_rotation(iface);
+            Assert(!face->has_children() && !neighbor_cell->has_children() && !neighbor_is_coarser && standard_orientation,
+                   dealii::ExcMessage("The Kokkos residual requires a conforming grid with standard face orientations."));
+            const unsigned int neighbor_iface = is_periodic ? cell->periodic_neighbor_of_periodic_neighbor(iface)
+                                                            : cell->neighbor_of_neighbor(iface);
+
+            bool cell_is_interior_side;
+            if (neighbor_cell->is_ghost()) {
+                cell_is_interior_side = (cell->subdomain_id() < neighbor_cell->subdomain_id());
+                if (cell_numbers[neighbor_cell->active_cell_index()] < 0) {
+                    cell_numbers[neighbor_cell->active_cell_index()] = cells.size();
+                    cells.push_back(neighbor_cell);
+                }
+            } else {
+                cell_is_interior_side = (cell->index() < neighbor_cell->index())
+                                        || (cell->index() == neighbor_cell->index() && cell->level() < neighbor_cell->level());
+                // Locally owned faces are added once, from their interior side.
+                if (!cell_is_interior_side) continue;
+                const unsigned int ineighbor = cell_numbers[neighbor_cell->active_cell_index()];
+                cell_face[ineighbor][neighbor_iface] = faces.size();
+                cell_face_side[ineighbor][neighbor_iface] = 1;
+            }
+            cell_face[icell][iface] = faces.size();
+            cell_face_side[icell][iface] = cell_is_interior_side ? 0 : 1;
+            if (cell_is_interior_side) {
+                faces.push_back({{cell, neighbor_cell}, {iface, neighbor_iface}});
+            } else {
+                faces.push_back({{neighbor_cell, cell}, {neighbor_iface, iface}});
+            }
+        }
+    }
+    data.n_cells = cells.size();
+    data.n_faces = faces.size();
+    data.n_boundary_faces = boundary_faces.size();
+
+    data.cell_face = KokkosData::View<unsigned int**>("cell_face", data.n_locally_owned_cells, faces_per_cell);
+    data.cell_face_side = KokkosData::View<unsigned int**>("cell_face_side", data.n_locally_owned_cells, faces_per_cell);
+    for (unsigned int icell = 0; icell < data.n_locally_owned_cells; ++icell) {
+        for (unsigned int iface = 0; iface < faces_per_cell; ++iface) {
+            data.cell_face(icell, iface) = cell_face[icell][iface];
+            data.cell_face_side(icell, iface) = cell_face_side[icell][iface];
+        }
+    }
+
+    const auto &mapping = *(this->high_order_grid->mapping_fe_field);
+    const dealii::UpdateFlags volume_flags = dealii::update_JxW_values | dealii::update_inverse_jacobians | dealii::update_quadrature_points;
+    const dealii::UpdateFlags face_flags = volume_flags | dealii::update_normal_vectors;
+    dealii::FEValues<dim,dim> fe_values_volume(mapping, fe, quadrature, volume_flags);
+    dealii::FEFaceValues<dim,dim> fe_values_face(mapping, fe, face_quadrature, face_flags);
+
+    // Cells
+    data.cell_dof_indices = KokkosData::View<dealii::types::global_dof_index**>("cell_dof_indices", data.n_cells, n_dofs_cell);
+    data.cell_JxW = KokkosData::View<double**>("cell_JxW", data.n_locally_owned_cells, n_quad_pts);
+    data.cell_inverse_jacobian = KokkosData::View<double****>("cell_inverse_jacobian", data.n_locally_owned_cells, n_quad_pts, dim, dim);
+    data.cell_quadrature_point = KokkosData::View<double***>("cell_quadrature_point", data.n_locally_owned_cells, n_quad_pts, dim);
+    std::vector<dealii::types::global_dof_index> dofs_indices(n_dofs_cell);
+    for (unsigned int icell = 0; icell < data.n_cells; ++icell) {
+        cells[icell]->get_dof_indices(dofs_indices);
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) data.cell_dof_indices(icell, idof) = dofs_indices[idof];
+
+        if (icell >= data.n_locally_owned_cells) continue;
+        fe_values_volume.reinit(cells[icell]);
+        for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+            data.cell_JxW(icell, iquad) = fe_values_volume.JxW(iquad);
+            const dealii::DerivativeForm<1,dim,dim> inverse_jacobian = fe_values_volume.inverse_jacobian(iquad);
+            for (int d = 0; d < dim; ++d) {
+                data.cell_quadrature_point(icell, iquad, d) = fe_values_volume.quadrature_point(iquad)[d];
+                for (int e = 0; e < dim; ++e) data.cell_inverse_jacobian(icell, iquad, d, e) = inverse_jacobian[d][e];
+            }
+        }
+    }
+
+    // Faces
+    data.face_cell = KokkosData::View<unsigned int**>("face_cell", data.n_faces, 2);
+    data.face_number = KokkosData::View<unsigned int**>("face_number", data.n_faces, 2);
+    data.face_penalty = KokkosData::View<double*>("face_penalty", data.n_faces);
+    data.face_JxW = KokkosData::View<double**>("face_JxW", data.n_faces, n_face_quad_pts);
+    data.face_normal = KokkosData::View<double***>("face_normal", data.n_faces, n_face_quad_pts, dim);
+    data.face_inverse_jacobian = KokkosData::View<double*****>("face_inverse_jacobian", data.n_faces, 2, n_face_quad_pts, dim, dim);
+    for (unsigned int iface = 0; iface < data.n_faces; ++iface) {
+        const FaceCells &face = faces[iface];
+        data.face_penalty(iface) = 0.5 * (this->evaluate_penalty_scaling(face.cell[0], face.face_number[0], this->fe_collection)
+                                          + this->evaluate_penalty_scaling(face.cell[1], face.face_number[1], this->fe_collection));
+        for (unsigned int side = 0; side < 2; ++side) {
+            data.face_cell(iface, side) = cell_numbers[face.cell[side]->active_cell_index()];
+            data.face_number(iface, side) = face.face_number[side];
+
+            fe_values_face.reinit(face.cell[side], face.face_number[side]);
+            for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+                if (side == 0) {
+                    data.face_JxW(iface, iquad) = fe_values_face.JxW(iquad);
+                    for (int d = 0; d < dim; ++d) data.face_normal(iface, iquad, d) = fe_values_face.normal_vector(iquad)[d];
+                }
+                const dealii::DerivativeForm<1,dim,dim> inverse_jacobian = fe_values_face.inverse_jacobian(iquad);
+                for (int d = 0; d < dim; ++d) {
+                    for (int e = 0; e < dim; ++e) data.face_inverse_jacobian(iface, side, iquad, d, e) = inverse_jacobian[d][e];
+                }
+            }
+        }
+    }
+
+    // Boundary faces
+    data.boundary_cell = KokkosData::View<unsigned int*>("boundary_cell", data.n_boundary_faces);
+    data.boundary_face_number = KokkosData::View<unsigned int*>("boundary_face_number", data.n_boundary_faces);
+    data.boundary_id = KokkosData::View<unsigned int*>("boundary_id", data.n_boundary_faces);
+    data.boundary_penalty = KokkosData::View<double*>("boundary_penalty", data.n_boundary_faces);
+    data.boundary_JxW = KokkosData::View<double**>("boundary_JxW", data.n_boundary_faces, n_face_quad_pts);
+    data.boundary_normal = KokkosData::View<double***>("boundary_normal", data.n_boundary_faces, n_face_quad_pts, dim);
+    data.boundary_inverse_jacobian = KokkosData::View<double****>("boundary_inverse_jacobian", data.n_boundary_faces, n_face_quad_pts, dim, dim);
+    data.boundary_quadrature_point = KokkosData::View<double***>("boundary_quadrature_point", data.n_boundary_faces, n_face_quad_pts, dim);
+    for (unsigned int iface = 0; iface < data.n_boundary_faces; ++iface) {
+        const auto &cell = boundary_faces[iface].first;
+        const unsigned int face_number = boundary_faces[iface].second;
+        data.boundary_cell(iface) = cell_numbers[cell->active_cell_index()];
+        data.boundary_face_number(iface) = face_number;
+        data.boundary_id(iface) = cell->face(face_number)->boundary_id();
+        data.boundary_penalty(iface) = this->evaluate_penalty_scaling(cell, face_number, this->fe_collection);
+
+        fe_values_face.reinit(cell, face_number);
+        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+            data.boundary_JxW(iface, iquad) = fe_values_face.JxW(iquad);
+            const dealii::DerivativeForm<1,dim,dim> inverse_jacobian = fe_values_face.inverse_jacobian(iquad);
+            for (int d = 0; d < dim; ++d) {
+                data.boundary_normal(iface, iquad, d) = fe_values_face.normal_vector(iquad)[d];
+                data.boundary_quadrature_point(iface, iquad, d) = fe_values_face.quadrature_point(iquad)[d];
+                for (int e = 0; e < dim; ++e) data.boundary_inverse_jacobian(iface, iquad, d, e) = inverse_jacobian[d][e];
+            }
+        }
+    }
+
+    data.soln = KokkosData::View<double***>("soln", data.n_cells, nstate, n_basis);
+    data.cell_rhs = KokkosData::View<double***>("cell_rhs", data.n_locally_owned_cells, nstate, n_basis);
+    data.face_rhs = KokkosData::View<double****>("face_rhs", data.n_faces, 2, nstate, n_basis);
+    data.boundary_rhs = KokkosData::View<double***>("boundary_rhs", data.n_boundary_faces, nstate, n_basis);
+
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+bool DGStrong<dim,nstate,real,MeshType>::supports_kokkos_residual ()
+{
+    bool reinit = !kokkos_data
+                  || kokkos_data->n_dofs != this->dof_handler.n_dofs()
+                  || kokkos_data->volume_nodes.size() != this->high_order_grid->volume_nodes.size();
+    if (!reinit) {
+        auto diff_node = this->high_order_grid->volume_nodes;
+        diff_node -= kokkos_data->volume_nodes;
+        reinit = (diff_node.l2_norm() != 0.0);
+    }
+    if (reinit) reinit_kokkos_data();
+    return kokkos_data->supported;
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGStrong<dim,nstate,real,MeshType>::assemble_residual_kokkos ()
+{
+    using ExecutionSpace = StrongDGKokkosData::ExecutionSpace;
+    using ArrayType = std::array<real,nstate>;
+    using ArrayTensor1Type = std::array< dealii::Tensor<1,dim,real>, nstate >;
+
+    AssertThrow(supports_kokkos_residual(),
+                dealii::ExcMessage("The Kokkos residual does not support this discretization, see supports_kokkos_residual()."));
+
+    // The views are copied into the kernels, which only copies their handles.
+    const StrongDGKokkosData &data = *kokkos_data;
+    const unsigned int n_quad_pts = data.n_quad_pts;
+    const unsigned int n_face_quad_pts = data.n_face_quad_pts;
+    const unsigned int n_basis = data.n_basis;
+    const unsigned int n_dofs_cell = data.dof_state.extent(0);
+    const unsigned int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+
+    const auto dof_state = data.dof_state;
+    const auto dof_basis = data.dof_basis;
+    const auto basis_value = data.basis_value;
+    const auto basis_grad = data.basis_grad;
+    const auto lagrange_grad = data.lagrange_grad;
+    const auto face_basis_value = data.face_basis_value;
+    const auto face_basis_grad = data.face_basis_grad;
+    const auto cell_dof_indices = data.cell_dof_indices;
+    const auto cell_JxW = data.cell_JxW;
+    const auto cell_inverse_jacobian = data.cell_inverse_jacobian;
+    const auto cell_quadrature_point = data.cell_quadrature_point;
+    const auto cell_face = data.cell_face;
+    const auto cell_face_side = data.cell_face_side;
+    const auto face_cell = data.face_cell;
+    const auto face_number = data.face_number;
+    const auto face_penalty = data.face_penalty;
+    const auto face_JxW = data.face_JxW;
+    const auto face_normal = data.face_normal;
+    const auto face_inverse_jacobian = data.face_inverse_jacobian;
+    const auto boundary_cell = data.boundary_cell;
+    const auto boundary_face_number = data.boundary_face_number;
+    const auto boundary_id = data.boundary_id;
+    const auto boundary_penalty = data.boundary_penalty;
+    const auto boundary_JxW = data.boundary_JxW;
+    const auto boundary_normal = data.boundary_normal;
+    const auto boundary_inverse_jacobian = data.boundary_inverse_jacobian;
+    const auto boundary_quadrature_point = data.boundary_quadrature_point;
+    const auto soln = data.soln;
+    const auto cell_rhs = data.cell_rhs;
+    const auto face_rhs = data.face_rhs;
+    const auto boundary_rhs = data.boundary_rhs;
+
+    const Physics::PhysicsBase<dim,nstate,real> *const physics = this->pde_physics_double.get();
+    const NumericalFlux::NumericalFluxConvective<dim,nstate,real> *const conv_num_flux = this->conv_num_flux_double.get();
+    const NumericalFlux::NumericalFluxDissipative<dim,nstate,real> *const diss_num_flux = this->diss_num_flux_double.get();
+    const bool use_source_term = all_parameters->manufactured_convergence_study_param.manufactured_solution_param.use_manufactured_source_term;
+
+    // Solution and its physical gradient at a quadrature point, from the basis at that point.
+    const auto interpolate = [=] (
+        const unsigned int icell,
+        const auto &point_basis_value,
+        const auto &point_basis_grad,
+        const auto &point_inverse_jacobian,
+        ArrayType &soln_at_q,
+        ArrayTensor1Type &soln_grad_at_q)
+    {
+        for (int istate = 0; istate < nstate; ++istate) {
+            soln_at_q[istate] = 0.0;
+            soln_grad_at_q[istate] = 0.0;
+            for (unsigned int ibasis = 0; ibasis < n_basis; ++ibasis) {
+                const real coeff = soln(icell, istate, ibasis);
+                soln_at_q[istate] += coeff * point_basis_value(ibasis);
+                for (int d = 0; d < dim; ++d) {
+                    for (int e = 0; e < dim; ++e) {
+                        soln_grad_at_q[istate][e] += coeff * point_basis_grad(ibasis, d) * point_inverse_jacobian(d, e);
+                    }
+                }
+            }
+        }
+    };
+
+    this->solution.update_ghost_values();
+
+    // Gather the solution of the locally owned and ghost cells.
+    Kokkos::parallel_for("DGStrong::pack_solution", Kokkos::RangePolicy<ExecutionSpace>(0, data.n_cells), [=] (const unsigned int icell) {
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+            soln(icell, dof_state(idof), dof_basis(idof)) = this->solution[cell_dof_indices(icell, idof)];
+        }
+    });
+
+    // Volume kernel: same terms as assemble_volume_term_explicit() without the split form.
+    Kokkos::parallel_for("DGStrong::volume_kernel", Kokkos::RangePolicy<ExecutionSpace>(0, data.n_locally_owned_cells), [=] (const unsigned int icell) {
+        std::vector<ArrayType> soln_at_q(n_quad_pts);
+        std::vector<ArrayTensor1Type> conv_phys_flux_at_q(n_quad_pts);
+        std::vector<ArrayTensor1Type> diss_phys_flux_at_q(n_quad_pts);
+        std::vector<ArrayType> source_at_q(n_quad_pts);
+        for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+            ArrayTensor1Type soln_grad_at_q;
+            interpolate(icell,
+                        Kokkos::subview(basis_value, iquad, Kokkos::ALL),
+                        Kokkos::subview(basis_grad, iquad, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(cell_inverse_jacobian, icell, iquad, Kokkos::ALL, Kokkos::ALL),
+                        soln_at_q[iquad], soln_grad_at_q);
+            conv_phys_flux_at_q[iquad] = physics->convective_flux (soln_at_q[iquad]);
+            diss_phys_flux_at_q[iquad] = physics->dissipative_flux (soln_at_q[iquad], soln_grad_at_q);
+            if (use_source_term) {
+                dealii::Point<dim,real> quad_point;
+                for (int d = 0; d < dim; ++d) quad_point[d] = cell_quadrature_point(icell, iquad, d);
+                source_at_q[iquad] = physics->source_term (quad_point, soln_at_q[iquad]);
+            }
+        }
+
+        // Flux divergence from the Lagrange interpolation of the convective flux.
+        std::vector<ArrayType> flux_divergence(n_quad_pts);
+        for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+            for (int istate = 0; istate < nstate; ++istate) flux_divergence[iquad][istate] = 0.0;
+            for (unsigned int flux_basis = 0; flux_basis < n_quad_pts; ++flux_basis) {
+                dealii::Tensor<1,dim,real> flux_basis_grad;
+                for (int d = 0; d < dim; ++d) {
+                    for (int e = 0; e < dim; ++e) flux_basis_grad[e] += lagrange_grad(iquad, flux_basis, d) * cell_inverse_jacobian(icell, iquad, d, e);
+                }
+                for (int istate = 0; istate < nstate; ++istate) {
+                    flux_divergence[iquad][istate] += conv_phys_flux_at_q[flux_basis][istate] * flux_basis_grad;
+                }
+            }
+        }
+
+        for (unsigned int ibasis = 0; ibasis < n_basis; ++ibasis) {
+            for (int istate = 0; istate < nstate; ++istate) cell_rhs(icell, istate, ibasis) = 0.0;
+            for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+                const real JxW = cell_JxW(icell, iquad);
+                const real phi = basis_value(iquad, ibasis);
+                dealii::Tensor<1,dim,real> phi_grad;
+                for (int d = 0; d < dim; ++d) {
+                    for (int e = 0; e < dim; ++e) phi_grad[e] += basis_grad(iquad, ibasis, d) * cell_inverse_jacobian(icell, iquad, d, e);
+                }
+                for (int istate = 0; istate < nstate; ++istate) {
+                    real rhs = - phi * flux_divergence[iquad][istate] + phi_grad * diss_phys_flux_at_q[iquad][istate];
+                    if (use_source_term) rhs += phi * source_at_q[iquad][istate];
+                    cell_rhs(icell, istate, ibasis) += rhs * JxW;
+                }
+            }
+        }
+    });
+
+    // Face kernel: same terms as assemble_face_term_explicit(), evaluated for both sides of the face.
+    Kokkos::parallel_for("DGStrong::face_kernel", Kokkos::RangePolicy<ExecutionSpace>(0, data.n_faces), [=] (const unsigned int iface) {
+        const unsigned int cell_int = face_cell(iface, 0), cell_ext = face_cell(iface, 1);
+        const unsigned int face_int = face_number(iface, 0), face_ext = face_number(iface, 1);
+        const real penalty = face_penalty(iface);
+
+        std::vector<dealii::Tensor<1,dim,real>> normals_int(n_face_quad_pts);
+        std::vector<ArrayType> conv_num_flux_dot_n(n_face_quad_pts);
+        std::vector<ArrayTensor1Type> conv_phys_flux_int(n_face_quad_pts), conv_phys_flux_ext(n_face_quad_pts);
+        std::vector<ArrayType> diss_auxi_num_flux_dot_n(n_face_quad_pts);
+        std::vector<ArrayTensor1Type> diss_flux_jump_int(n_face_quad_pts), diss_flux_jump_ext(n_face_quad_pts);
+        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+            ArrayType soln_int, soln_ext;
+            ArrayTensor1Type soln_grad_int, soln_grad_ext;
+            interpolate(cell_int,
+                        Kokkos::subview(face_basis_value, face_int, iquad, Kokkos::ALL),
+                        Kokkos::subview(face_basis_grad, face_int, iquad, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(face_inverse_jacobian, iface, 0, iquad, Kokkos::ALL, Kokkos::ALL),
+                        soln_int, soln_grad_int);
+            interpolate(cell_ext,
+                        Kokkos::subview(face_basis_value, face_ext, iquad, Kokkos::ALL),
+                        Kokkos::subview(face_basis_grad, face_ext, iquad, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(face_inverse_jacobian, iface, 1, iquad, Kokkos::ALL, Kokkos::ALL),
+                        soln_ext, soln_grad_ext);
+
+            for (int d = 0; d < dim; ++d) normals_int[iquad][d] = face_normal(iface, iquad, d);
+            const dealii::Tensor<1,dim,real> normal_int = normals_int[iquad];
+            const dealii::Tensor<1,dim,real> normal_ext = -normal_int;
+
+            conv_num_flux_dot_n[iquad] = conv_num_flux->evaluate_flux(soln_int, soln_ext, normal_int);
+            conv_phys_flux_int[iquad] = physics->convective_flux (soln_int);
+            conv_phys_flux_ext[iquad] = physics->convective_flux (soln_ext);
+
+            const ArrayType diss_soln_num_flux = diss_num_flux->evaluate_solution_flux(soln_int, soln_ext, normal_int);
+            ArrayTensor1Type diss_soln_jump_int, diss_soln_jump_ext;
+            for (int s = 0; s < nstate; ++s) {
+                for (int d = 0; d < dim; ++d) {
+                    diss_soln_jump_int[s][d] = (diss_soln_num_flux[s] - soln_int[s]) * normal_int[d];
+                    diss_soln_jump_ext[s][d] = (diss_soln_num_flux[s] - soln_ext[s]) * normal_ext[d];
+                }
+            }
+            diss_flux_jump_int[iquad] = physics->dissipative_flux (soln_int, diss_soln_jump_int);
+            diss_flux_jump_ext[iquad] = physics->dissipative_flux (soln_ext, diss_soln_jump_ext);
+
+            diss_auxi_num_flux_dot_n[iquad] = diss_num_flux->evaluate_auxiliary_flux(
+                0.0, 0.0,
+                soln_int, soln_ext,
+                soln_grad_int, soln_grad_ext,
+                normal_int, penalty);
+        }
+
+        for (unsigned int ibasis = 0; ibasis < n_basis; ++ibasis) {
+            for (int istate = 0; istate < nstate; ++istate) {
+                face_rhs(iface, 0, istate, ibasis) = 0.0;
+                face_rhs(iface, 1, istate, ibasis) = 0.0;
+            }
+            for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+                const real JxW = face_JxW(iface, iquad);
+                const real phi_int = face_basis_value(face_int, iquad, ibasis);
+                const real phi_ext = face_basis_value(face_ext, iquad, ibasis);
+                dealii::Tensor<1,dim,real> phi_grad_int, phi_grad_ext;
+                for (int d = 0; d < dim; ++d) {
+                    for (int e = 0; e < dim; ++e) {
+                        phi_grad_int[e] += face_basis_grad(face_int, iquad, ibasis, d) * face_inverse_jacobian(iface, 0, iquad, d, e);
+                        phi_grad_ext[e] += face_basis_grad(face_ext, iquad, ibasis, d) * face_inverse_jacobian(iface, 1, iquad, d, e);
+                    }
+                }
+                for (int istate = 0; istate < nstate; ++istate) {
+                    const real flux_diff_int = conv_num_flux_dot_n[iquad][istate] - conv_phys_flux_int[iquad][istate]*normals_int[iquad];
+                    const real flux_diff_ext = (-conv_num_flux_dot_n[iquad][istate]) - conv_phys_flux_ext[iquad][istate]*(-normals_int[iquad]);
+
+                    face_rhs(iface, 0, istate, ibasis) += (- phi_int * flux_diff_int
+                                                           - phi_int * diss_auxi_num_flux_dot_n[iquad][istate]
+                                                           + phi_grad_int * diss_flux_jump_int[iquad][istate]) * JxW;
+                    face_rhs(iface, 1, istate, ibasis) += (- phi_ext * flux_diff_ext
+                                                           - phi_ext * (-diss_auxi_num_flux_dot_n[iquad][istate])
+                                                           + phi_grad_ext * diss_flux_jump_ext[iquad][istate]) * JxW;
+                }
+            }
+        }
+    });
+
+    // Boundary kernel: same terms as assemble_boundary_term_explicit().
+    Kokkos::parallel_for("DGStrong::boundary_kernel", Kokkos::RangePolicy<ExecutionSpace>(0, data.n_boundary_faces), [=] (const unsigned int iface) {
+        const unsigned int icell = boundary_cell(iface);
+        const unsigned int face_int = boundary_face_number(iface);
+        const real penalty = boundary_penalty(iface);
+
+        std::vector<dealii::Tensor<1,dim,real>> normals(n_face_quad_pts);
+        std::vector<ArrayType> conv_num_flux_dot_n(n_face_quad_pts);
+        std::vector<ArrayTensor1Type> conv_phys_flux(n_face_quad_pts);
+        std::vector<ArrayType> diss_auxi_num_flux_dot_n(n_face_quad_pts);
+        std::vector<ArrayTensor1Type> diss_flux_jump_int(n_face_quad_pts);
+        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+            ArrayType soln_int, soln_ext;
+            ArrayTensor1Type soln_grad_int, soln_grad_ext;
+            interpolate(icell,
+                        Kokkos::subview(face_basis_value, face_int, iquad, Kokkos::ALL),
+                        Kokkos::subview(face_basis_grad, face_int, iquad, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(boundary_inverse_jacobian, iface, iquad, Kokkos::ALL, Kokkos::ALL),
+                        soln_int, soln_grad_int);
+
+            for (int d = 0; d < dim; ++d) normals[iquad][d] = boundary_normal(iface, iquad, d);
+            const dealii::Tensor<1,dim,real> normal_int = normals[iquad];
+            dealii::Point<dim,real> quad_point;
+            for (int d = 0; d < dim; ++d) quad_point[d] = boundary_quadrature_point(iface, iquad, d);
+            physics->boundary_face_values (boundary_id(iface), quad_point, normal_int, soln_int, soln_grad_int, soln_ext, soln_grad_ext);
+
+            conv_num_flux_dot_n[iquad] = conv_num_flux->evaluate_flux(soln_int, soln_ext, normal_int);
+            conv_phys_flux[iquad] = physics->convective_flux (soln_int);
+
+            // The dissipative solution flux uses the boundary values on both sides.
+            const ArrayType diss_soln_num_flux = diss_num_flux->evaluate_solution_flux(soln_ext, soln_ext, normal_int);
+            ArrayTensor1Type diss_soln_jump_int;
+            for (int s = 0; s < nstate; ++s) {
+                for (int d = 0; d < dim; ++d) {
+                    diss_soln_jump_int[s][d] = (diss_soln_num_flux[s] - soln_int[s]) * normal_int[d];
+                }
+            }
+            diss_flux_jump_int[iquad] = physics->dissipative_flux (soln_int, diss_soln_jump_int);
+
+            diss_auxi_num_flux_dot_n[iquad] = diss_num_flux->evaluate_auxiliary_flux(
+                0.0, 0.0,
+                soln_int, soln_ext,
+                soln_grad_int, soln_grad_ext,
+                normal_int, penalty, true);
+        }
+
+        for (unsigned int ibasis = 0; ibasis < n_basis; ++ibasis) {
+            for (int istate = 0; istate < nstate; ++istate) boundary_rhs(iface, istate, ibasis) = 0.0;
+            for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+                const real JxW = boundary_JxW(iface, iquad);
+                const real phi = face_basis_value(face_int, iquad, ibasis);
+                dealii::Tensor<1,dim,real> phi_grad;
+                for (int d = 0; d < dim; ++d) {
+                    for (int e = 0; e < dim; ++e) phi_grad[e] += face_basis_grad(face_int, iquad, ibasis, d) * boundary_inverse_jacobian(iface, iquad, d, e);
+                }
+                for (int istate = 0; istate < nstate; ++istate) {
+                    const real flux_diff = conv_num_flux_dot_n[iquad][istate] - conv_phys_flux[iquad][istate]*normals[iquad];
+                    boundary_rhs(iface, istate, ibasis) += (- phi * flux_diff
+                                                            - phi * diss_auxi_num_flux_dot_n[iquad][istate]
+                                                            + phi_grad * diss_flux_jump_int[iquad][istate]) * JxW;
+                }
+            }
+        }
+    });
+
+    // Each locally owned cell gathers its volume and face contributions.
+    // The degrees of freedom of a cell are only written by that cell.
+    dealii::LinearAlgebra::distributed::Vector<double> &rhs = this->right_hand_side;
+    Kokkos::parallel_for("DGStrong::gather_residual", Kokkos::RangePolicy<ExecutionSpace>(0, data.n_locally_owned_cells), [=, &rhs] (const unsigned int icell) {
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) {
+            const unsigned int istate = dof_state(idof), ibasis = dof_basis(idof);
+            real cell_residual = cell_rhs(icell, istate, ibasis);
+            for (unsigned int iface = 0; iface < faces_per_cell; ++iface) {
+                const unsigned int side = cell_face_side(icell, iface);
+                if (side == 2) cell_residual += boundary_rhs(cell_face(icell, iface), istate, ibasis);
+                else cell_residual += face_rhs(cell_face(icell, iface), side, istate, ibasis);
+            }
+            rhs[cell_dof_indices(icell, idof)] = cell_residual;
+        }
+    });
+    Kokkos::fence();
+
+    this->right_hand_side.update_ghost_values();
+    this->invalidate_residual_norms();
+}
+
+// The class itself is instantiated in strong_dg.cpp.
+template void DGStrong <PHILIP_DIM, 1, double, dealii::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 2, double, dealii::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 3, double, dealii::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 4, double, dealii::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 5, double, dealii::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template bool DGStrong <PHILIP_DIM, 1, double, dealii::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 2, double, dealii::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 3, double, dealii::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 4, double, dealii::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 5, double, dealii::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template void DGStrong <PHILIP_DIM, 1, double, dealii::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 2, double, dealii::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 3, double, dealii::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 4, double, dealii::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 5, double, dealii::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+
+template void DGStrong <PHILIP_DIM, 1, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 2, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 3, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 4, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 5, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template bool DGStrong <PHILIP_DIM, 1, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 2, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 3, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 4, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 5, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template void DGStrong <PHILIP_DIM, 1, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 2, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 3, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 4, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 5, double, dealii::parallel::shared::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+
+#if PHILIP_DIM!=1
+template void DGStrong <PHILIP_DIM, 1, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 2, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 3, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 4, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template void DGStrong <PHILIP_DIM, 5, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::reinit_kokkos_data ();
+template bool DGStrong <PHILIP_DIM, 1, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 2, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 3, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 4, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template bool DGStrong <PHILIP_DIM, 5, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::supports_kokkos_residual ();
+template void DGStrong <PHILIP_DIM, 1, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 2, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 3, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 4, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+template void DGStrong <PHILIP_DIM, 5, double, dealii::parallel::distributed::Triangulation<PHILIP_DIM>>::assemble_residual_kokkos ();
+#endif
+
+} // PHiLiP namespace
@@ -0,0 +1,120 @@
+#ifndef __STRONG_DG_KOKKOS_H__
+#define __STRONG_DG_KOKKOS_H__
+
+#include <Kokkos_Core.hpp>
+
+#include <deal.II/base/types.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace PHiLiP {
+
+/// Flat cell and face data of the strong DG explicit residual evaluated with Kokkos.
+/** The data is stored as structure-of-arrays Kokkos::View, indexed by cell, face, or boundary face,
+ *  such that the volume, face, and boundary kernels are Kokkos::parallel_for over flat ranges.
+ *
+ *  The locally owned cells are numbered first, followed by the ghost cells sharing a face with them.
+ *  The solution is stored per cell as (state, basis function) coefficients of the scalar base element,
+ *  and the physical gradients are obtained from the reference gradients and the inverse Jacobians.
+ *
+ *  Each face contributes to both of its cells through face_rhs, which is then gathered by the cells.
+ *  Therefore, no two threads write to the same entry.
+ *
+ *  The kernels call the virtual functions of the Physics and NumericalFlux, which only exist on the host.
+ *  The execution space is therefore the default host execution space, i.e. OpenMP if Kokkos was built with it.
+ */
+struct StrongDGKokkosData
+{
+    /// Execution space of the kernels.
+    using ExecutionSpace = Kokkos::DefaultHostExecutionSpace;
+    /// Views stored in the memory space of the execution space.
+    template <typename DataType>
+    using View = Kokkos::View<DataType, Kokkos::LayoutRight, typename ExecutionSpace::memory_space>;
+
+    unsigned int n_quad_pts; ///< Number of volume quadrature points.
+    unsigned int n_face_quad_pts; ///< Number of face quadrature points.
+    unsigned int n_basis; ///< Number of basis functions of the scalar base element.
+
+    /// State of each degree of freedom of the FESystem.
+    View<unsigned int*> dof_state;
+    /// Basis function of each degree of freedom of the FESystem.
+    View<unsigned int*> dof_basis;
+
+    /// Basis functions at the volume quadrature points (quadrature point, basis function).
+    View<double**> basis_value;
+    /// Reference gradients at the volume quadrature points (quadrature point, basis function, direction).
+    View<double***> basis_grad;
+    /// Reference gradients of the Lagrange basis collocated on the volume quadrature points (quadrature point, flux basis function, direction).
+    View<double***> lagrange_grad;
+    /// Basis functions at the face quadrature points (face number, quadrature point, basis function).
+    View<double***> face_basis_value;
+    /// Reference gradients at the face quadrature points (face number, quadrature point, basis function, direction).
+    View<double****> face_basis_grad;
+
+    unsigned int n_locally_owned_cells; ///< Number of locally owned cells, which are numbered first.
+    unsigned int n_cells; ///< Number of locally owned and ghost cells.
+    /// Global degrees of freedom of each cell (cell, degree of freedom).
+    View<dealii::types::global_dof_index**> cell_dof_indices;
+    /// JxW at the volume quadrature points of the locally owned cells (cell, quadrature point).
+    View<double**> cell_JxW;
+    /// Inverse Jacobians at the volume quadrature points of the locally owned cells (cell, quadrature point, reference direction, physical direction).
+    View<double****> cell_inverse_jacobian;
+    /// Volume quadrature points of the locally owned cells (cell, quadrature point, direction).
+    View<double***> cell_quadrature_point;
+    /// Face or boundary face of each face of the locally owned cells (cell, face number).
+    View<unsigned int**> cell_face;
+    /// Side of the cell on its faces: 0 for the interior side of a face, 1 for its exterior side, and 2 for a boundary face.
+    View<unsigned int**> cell_face_side;
+
+    unsigned int n_faces; ///< Number of faces between two cells.
+    /// Interior and exterior cells of the faces (face, side).
+    View<unsigned int**> face_cell;
+    /// Face numbers of the interior and exterior cells (face, side).
+    View<unsigned int**> face_number;
+    /// Penalty of the faces.
+    View<double*> face_penalty;
+    /// JxW at the face quadrature points, from the interior side (face, quadrature point).
+    View<double**> face_JxW;
+    /// Normals at the face quadrature points, pointing out of the interior cell (face, quadrature point, direction).
+    View<double***> face_normal;
+    /// Inverse Jacobians at the face quadrature points of both cells (face, side, quadrature point, reference direction, physical direction).
+    View<double*****> face_inverse_jacobian;
+
+    unsigned int n_boundary_faces; ///< Number of faces on the domain boundary.
+    /// Cell of the boundary faces.
+    View<unsigned int*> boundary_cell;
+    /// Face number of the boundary faces.
+    View<unsigned int*> boundary_face_number;
+    /// Boundary id of the boundary faces.
+    View<unsigned int*> boundary_id;
+    /// Penalty of the boundary faces.
+    View<double*> boundary_penalty;
+    /// JxW at the boundary quadrature points (boundary face, quadrature point).
+    View<double**> boundary_JxW;
+    /// Outward normals at the boundary quadrature points (boundary face, quadrature point, direction).
+    View<double***> boundary_normal;
+    /// Inverse Jacobians at the boundary quadrature points (boundary face, quadrature point, reference direction, physical direction).
+    View<double****> boundary_inverse_jacobian;
+    /// Boundary quadrature points (boundary face, quadrature point, direction).
+    View<double***> boundary_quadrature_point;
+
+    /// Solution coefficients of the locally owned and ghost cells (cell, state, basis function).
+    View<double***> soln;
+    /// Volume contribution to the residual of the locally owned cells (cell, state, basis function).
+    View<double***> cell_rhs;
+    /// Face contributions to the residual of both cells (face, side, state, basis function).
+    View<double****> face_rhs;
+    /// Boundary face contributions to the residual (boundary face, state, basis function).
+    View<double***> boundary_rhs;
+
+    /// Whether the discretization is supported by the kernels, in which case the remaining data is evaluated.
+    bool supported;
+
+    /// Number of degrees of freedom the data was evaluated for.
+    dealii::types::global_dof_index n_dofs;
+    /// Volume nodes the geometry was evaluated on.
+    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes;
+};
+
+} // PHiLiP namespace
+
+#endif
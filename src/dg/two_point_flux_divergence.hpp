@@ -0,0 +1,112 @@
+#ifndef __TWO_POINT_FLUX_DIVERGENCE_H__
+#define __TWO_POINT_FLUX_DIVERGENCE_H__
+
+#include <array>
+#include <vector>
+
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/lac/full_matrix.h>
+
+#include "physics/physics.h"
+
+namespace PHiLiP {
+
+/// 1D Lagrange derivative operator on the nodes of @p oned_quadrature.
+/** Entry (i,j) is the derivative of the j-th Lagrange polynomial, collocated on the quadrature nodes,
+ *  evaluated at the i-th node.
+ */
+inline dealii::FullMatrix<double> build_oned_lagrange_derivative (const dealii::Quadrature<1> &oned_quadrature)
+{
+    const dealii::FE_DGQArbitraryNodes<1,1> oned_lagrange(oned_quadrature);
+    const unsigned int n_oned_pts = oned_quadrature.size();
+    dealii::FullMatrix<double> derivative(n_oned_pts, n_oned_pts);
+    for (unsigned int inode=0; inode<n_oned_pts; ++inode) {
+        for (unsigned int jbasis=0; jbasis<n_oned_pts; ++jbasis) {
+            derivative(inode,jbasis) = oned_lagrange.shape_grad(jbasis, oned_quadrature.point(inode))[0];
+        }
+    }
+    return derivative;
+}
+
+/// Split form flux divergence at the volume nodes, summing the two-point flux over all pairs of nodes.
+/** \f[ (\nabla \cdot \mathbf{f})_i = \sum_j 2 \mathbf{f}^{\#}(\mathbf{u}_i,\mathbf{u}_j) \cdot \nabla \ell_j(\mathbf{x}_i) \f]
+ *  with the Lagrange basis gradients of @p fe_values_lagrange. Requires O(p^{2 dim}) two-point fluxes.
+ *  Kept as the reference of two_point_flux_divergence_sum_factorized().
+ */
+template <int dim, int nstate, typename real>
+void two_point_flux_divergence_all_pairs (
+    const Physics::PhysicsBase<dim,nstate,real> &physics,
+    const std::vector<std::array<real,nstate>> &soln_at_q,
+    const dealii::FEValues<dim,dim> &fe_values_lagrange,
+    std::vector<std::array<real,nstate>> &flux_divergence)
+{
+    const unsigned int n_quad_pts = soln_at_q.size();
+    flux_divergence.resize(n_quad_pts);
+    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+        for (int istate = 0; istate<nstate; ++istate) {
+            flux_divergence[iquad][istate] = 0.0;
+        }
+        for (unsigned int flux_basis = 0; flux_basis < n_quad_pts; ++flux_basis) {
+            const std::array<dealii::Tensor<1,dim,real>,nstate> split_flux = physics.convective_numerical_split_flux(soln_at_q[iquad],soln_at_q[flux_basis]);
+            const dealii::Tensor<1,dim,real> basis_grad = fe_values_lagrange.shape_grad(flux_basis,iquad);
+            for (int istate = 0; istate<nstate; ++istate) {
+                flux_divergence[iquad][istate] += 2.0 * split_flux[istate] * basis_grad;
+            }
+        }
+    }
+}
+
+/// Split form flux divergence at the volume nodes, summing the two-point flux along the 1D lines of nodes.
+/** The Lagrange basis is a tensor product collocated on the volume quadrature nodes (lexicographic ordering).
+ *  Therefore, its reference derivative along direction d at a node vanishes for all basis functions
+ *  that are not on the same 1D line along d, and only those pairs are evaluated.
+ *  This is O(p^{dim+1}) two-point fluxes per cell instead of the O(p^{2 dim}) of two_point_flux_divergence_all_pairs().
+ *
+ *  @param oned_derivative  Entry (i,j) is the derivative of the j-th 1D Lagrange polynomial at the i-th 1D node.
+ *  @param fe_values_vol  Provides the inverse Jacobian of the mapping at the volume nodes.
+ */
+template <int dim, int nstate, typename real>
+void two_point_flux_divergence_sum_factorized (
+    const Physics::PhysicsBase<dim,nstate,real> &physics,
+    const std::vector<std::array<real,nstate>> &soln_at_q,
+    const dealii::FullMatrix<double> &oned_derivative,
+    const dealii::FEValues<dim,dim> &fe_values_vol,
+    std::vector<std::array<real,nstate>> &flux_divergence)
+{
+    const unsigned int n_quad_pts = soln_at_q.size();
+    const unsigned int n_oned_pts = oned_derivative.m();
+    AssertDimension (dealii::Utilities::fixed_power<dim>(n_oned_pts), n_quad_pts);
+
+    flux_divergence.resize(n_quad_pts);
+    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+        for (int istate = 0; istate<nstate; ++istate) {
+            flux_divergence[iquad][istate] = 0.0;
+        }
+        // Entries [d][e] are the derivatives of the reference coordinate d with respect to the physical coordinate e.
+        const dealii::DerivativeForm<1,dim,dim> inverse_jacobian = fe_values_vol.inverse_jacobian(iquad);
+
+        unsigned int stride = 1;
+        for (int d=0; d<dim; ++d) {
+            const unsigned int inode = (iquad / stride) % n_oned_pts;
+            const unsigned int line_start = iquad - inode*stride;
+            for (unsigned int jnode=0; jnode<n_oned_pts; ++jnode) {
+                const double oned_derivative_ij = oned_derivative(inode,jnode);
+                const unsigned int flux_basis = line_start + jnode*stride;
+                const std::array<dealii::Tensor<1,dim,real>,nstate> split_flux = physics.convective_numerical_split_flux(soln_at_q[iquad],soln_at_q[flux_basis]);
+                for (int istate = 0; istate<nstate; ++istate) {
+                    for (int e=0; e<dim; ++e) {
+                        flux_divergence[iquad][istate] += 2.0 * oned_derivative_ij * inverse_jacobian[d][e] * split_flux[istate][e];
+                    }
+                }
+            }
+            stride *= n_oned_pts;
+        }
+    }
+}
+
+} // PHiLiP namespace
+
+#endif
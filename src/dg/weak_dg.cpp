@@ -13,9 +13,15 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <algorithm>
+#include <type_traits>
+
 #include "ADTypes.hpp"
 
 #include "weak_dg.hpp"
+#include "residual_kernel_dispatch.hpp"
+#include "physics/physics_dispatch.h"
+#include "numerical_flux/numerical_flux_dispatch.hpp"
 
 #define KOPRIVA_METRICS_VOL
 #define KOPRIVA_METRICS_FACE
@@ -149,7 +155,12 @@ DGWeak<dim,nstate,real,MeshType>::DGWeak(
     const unsigned int grid_degree_input,
     const std::shared_ptr<Triangulation> triangulation_input)
     : DGBaseState<dim,nstate,real,MeshType>::DGBaseState(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
-{ }
+{
+    if (this->all_parameters->use_analytic_flux_jacobians && !analytic_flux_jacobians_available()) {
+        pcout << "Warning: the analytic flux Jacobians are only implemented for lax_friedrichs with the euler, advection, "
+              << "or advection_vector PDEs without artificial dissipation. dRdW is assembled with automatic differentiation." << std::endl;
+    }
+}
 // Destructor
 template <int dim, int nstate, typename real,typename MeshType>
 DGWeak<dim,nstate,real,MeshType>::~DGWeak ()
@@ -336,6 +347,41 @@ void evaluate_finite_element_gradients (
 }
 
 
+/// Returns the face quadrature projected onto the (sub)face of the reference cell.
+/** The face quadrature points are ordered consistently with the ones of the neighbouring cell.
+ */
+template <int dim>
+dealii::Quadrature<dim> project_face_quadrature (
+    const dealii::Quadrature<dim-1> &face_quadrature,
+    const std::pair<unsigned int, int> face_subface,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set)
+{
+    if constexpr (dim < 3) {
+        (void) face_data_set;
+        return face_subface.second == -1 ?
+               dealii::QProjector<dim>::project_to_face(dealii::ReferenceCell::get_hypercube(dim),
+                                                        face_quadrature,
+                                                        face_subface.first):
+               dealii::QProjector<dim>::project_to_subface(dealii::ReferenceCell::get_hypercube(dim),
+                                                        face_quadrature,
+                                                        face_subface.first,
+                                                        face_subface.second,
+                                                        dealii::RefinementCase<dim-1>::isotropic_refinement);
+    } else {
+        const dealii::Quadrature<dim> all_faces_quad = face_subface.second == -1 ?
+                                                       dealii::QProjector<dim>::project_to_all_faces (dealii::ReferenceCell::get_hypercube(dim), face_quadrature) :
+                                                       dealii::QProjector<dim>::project_to_all_subfaces (dealii::ReferenceCell::get_hypercube(dim), face_quadrature);
+        const unsigned int n_face_quad_pts = face_quadrature.size();
+        std::vector< dealii::Point< dim >> points(n_face_quad_pts);
+        std::vector< double > weights(n_face_quad_pts);
+        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
+            points[iquad] = all_faces_quad.point(iquad+face_data_set);
+            weights[iquad] = all_faces_quad.weight(iquad+face_data_set);
+        }
+        return dealii::Quadrature<dim>(points, weights);
+    }
+}
+
 template <int dim, typename real>
 std::vector<dealii::Tensor<2,dim,real>> evaluate_metric_jacobian (
     const std::vector<dealii::Point<dim>> &points,
@@ -1139,7 +1185,7 @@ void correct_the_gradient(
 }
 
 template <int dim, int nstate, typename real, typename MeshType>
-template <typename real2>
+template <typename real2, typename PhysicsType, typename ConvFluxType, typename DissFluxType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
     const dealii::types::global_dof_index current_cell_index,
@@ -1148,9 +1194,9 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
     const std::vector< real > &local_dual,
     const unsigned int face_number,
     const unsigned int boundary_id,
-    const Physics::PhysicsBase<dim, nstate, real2> &physics,
-    const NumericalFlux::NumericalFluxConvective<dim, nstate, real2> &conv_num_flux,
-    const NumericalFlux::NumericalFluxDissipative<dim, nstate, real2> &diss_num_flux,
+    const PhysicsType &physics,
+    const ConvFluxType &conv_num_flux,
+    const DissFluxType &diss_num_flux,
     const dealii::FEFaceValuesBase<dim,dim> &fe_values_boundary,
     const real penalty,
     const dealii::FESystem<dim,dim> &fe_soln,
@@ -1327,7 +1373,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
 
     for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
         const dealii::Tensor<1,dim,real2> normal_int = phys_unit_normal[iquad];
-        physics.boundary_face_values (boundary_id, real_quad_pts[iquad], normal_int, soln_int[iquad], soln_grad_int[iquad], soln_ext[iquad], soln_grad_ext[iquad]);
+        Physics::dispatch_boundary_face_values (physics, boundary_id, real_quad_pts[iquad], normal_int, soln_int[iquad], soln_grad_int[iquad], soln_ext[iquad], soln_grad_ext[iquad]);
     }
 
     // Assemble BR2 gradient correction right-hand side
@@ -1387,7 +1433,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
                     soln_grad_ext[iquad][istate][d] = soln_grad_int[iquad][istate][d];
                 }
             }
-            physics.boundary_face_values (boundary_id, real_quad_pts[iquad], phys_unit_normal[iquad], soln_int[iquad], soln_grad_int[iquad], soln_ext[iquad], soln_grad_ext[iquad]);
+            Physics::dispatch_boundary_face_values (physics, boundary_id, real_quad_pts[iquad], phys_unit_normal[iquad], soln_int[iquad], soln_grad_int[iquad], soln_ext[iquad], soln_grad_ext[iquad]);
         }
 
     } 
@@ -1442,9 +1488,9 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
         // This is known not be adjoint consistent as per the paper above. Page 85, second to last paragraph.
         // Losing 2p+1 OOA on functionals for all PDEs.
         //conv_num_flux_dot_n[iquad] = conv_num_flux.evaluate_flux(soln_int[iquad], soln_ext[iquad], normal_int);
-        conv_num_flux_dot_n[iquad] = conv_num_flux.evaluate_flux(soln_int[iquad], soln_ext[iquad], normal_int);
+        conv_num_flux_dot_n[iquad] = NumericalFlux::dispatch_evaluate_flux(conv_num_flux, physics, soln_int[iquad], soln_ext[iquad], normal_int);
         // Notice that the flux uses the solution given by the Dirichlet or Neumann boundary condition
-        diss_soln_num_flux[iquad] = diss_num_flux.evaluate_solution_flux(soln_ext[iquad], soln_ext[iquad], normal_int);
+        diss_soln_num_flux[iquad] = NumericalFlux::dispatch_evaluate_solution_flux(diss_num_flux, soln_ext[iquad], soln_ext[iquad], normal_int);
 
         ADArrayTensor1 diss_soln_jump_int;
         for (int s=0; s<nstate; s++) {
@@ -1452,7 +1498,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
                 diss_soln_jump_int[s][d] = (diss_soln_num_flux[iquad][s] - soln_int[iquad][s]) * normal_int[d];
             }
         }
-        diss_flux_jump_int[iquad] = physics.dissipative_flux (soln_int[iquad], diss_soln_jump_int);
+        diss_flux_jump_int[iquad] = Physics::dispatch_dissipative_flux (physics, soln_int[iquad], diss_soln_jump_int);
 
         if (this->all_parameters->artificial_dissipation_param.add_artificial_dissipation) {
             const ADArrayTensor1 artificial_diss_flux_jump_int = DGBaseState<dim,nstate,real,MeshType>::artificial_dissip->calc_artificial_dissipation_flux(soln_int[iquad], diss_soln_jump_int,artificial_diss_coeff_at_q[iquad]);
@@ -1461,7 +1507,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term(
             }
         }
 
-        diss_auxi_num_flux_dot_n[iquad] = diss_num_flux.evaluate_auxiliary_flux(
+        diss_auxi_num_flux_dot_n[iquad] = NumericalFlux::dispatch_evaluate_auxiliary_flux(
+            diss_num_flux, physics,
             //artificial_diss_coeff,
             //artificial_diss_coeff,
             artificial_diss_coeff_at_q[iquad],
@@ -1650,6 +1697,51 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
 }
 #endif
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::add_codi_taped_d2R_vmult(
+    codi::TapeHelper<codi_HessianComputationType> &th,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices)
+{
+    using TH = codi::TapeHelper<codi_HessianComputationType>;
+
+    const unsigned int n_soln_dofs = soln_dof_indices.size();
+    const unsigned int n_metric_dofs = metric_dof_indices.size();
+
+    typename TH::Real* x = th.createPrimalVectorInput();
+    typename TH::Real* y = th.createPrimalVectorOutput();
+    typename TH::GradientValue* x_b = th.createGradientVectorInput();
+    typename TH::GradientValue* y_b = th.createGradientVectorOutput();
+
+    // Forward-over-reverse: the primal re-evaluation carries the direction as its tangent,
+    // and the reverse sweep of the dual-weighted residual returns the Hessian-vector product.
+    // Only the first of the dimForwardAD tangent lanes is needed for a single direction.
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        x[idof] = this->solution(soln_dof_indices[idof]);
+        x[idof].gradient()[0] = (*this->d2R_direction_w)(soln_dof_indices[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        x[n_soln_dofs+idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+        x[n_soln_dofs+idof].gradient()[0] = (*this->d2R_direction_x)(metric_dof_indices[idof]);
+    }
+    y_b[0][0] = 1.0;
+
+    th.evalPrimal(x, y);
+    th.evalReverse(y_b, x_b);
+
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        (*this->d2R_product_w)(soln_dof_indices[idof]) += x_b[idof][0].getGradient()[0];
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        (*this->d2R_product_x)(metric_dof_indices[idof]) += x_b[n_soln_dofs+idof][0].getGradient()[0];
+    }
+
+    th.deletePrimalVector(x);
+    th.deletePrimalVector(y);
+    th.deleteGradientVector(x_b);
+    th.deleteGradientVector(y_b);
+}
+
 template <int dim, int nstate, typename real, typename MeshType>
 template <typename adtype>
 void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
@@ -1788,7 +1880,11 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_codi_taped_derivatives(
     }
 
 
-    if (compute_d2R) {
+    if (compute_d2R && this->d2R_product_w) {
+        if constexpr (std::is_same<adtype, codi_HessianComputationType>::value) {
+            add_codi_taped_d2R_vmult(th, soln_dof_indices, metric_dof_indices);
+        }
+    } else if (compute_d2R) {
         typename TH::HessianType& hes = th.createHessian();
         th.evalHessian(hes);
 
@@ -1885,25 +1981,28 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_residual(
 
     std::vector<real> rhs(n_soln_dofs);
     real dual_dot_residual;
-    assemble_boundary_term(
-        cell,
-        current_cell_index,
-        soln_coeff,
-        coords_coeff,
-        local_dual,
-        face_number,
-        boundary_id,
-        physics,
-        conv_num_flux,
-        diss_num_flux,
-        fe_values_boundary,
-        penalty,
-        fe_soln,
-        fe_metric,
-        quadrature,
-        rhs,
-        dual_dot_residual,
-        compute_metric_derivatives);
+    dispatch_face_kernel(physics, conv_num_flux, diss_num_flux,
+        [&](const auto &physics_type, const auto &conv_num_flux_type, const auto &diss_num_flux_type) {
+        this->assemble_boundary_term(
+            cell,
+            current_cell_index,
+            soln_coeff,
+            coords_coeff,
+            local_dual,
+            face_number,
+            boundary_id,
+            physics_type,
+            conv_num_flux_type,
+            diss_num_flux_type,
+            fe_values_boundary,
+            penalty,
+            fe_soln,
+            fe_metric,
+            quadrature,
+            rhs,
+            dual_dot_residual,
+            compute_metric_derivatives);
+    });
 
     for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
         local_rhs_cell(itest) += getValue<real>(rhs[itest]);
@@ -1986,7 +2085,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_boundary_term_derivatives(
 
 
 template <int dim, int nstate, typename real, typename MeshType>
-template <typename real2>
+template <typename real2, typename PhysicsType, typename ConvFluxType, typename DissFluxType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
     const dealii::types::global_dof_index current_cell_index,
@@ -2001,9 +2100,9 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
     const std::pair<unsigned int, int> face_subface_ext,
     const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
     const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
-    const Physics::PhysicsBase<dim, nstate, real2> &physics,
-    const NumericalFlux::NumericalFluxConvective<dim, nstate, real2> &conv_num_flux,
-    const NumericalFlux::NumericalFluxDissipative<dim, nstate, real2> &diss_num_flux,
+    const PhysicsType &physics,
+    const ConvFluxType &conv_num_flux,
+    const DissFluxType &diss_num_flux,
     const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
     const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
     const real penalty,
@@ -2014,7 +2113,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
     std::vector<real2> &rhs_int,
     std::vector<real2> &rhs_ext,
     real2 &dual_dot_residual,
-    const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R)
+    const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R,
+    const double *const soln_ext_trace)
 {
     (void) compute_dRdW;
     const unsigned int n_soln_dofs_int = fe_int.dofs_per_cell;
@@ -2034,48 +2134,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
     using Tensor2D = dealii::Tensor<2,dim,real2>;
     using ADArrayTensor1 = std::array< Tensor1D, nstate >;
 
-    (void) face_data_set_int; (void) face_data_set_ext;
-    dealii::Quadrature<dim> face_quadrature_int, face_quadrature_ext;
-    if constexpr (dim < 3) {
-        face_quadrature_int = face_subface_int.second == -1 ?
-                              dealii::QProjector<dim>::project_to_face(dealii::ReferenceCell::get_hypercube(dim),
-                                                                       face_quadrature,
-                                                                       face_subface_int.first):
-                              dealii::QProjector<dim>::project_to_subface(dealii::ReferenceCell::get_hypercube(dim),
-                                                                       face_quadrature,
-                                                                       face_subface_int.first,
-                                                                       face_subface_int.second,
-                                                                       dealii::RefinementCase<dim-1>::isotropic_refinement);
-        face_quadrature_ext = face_subface_ext.second == -1 ?
-                              dealii::QProjector<dim>::project_to_face(dealii::ReferenceCell::get_hypercube(dim),
-                                                                       face_quadrature,
-                                                                       face_subface_ext.first):
-                              dealii::QProjector<dim>::project_to_subface(dealii::ReferenceCell::get_hypercube(dim),
-                                                                       face_quadrature,
-                                                                       face_subface_ext.first,
-                                                                       face_subface_ext.second,
-                                                                       dealii::RefinementCase<dim-1>::isotropic_refinement);
-    } else {
-        const dealii::Quadrature<dim> all_faces_quad_int = face_subface_int.second == -1 ?
-                                                           dealii::QProjector<dim>::project_to_all_faces (dealii::ReferenceCell::get_hypercube(dim), face_quadrature) :
-                                                           dealii::QProjector<dim>::project_to_all_subfaces (dealii::ReferenceCell::get_hypercube(dim), face_quadrature);
-        const dealii::Quadrature<dim> all_faces_quad_ext = face_subface_ext.second == -1 ?
-                                                           dealii::QProjector<dim>::project_to_all_faces (dealii::ReferenceCell::get_hypercube(dim), face_quadrature) :
-                                                           dealii::QProjector<dim>::project_to_all_subfaces (dealii::ReferenceCell::get_hypercube(dim), face_quadrature);
-        std::vector< dealii::Point< dim >> points(n_face_quad_pts);
-        std::vector< double > weights(n_face_quad_pts);
-        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
-            points[iquad] = all_faces_quad_int.point(iquad+face_data_set_int);
-            weights[iquad] = all_faces_quad_int.weight(iquad+face_data_set_int);
-        }
-        face_quadrature_int = dealii::Quadrature<dim>(points, weights);
-
-        for (unsigned int iquad = 0; iquad < n_face_quad_pts; ++iquad) {
-            points[iquad] = all_faces_quad_ext.point(iquad+face_data_set_ext);
-            weights[iquad] = all_faces_quad_ext.weight(iquad+face_data_set_ext);
-        }
-        face_quadrature_ext = dealii::Quadrature<dim>(points, weights);
-    }
+    const dealii::Quadrature<dim> face_quadrature_int = project_face_quadrature<dim>(face_quadrature, face_subface_int, face_data_set_int);
+    const dealii::Quadrature<dim> face_quadrature_ext = project_face_quadrature<dim>(face_quadrature, face_subface_ext, face_data_set_ext);
 
 
     (void) compute_dRdW; (void) compute_dRdX; (void) compute_d2R;
@@ -2359,7 +2419,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
     // Interpolate solution
     std::vector<ADArray> soln_int(n_face_quad_pts), soln_ext(n_face_quad_pts);
     evaluate_finite_element_values<dim, real2, nstate> (unit_quad_pts_int, soln_coeff_int, fe_int, soln_int);
-    evaluate_finite_element_values<dim, real2, nstate> (unit_quad_pts_ext, soln_coeff_ext, fe_ext, soln_ext);
+    if (!soln_ext_trace) evaluate_finite_element_values<dim, real2, nstate> (unit_quad_pts_ext, soln_coeff_ext, fe_ext, soln_ext);
 
     // Interpolate solution gradient
     std::vector<ADArrayTensor1> soln_grad_int(n_face_quad_pts), soln_grad_ext(n_face_quad_pts);
@@ -2376,6 +2436,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
                 soln_grad_int[iquad][istate][d] += soln_coeff_int[idof] * gradient_operator_int[d][idof][iquad];
             }
         }
+        if (soln_ext_trace) continue;
         for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) {
             const unsigned int istate = fe_ext.system_to_component_index(idof).first;
             for (int d=0;d<dim;++d) {
@@ -2384,6 +2445,23 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
         }
     }
 
+    // The neighbouring processor evaluated the exterior solution and its gradient, see evaluate_face_trace().
+    // Without dissipative terms, only the values are sent and the exterior gradient is left at zero.
+    if (soln_ext_trace) {
+        const unsigned int n_trace_values = this->n_face_trace_values_per_point();
+        const bool trace_includes_gradients = this->face_trace_includes_gradients();
+        for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+            const double *const trace_at_q = soln_ext_trace + iquad*n_trace_values;
+            for (int istate=0; istate<nstate; istate++) {
+                soln_ext[iquad][istate] = trace_at_q[istate];
+                if (!trace_includes_gradients) continue;
+                for (int d=0;d<dim;++d) {
+                    soln_grad_ext[iquad][istate][d] = trace_at_q[nstate + istate*dim + d];
+                }
+            }
+        }
+    }
+
     // Assemble BR2 gradient correction right-hand side
 
     using DissFlux = Parameters::AllParameters::DissipativeNumericalFlux;
@@ -2466,8 +2544,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
     for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
 
         // Evaluate physical convective flux, physical dissipative flux, and source term
-        conv_num_flux_dot_n = conv_num_flux.evaluate_flux(soln_int[iquad], soln_ext[iquad], phys_unit_normal_int[iquad]);
-        diss_soln_num_flux = diss_num_flux.evaluate_solution_flux(soln_int[iquad], soln_ext[iquad], phys_unit_normal_int[iquad]);
+        conv_num_flux_dot_n = NumericalFlux::dispatch_evaluate_flux(conv_num_flux, physics, soln_int[iquad], soln_ext[iquad], phys_unit_normal_int[iquad]);
+        diss_soln_num_flux = NumericalFlux::dispatch_evaluate_solution_flux(diss_num_flux, soln_int[iquad], soln_ext[iquad], phys_unit_normal_int[iquad]);
 
         ADArrayTensor1 diss_soln_jump_int, diss_soln_jump_ext;
         for (int s=0; s<nstate; s++) {
@@ -2476,8 +2554,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
                 diss_soln_jump_ext[s][d] = (diss_soln_num_flux[s] - soln_ext[iquad][s]) * phys_unit_normal_ext[iquad][d];
             }
         }
-        diss_flux_jump_int = physics.dissipative_flux (soln_int[iquad], diss_soln_jump_int);
-        diss_flux_jump_ext = physics.dissipative_flux (soln_ext[iquad], diss_soln_jump_ext);
+        diss_flux_jump_int = Physics::dispatch_dissipative_flux (physics, soln_int[iquad], diss_soln_jump_int);
+        diss_flux_jump_ext = Physics::dispatch_dissipative_flux (physics, soln_ext[iquad], diss_soln_jump_ext);
 
         if (this->all_parameters->artificial_dissipation_param.add_artificial_dissipation) {
             //const ADArrayTensor1 artificial_diss_flux_jump_int = physics.artificial_dissipative_flux (artificial_diss_coeff_int, soln_int[iquad], diss_soln_jump_int);
@@ -2491,7 +2569,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
         }
 
 
-        diss_auxi_num_flux_dot_n = diss_num_flux.evaluate_auxiliary_flux(
+        diss_auxi_num_flux_dot_n = NumericalFlux::dispatch_evaluate_auxiliary_flux(
+            diss_num_flux, physics,
             //artificial_diss_coeff_int,
             //artificial_diss_coeff_ext,
             artificial_diss_coeff_at_q[iquad],
@@ -2539,6 +2618,179 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term(
 
 }
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::evaluate_face_trace(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const unsigned int face_number,
+    const dealii::Quadrature<dim-1> &face_quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    double *const face_trace)
+{
+    using Tensor1D = dealii::Tensor<1,dim,real>;
+    using Tensor2D = dealii::Tensor<2,dim,real>;
+
+    const dealii::FESystem<dim,dim> &fe_soln = this->fe_collection[cell->active_fe_index()];
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_soln_dofs = fe_soln.dofs_per_cell;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_face_quad_pts = face_quadrature.size();
+
+    AssertDimension (n_soln_dofs, soln_dof_indices.size());
+
+    std::vector< real > soln_coeff(n_soln_dofs);
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        soln_coeff[idof] = this->solution(soln_dof_indices[idof]);
+    }
+    std::vector< real > coords_coeff(n_metric_dofs);
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        coords_coeff[idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+    }
+
+    // Quadrature points ordered as the exterior side of assemble_face_term() on the neighbouring processor.
+    const auto face_data_set = dealii::QProjector<dim>::DataSetDescriptor::face (
+                                                                              dealii::ReferenceCell::get_hypercube(dim),
+                                                                              face_number,
+                                                                              cell->face_orientation(face_number),
+                                                                              cell->face_flip(face_number),
+                                                                              cell->face_rotation(face_number),
+                                                                              n_face_quad_pts);
+    const dealii::Quadrature<dim> projected_face_quadrature = project_face_quadrature<dim>(face_quadrature, std::make_pair(face_number, -1), face_data_set);
+    const std::vector<dealii::Point<dim,double>> &unit_quad_pts = projected_face_quadrature.get_points();
+
+    const std::vector<Tensor2D> metric_jac = evaluate_metric_jacobian (unit_quad_pts, coords_coeff, fe_metric);
+    std::vector<real> jacobian_determinant(n_face_quad_pts);
+    std::vector<Tensor2D> jacobian_transpose_inverse(n_face_quad_pts);
+    for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+        jacobian_determinant[iquad] = dealii::determinant(metric_jac[iquad]);
+        jacobian_transpose_inverse[iquad] = dealii::transpose(dealii::invert(metric_jac[iquad]));
+    }
+#ifdef KOPRIVA_METRICS_FACE
+    if constexpr (dim != 1) {
+        evaluate_covariant_metric_jacobian<dim,real> ( projected_face_quadrature, coords_coeff, fe_metric, jacobian_transpose_inverse, jacobian_determinant);
+    }
+#endif
+
+    std::vector< std::array<real,nstate> > soln_at_q(n_face_quad_pts);
+    evaluate_finite_element_values<dim, real, nstate> (unit_quad_pts, soln_coeff, fe_soln, soln_at_q);
+
+    const unsigned int n_trace_values = this->n_face_trace_values_per_point();
+    const bool trace_includes_gradients = this->face_trace_includes_gradients();
+    for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+        double *const trace_at_q = face_trace + iquad*n_trace_values;
+        for (int istate=0; istate<nstate; istate++) {
+            trace_at_q[istate] = soln_at_q[iquad][istate];
+        }
+        if (!trace_includes_gradients) continue;
+
+        std::array<Tensor1D,nstate> soln_grad_at_q;
+        for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+            const unsigned int istate = fe_soln.system_to_component_index(idof).first;
+            const dealii::Tensor<1,dim,real> ref_shape_grad = fe_soln.shape_grad(idof, unit_quad_pts[iquad]);
+            const Tensor1D phys_shape_grad = vmult(jacobian_transpose_inverse[iquad], ref_shape_grad);
+            for (int d=0;d<dim;++d) {
+                soln_grad_at_q[istate][d] += soln_coeff[idof] * phys_shape_grad[d];
+            }
+        }
+
+        for (int istate=0; istate<nstate; istate++) {
+            for (int d=0;d<dim;++d) {
+                trace_at_q[nstate + istate*dim + d] = soln_grad_at_q[istate][d];
+            }
+        }
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_from_trace(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::types::global_dof_index neighbor_cell_index,
+    const std::pair<unsigned int, int> face_subface_int,
+    const std::pair<unsigned int, int> face_subface_ext,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+    const real penalty,
+    const dealii::FESystem<dim,dim> &fe_int,
+    const dealii::FESystem<dim,dim> &fe_ext,
+    const dealii::Quadrature<dim-1> &face_quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+    const double *const neighbor_face_trace,
+    dealii::Vector<real>          &local_rhs_int_cell)
+{
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs_int = fe_int.dofs_per_cell;
+    const unsigned int n_soln_dofs_ext = fe_ext.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs_int, soln_dof_indices_int.size());
+
+    std::vector< real > soln_coeff_int(n_soln_dofs_int);
+    for (unsigned int idof = 0; idof < n_soln_dofs_int; ++idof) {
+        soln_coeff_int[idof] = this->solution(soln_dof_indices_int[idof]);
+    }
+    // The neighbour's solution is only known through its face trace.
+    const std::vector< real > soln_coeff_ext(n_soln_dofs_ext, 0.0);
+
+    std::vector< real > coords_coeff_int(n_metric_dofs);
+    std::vector< real > coords_coeff_ext(n_metric_dofs);
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        coords_coeff_int[idof] = this->high_order_grid->volume_nodes[metric_dof_indices_int[idof]];
+        coords_coeff_ext[idof] = this->high_order_grid->volume_nodes[metric_dof_indices_ext[idof]];
+    }
+
+    // The dual is only used by the second derivatives.
+    const std::vector<double> dual_int(n_soln_dofs_int, 0.0);
+    const std::vector<double> dual_ext(n_soln_dofs_ext, 0.0);
+
+    std::vector<real> rhs_int(n_soln_dofs_int);
+    std::vector<real> rhs_ext(n_soln_dofs_ext);
+    real dual_dot_residual;
+
+    const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = false;
+    dispatch_face_kernel(*(this->pde_physics_double), *(this->conv_num_flux_double), *(this->diss_num_flux_double),
+        [&](const auto &physics_type, const auto &conv_num_flux_type, const auto &diss_num_flux_type) {
+        this->assemble_face_term(
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            soln_coeff_int,
+            soln_coeff_ext,
+            coords_coeff_int,
+            coords_coeff_ext,
+            dual_int,
+            dual_ext,
+            face_subface_int,
+            face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            physics_type,
+            conv_num_flux_type,
+            diss_num_flux_type,
+            fe_values_int,
+            fe_values_ext,
+            penalty,
+            fe_int,
+            fe_ext,
+            fe_metric,
+            face_quadrature,
+            rhs_int,
+            rhs_ext,
+            dual_dot_residual,
+            compute_dRdW, compute_dRdX, compute_d2R,
+            neighbor_face_trace);
+    });
+
+    // The neighbouring processor assembles its own side of the face.
+    for (unsigned int itest_int=0; itest_int<n_soln_dofs_int; ++itest_int) {
+        local_rhs_int_cell[itest_int] += rhs_int[itest_int];
+    }
+}
+
 #ifdef FADFAD
 template <int dim, int nstate, typename real, typename MeshType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
@@ -3141,7 +3393,16 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_codi_taped_derivatives(
         th.deleteJacobian(jac);
     }
 
-    if (compute_d2R) {
+    if (compute_d2R && this->d2R_product_w) {
+        if constexpr (std::is_same<adtype, codi_HessianComputationType>::value) {
+            // Same ordering as the registered inputs: soln_int, soln_ext, metric_int, metric_ext
+            std::vector<dealii::types::global_dof_index> soln_dof_indices(soln_dof_indices_int);
+            soln_dof_indices.insert(soln_dof_indices.end(), soln_dof_indices_ext.begin(), soln_dof_indices_ext.end());
+            std::vector<dealii::types::global_dof_index> metric_dof_indices(metric_dof_indices_int);
+            metric_dof_indices.insert(metric_dof_indices.end(), metric_dof_indices_ext.begin(), metric_dof_indices_ext.end());
+            add_codi_taped_d2R_vmult(th, soln_dof_indices, metric_dof_indices);
+        }
+    } else if (compute_d2R) {
         typename TH::HessianType& hes = th.createHessian();
         th.evalHessian(hes);
 
@@ -3349,34 +3610,37 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_residual(
     std::vector<real> rhs_ext(n_soln_dofs_ext);
     real dual_dot_residual;
 
-    assemble_face_term(
-        cell,
-        current_cell_index,
-        neighbor_cell_index,
-        soln_coeff_int,
-        soln_coeff_ext,
-        coords_coeff_int,
-        coords_coeff_ext,
-        dual_int,
-        dual_ext,
-        face_subface_int,
-        face_subface_ext,
-        face_data_set_int,
-        face_data_set_ext,
-        physics,
-        conv_num_flux,
-        diss_num_flux,
-        fe_values_int,
-        fe_values_ext,
-        penalty,
-        fe_int,
-        fe_ext,
-        fe_metric,
-        face_quadrature,
-        rhs_int,
-        rhs_ext,
-        dual_dot_residual,
-        compute_dRdW, compute_dRdX, compute_d2R);
+    dispatch_face_kernel(physics, conv_num_flux, diss_num_flux,
+        [&](const auto &physics_type, const auto &conv_num_flux_type, const auto &diss_num_flux_type) {
+        this->assemble_face_term(
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            soln_coeff_int,
+            soln_coeff_ext,
+            coords_coeff_int,
+            coords_coeff_ext,
+            dual_int,
+            dual_ext,
+            face_subface_int,
+            face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            physics_type,
+            conv_num_flux_type,
+            diss_num_flux_type,
+            fe_values_int,
+            fe_values_ext,
+            penalty,
+            fe_int,
+            fe_ext,
+            fe_metric,
+            face_quadrature,
+            rhs_int,
+            rhs_ext,
+            dual_dot_residual,
+            compute_dRdW, compute_dRdX, compute_d2R);
+    });
 
     for (unsigned int itest_int=0; itest_int<n_soln_dofs_int; ++itest_int) {
         local_rhs_int_cell[itest_int] += getValue<real>(rhs_int[itest_int]);
@@ -3389,14 +3653,14 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_residual(
 #endif
 
 template <int dim, int nstate, typename real, typename MeshType>
-template <typename real2>
+template <typename real2, typename PhysicsType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
     const dealii::types::global_dof_index current_cell_index,
     const std::vector<real2> &soln_coeff, const std::vector<real2> &coords_coeff, const std::vector<real> &local_dual,
     const dealii::FESystem<dim,dim> &fe_soln, const dealii::FESystem<dim,dim> &fe_metric,
     const dealii::Quadrature<dim> &quadrature,
-    const Physics::PhysicsBase<dim, nstate, real2> &physics,
+    const PhysicsType &physics,
     std::vector<real2> &rhs, real2 &dual_dot_residual,
     const bool compute_metric_derivatives,
     const dealii::FEValues<dim,dim> &fe_values_vol)
@@ -3615,8 +3879,8 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term(
                 soln_grad_at_q[iquad][istate][d] += soln_coeff[idof] * gradient_operator[d][idof][iquad];
             }
         }
-        conv_phys_flux_at_q[iquad] = physics.convective_flux (soln_at_q[iquad]);
-        diss_phys_flux_at_q[iquad] = physics.dissipative_flux (soln_at_q[iquad], soln_grad_at_q[iquad]);
+        conv_phys_flux_at_q[iquad] = Physics::dispatch_convective_flux (physics, soln_at_q[iquad]);
+        diss_phys_flux_at_q[iquad] = Physics::dispatch_dissipative_flux (physics, soln_at_q[iquad], soln_grad_at_q[iquad]);
 
         if (this->all_parameters->artificial_dissipation_param.add_artificial_dissipation) {
             ArrayTensor artificial_diss_phys_flux_at_q;
@@ -3634,7 +3898,7 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term(
                 const int iaxis = fe_metric.system_to_component_index(idof).first;
                 ad_point[iaxis] += coords_coeff[idof] * fe_metric.shape_value(idof,unit_quad_pts[iquad]);
             }
-            source_at_q[iquad] = physics.source_term (ad_point, soln_at_q[iquad]);
+            source_at_q[iquad] = Physics::dispatch_source_term (physics, ad_point, soln_at_q[iquad]);
             //Array artificial_source_at_q = physics.artificial_source_term (artificial_diss_coeff, ad_point, soln_at_q[iquad]);
             //Array artificial_source_at_q = physics.artificial_source_term (artificial_diss_coeff_at_q[iquad], ad_point, soln_at_q[iquad]);
             //for (int s=0;s<nstate;++s) source_at_q[iquad][s] += artificial_source_at_q[s];
@@ -3968,7 +4232,11 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
     }
 
 
-    if (compute_d2R) {
+    if (compute_d2R && this->d2R_product_w) {
+        if constexpr (std::is_same<adtype, codi_HessianComputationType>::value) {
+            add_codi_taped_d2R_vmult(th, soln_dof_indices, metric_dof_indices);
+        }
+    } else if (compute_d2R) {
         typename TH::HessianType& hes = th.createHessian();
         th.evalHessian(hes);
 
@@ -4018,6 +4286,152 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_taped_derivatives(
 
 }
 
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_volume_codi_cached_hessian(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::FEValues<dim,dim> &fe_values_vol,
+    const dealii::FESystem<dim,dim> &fe_soln,
+    const dealii::Quadrature<dim> &quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    dealii::Vector<real> &local_rhs_cell,
+    const Physics::PhysicsBase<dim, nstate, codi_HessianComputationType> &physics)
+{
+    using adtype = codi_HessianComputationType;
+    using TH = codi::TapeHelper<adtype>;
+
+    const unsigned int n_soln_dofs = fe_soln.dofs_per_cell;
+
+    AssertDimension (n_soln_dofs, soln_dof_indices.size());
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_inputs = n_soln_dofs + n_metric_dofs;
+
+    // Derivatives are ordered such that w comes first, then x.
+    const unsigned int w_start = 0;
+    const unsigned int x_start = n_soln_dofs;
+
+    const std::array<unsigned int,3> element_key = {{ n_soln_dofs, n_metric_dofs, quadrature.size() }};
+    VolumeHessianTape &cached = volume_hessian_tapes[element_key];
+    if (!cached.tape) cached.tape = std::make_unique<typename adtype::TapeType>();
+
+    // The TapeHelper operates on the global tape.
+    adtype::getGlobalTape().swap(*cached.tape);
+
+    if (!cached.tape_helper) {
+        cached.tape_helper = std::make_unique<TH>();
+        TH &th = *(cached.tape_helper);
+
+        std::vector<adtype> coords_coeff(n_metric_dofs);
+        std::vector<adtype> soln_coeff(n_soln_dofs);
+        // The dual only enters through the output adjoints.
+        const std::vector<real> zero_dual(n_soln_dofs, 0.0);
+
+        th.startRecording();
+        for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+            soln_coeff[idof] = this->solution(soln_dof_indices[idof]);
+            th.registerInput(soln_coeff[idof]);
+        }
+        for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+            coords_coeff[idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+            th.registerInput(coords_coeff[idof]);
+        }
+
+        const bool compute_metric_derivatives = true;
+        adtype dual_dot_residual = 0.0;
+        std::vector<adtype> rhs(n_soln_dofs);
+        assemble_volume_term<adtype>(
+            cell,
+            current_cell_index,
+            soln_coeff, coords_coeff, zero_dual,
+            fe_soln, fe_metric, quadrature,
+            physics,
+            rhs, dual_dot_residual,
+            compute_metric_derivatives, fe_values_vol);
+
+        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+            th.registerOutput(rhs[itest]);
+        }
+        th.stopRecording();
+
+        for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+            adtype::getGlobalTape().deactivateValue(soln_coeff[idof]);
+        }
+        for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+            adtype::getGlobalTape().deactivateValue(coords_coeff[idof]);
+        }
+    }
+    TH &th = *(cached.tape_helper);
+
+    typename TH::Real* x = th.createPrimalVectorInput();
+    typename TH::Real* y = th.createPrimalVectorOutput();
+    typename TH::GradientValue* x_b = th.createGradientVectorInput();
+    typename TH::GradientValue* y_b = th.createGradientVectorOutput();
+
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        x[w_start+idof] = this->solution(soln_dof_indices[idof]);
+        y_b[idof][0] = this->dual[soln_dof_indices[idof]];
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        x[x_start+idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+    }
+
+    // Forward-over-reverse: the primal re-evaluation carries dimForwardAD tangent directions,
+    // and the reverse sweep seeded with the dual returns as many columns of the dual-weighted Hessian.
+    dealii::FullMatrix<real> hessian(n_inputs, n_inputs);
+    for (unsigned int j_start = 0; j_start < n_inputs; j_start += dimForwardAD) {
+        const unsigned int n_lanes = std::min<unsigned int>(dimForwardAD, n_inputs - j_start);
+        for (unsigned int lane = 0; lane < n_lanes; ++lane) {
+            x[j_start+lane].gradient()[lane] = 1.0;
+        }
+        th.evalPrimal(x, y);
+        th.evalReverse(y_b, x_b);
+        for (unsigned int lane = 0; lane < n_lanes; ++lane) {
+            for (unsigned int i_dx = 0; i_dx < n_inputs; ++i_dx) {
+                hessian[i_dx][j_start+lane] = x_b[i_dx][0].getGradient()[lane];
+            }
+            x[j_start+lane].gradient()[lane] = 0.0;
+        }
+    }
+
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_rhs_cell(itest) += y[itest].getValue();
+        AssertIsFinite(local_rhs_cell(itest));
+    }
+
+    std::vector<real> dWidW(n_soln_dofs);
+    std::vector<real> dWidX(n_metric_dofs);
+    std::vector<real> dXidX(n_metric_dofs);
+    for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+        const unsigned int i_dx = idof+w_start;
+        for (unsigned int jdof=0; jdof<n_soln_dofs; ++jdof) {
+            dWidW[jdof] = hessian[i_dx][jdof+w_start];
+        }
+        this->d2RdWdW.add(soln_dof_indices[idof], soln_dof_indices, dWidW);
+
+        for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
+            dWidX[jdof] = hessian[i_dx][jdof+x_start];
+        }
+        this->d2RdWdX.add(soln_dof_indices[idof], metric_dof_indices, dWidX);
+    }
+    for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
+        const unsigned int i_dx = idof+x_start;
+        for (unsigned int jdof=0; jdof<n_metric_dofs; ++jdof) {
+            dXidX[jdof] = hessian[i_dx][jdof+x_start];
+        }
+        this->d2RdXdX.add(metric_dof_indices[idof], metric_dof_indices, dXidX);
+    }
+
+    th.deletePrimalVector(x);
+    th.deletePrimalVector(y);
+    th.deleteGradientVector(x_b);
+    th.deleteGradientVector(y_b);
+
+    adtype::getGlobalTape().swap(*cached.tape);
+}
+
 template <int dim, int nstate, typename real, typename MeshType>
 void DGWeak<dim,nstate,real,MeshType>::assemble_volume_residual(
     typename dealii::DoFHandler<dim>::active_cell_iterator cell,
@@ -4066,18 +4480,338 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_residual(
 
     double dual_dot_residual = 0.0;
     std::vector<double> rhs(n_soln_dofs);
-    assemble_volume_term<double>(
+    dispatch_volume_kernel(physics, [&](const auto &physics_type) {
+        this->template assemble_volume_term<double>(
+            cell,
+            current_cell_index,
+            soln_coeff, coords_coeff, local_dual,
+            fe_soln, fe_metric, quadrature,
+            physics_type,
+            rhs, dual_dot_residual,
+            compute_metric_derivatives, fe_values_vol);
+    });
+
+    for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+        local_rhs_cell(itest) += getValue<double>(rhs[itest]);
+        AssertIsFinite(local_rhs_cell(itest));
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+bool DGWeak<dim,nstate,real,MeshType>::use_analytic_flux_jacobians (
+    const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R) const
+{
+    if (!this->all_parameters->use_analytic_flux_jacobians) return false;
+    if (!compute_dRdW || compute_dRdX || compute_d2R) return false;
+    return analytic_flux_jacobians_available();
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+bool DGWeak<dim,nstate,real,MeshType>::analytic_flux_jacobians_available () const
+{
+    // The Roe-Pike and L2Roe fluxes (entropy fix and low-Mach blending) and the SIPG/BR2 dissipative
+    // terms do not have a hand-derived Jacobian yet.
+    if (this->all_parameters->artificial_dissipation_param.add_artificial_dissipation) return false;
+
+    using PDE_enum = Parameters::AllParameters::PartialDifferentialEquation;
+    using ConvFlux_enum = Parameters::AllParameters::ConvectiveNumericalFlux;
+    const PDE_enum pde_type = this->all_parameters->pde_type;
+    const bool inviscid = (pde_type == PDE_enum::euler
+                           || pde_type == PDE_enum::advection
+                           || pde_type == PDE_enum::advection_vector);
+    return inviscid && this->all_parameters->conv_num_flux_type == ConvFlux_enum::lax_friedrichs;
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_volume_analytic_jacobian(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::FEValues<dim,dim> &fe_values_vol,
+    const dealii::FESystem<dim,dim> &fe_soln,
+    const dealii::Quadrature<dim> &quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+    dealii::Vector<real> &local_rhs_cell,
+    const dealii::FEValues<dim,dim> &fe_values_lagrange)
+{
+    const Physics::PhysicsBase<dim,nstate,real> &physics = *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_double);
+
+    // The right-hand side is unchanged.
+    assemble_volume_residual(
         cell,
         current_cell_index,
-        soln_coeff, coords_coeff, local_dual,
-        fe_soln, fe_metric, quadrature,
+        fe_values_vol,
+        fe_soln, quadrature,
+        metric_dof_indices, soln_dof_indices,
+        local_rhs_cell,
+        fe_values_lagrange,
         physics,
-        rhs, dual_dot_residual,
-        compute_metric_derivatives, fe_values_vol);
+        false, false, false);
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs = fe_soln.dofs_per_cell;
+    const unsigned int n_quad_pts = quadrature.size();
 
+    std::vector<real> coords_coeff(n_metric_dofs);
+    std::vector<real> soln_coeff(n_soln_dofs);
+    for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
+        soln_coeff[idof] = this->solution(soln_dof_indices[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        coords_coeff[idof] = this->high_order_grid->volume_nodes[metric_dof_indices[idof]];
+    }
+
+    const std::vector<dealii::Point<dim>> &unit_quad_pts = quadrature.get_points();
+
+    // Same metric terms as assemble_volume_residual().
+    const std::vector<dealii::Tensor<2,dim,real>> metric_jacobian = evaluate_metric_jacobian (unit_quad_pts, coords_coeff, fe_metric);
+    std::vector<real> jac_det(n_quad_pts);
+    std::vector<dealii::Tensor<2,dim,real>> jac_inv_tran(n_quad_pts);
+    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+        jac_det[iquad] = dealii::determinant(metric_jacobian[iquad]);
+        jac_inv_tran[iquad] = dealii::transpose(dealii::invert(metric_jacobian[iquad]));
+    }
+#ifdef KOPRIVA_METRICS_VOL
+    if constexpr (dim != 1) {
+        evaluate_covariant_metric_jacobian<dim,real> ( quadrature, coords_coeff, fe_metric, jac_inv_tran, jac_det);
+    }
+#endif
+
+    std::vector<std::array<real,nstate>> soln_at_q(n_quad_pts);
+    evaluate_finite_element_values<dim, real, nstate> (unit_quad_pts, soln_coeff, fe_soln, soln_at_q);
+
+    // Basis tables
+    dealii::FullMatrix<real> interpolation_operator(n_soln_dofs, n_quad_pts);
+    std::vector<std::vector<dealii::Tensor<1,dim,real>>> phys_shape_grads(n_quad_pts, std::vector<dealii::Tensor<1,dim,real>>(n_soln_dofs));
+    std::vector<real> JxW(n_quad_pts);
+    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+        JxW[iquad] = jac_det[iquad] * quadrature.weight(iquad);
+        for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+            interpolation_operator[idof][iquad] = fe_soln.shape_value(idof, unit_quad_pts[iquad]);
+            phys_shape_grads[iquad][idof] = vmult(jac_inv_tran[iquad], fe_soln.shape_grad(idof, unit_quad_pts[iquad]));
+        }
+    }
+
+    // Cartesian flux Jacobians, since the directional Jacobian is linear in the direction.
+    std::array<dealii::Tensor<1,dim,real>,dim> unit_directions;
+    for (int d=0; d<dim; ++d) {
+        unit_directions[d][d] = 1.0;
+    }
+
+    dealii::FullMatrix<real> local_jacobian(n_soln_dofs, n_soln_dofs);
+    for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+        std::array<dealii::Tensor<2,nstate,real>,dim> conv_flux_jacobian;
+        for (int d=0; d<dim; ++d) {
+            conv_flux_jacobian[d] = physics.convective_flux_directional_jacobian(soln_at_q[iquad], unit_directions[d]);
+        }
+        for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
+            const unsigned int istate = fe_soln.system_to_component_index(itest).first;
+            const dealii::Tensor<1,dim,real> &test_grad = phys_shape_grads[iquad][itest];
+
+            std::array<real,nstate> dflux_dsoln;
+            for (int s=0; s<nstate; ++s) {
+                dflux_dsoln[s] = 0.0;
+                for (int d=0; d<dim; ++d) {
+                    dflux_dsoln[s] += test_grad[d] * conv_flux_jacobian[d][istate][s];
+                }
+                dflux_dsoln[s] *= JxW[iquad];
+            }
+            for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+                const unsigned int jstate = fe_soln.system_to_component_index(idof).first;
+                local_jacobian[itest][idof] += dflux_dsoln[jstate] * interpolation_operator[idof][iquad];
+            }
+        }
+    }
+
+    std::vector<real> residual_derivatives(n_soln_dofs);
     for (unsigned int itest=0; itest<n_soln_dofs; ++itest) {
-        local_rhs_cell(itest) += getValue<double>(rhs[itest]);
-        AssertIsFinite(local_rhs_cell(itest));
+        for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+            residual_derivatives[idof] = local_jacobian[itest][idof];
+            AssertIsFinite(residual_derivatives[idof]);
+        }
+        const bool elide_zero_values = false;
+        this->system_matrix.add(soln_dof_indices[itest], soln_dof_indices, residual_derivatives, elide_zero_values);
+    }
+}
+
+template <int dim, int nstate, typename real, typename MeshType>
+void DGWeak<dim,nstate,real,MeshType>::assemble_face_analytic_jacobian(
+    typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+    const dealii::types::global_dof_index current_cell_index,
+    const dealii::types::global_dof_index neighbor_cell_index,
+    const std::pair<unsigned int, int> face_subface_int,
+    const std::pair<unsigned int, int> face_subface_ext,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+    const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+    const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+    const real penalty,
+    const dealii::FESystem<dim,dim> &fe_int,
+    const dealii::FESystem<dim,dim> &fe_ext,
+    const dealii::Quadrature<dim-1> &face_quadrature,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+    const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
+    dealii::Vector<real>          &local_rhs_int_cell,
+    dealii::Vector<real>          &local_rhs_ext_cell)
+{
+    // The right-hand side is unchanged.
+    assemble_face_residual(
+        cell,
+        current_cell_index,
+        neighbor_cell_index,
+        face_subface_int,
+        face_subface_ext,
+        face_data_set_int,
+        face_data_set_ext,
+        fe_values_int,
+        fe_values_ext,
+        penalty,
+        fe_int,
+        fe_ext,
+        face_quadrature,
+        metric_dof_indices_int,
+        metric_dof_indices_ext,
+        soln_dof_indices_int,
+        soln_dof_indices_ext,
+        *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_double),
+        *(DGBaseState<dim,nstate,real,MeshType>::conv_num_flux_double),
+        *(DGBaseState<dim,nstate,real,MeshType>::diss_num_flux_double),
+        local_rhs_int_cell,
+        local_rhs_ext_cell,
+        false, false, false);
+
+    // Inviscid physics only, such that the dissipative terms vanish.
+    const NumericalFlux::NumericalFluxConvective<dim,nstate,real> &conv_num_flux = *(DGBaseState<dim,nstate,real,MeshType>::conv_num_flux_double);
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_soln_dofs_int = fe_int.dofs_per_cell;
+    const unsigned int n_soln_dofs_ext = fe_ext.dofs_per_cell;
+    const unsigned int n_face_quad_pts = face_quadrature.size();
+
+    std::vector<real> coords_coeff_int(n_metric_dofs), coords_coeff_ext(n_metric_dofs);
+    std::vector<real> soln_coeff_int(n_soln_dofs_int), soln_coeff_ext(n_soln_dofs_ext);
+    for (unsigned int idof = 0; idof < n_soln_dofs_int; ++idof) {
+        soln_coeff_int[idof] = this->solution(soln_dof_indices_int[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_soln_dofs_ext; ++idof) {
+        soln_coeff_ext[idof] = this->solution(soln_dof_indices_ext[idof]);
+    }
+    for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
+        coords_coeff_int[idof] = this->high_order_grid->volume_nodes[metric_dof_indices_int[idof]];
+        coords_coeff_ext[idof] = this->high_order_grid->volume_nodes[metric_dof_indices_ext[idof]];
+    }
+
+    const dealii::Quadrature<dim> face_quadrature_int = project_face_quadrature<dim>(face_quadrature, face_subface_int, face_data_set_int);
+    const dealii::Quadrature<dim> face_quadrature_ext = project_face_quadrature<dim>(face_quadrature, face_subface_ext, face_data_set_ext);
+    const std::vector<dealii::Point<dim>> &unit_quad_pts_int = face_quadrature_int.get_points();
+    const std::vector<dealii::Point<dim>> &unit_quad_pts_ext = face_quadrature_ext.get_points();
+
+    // Same metric terms as assemble_face_term().
+    const std::vector<dealii::Tensor<2,dim,real>> metric_jac_int = evaluate_metric_jacobian (unit_quad_pts_int, coords_coeff_int, fe_metric);
+    const std::vector<dealii::Tensor<2,dim,real>> metric_jac_ext = evaluate_metric_jacobian (unit_quad_pts_ext, coords_coeff_ext, fe_metric);
+    std::vector<real> jac_det_int(n_face_quad_pts), jac_det_ext(n_face_quad_pts);
+    std::vector<dealii::Tensor<2,dim,real>> jac_inv_tran_int(n_face_quad_pts), jac_inv_tran_ext(n_face_quad_pts);
+    for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+        jac_det_int[iquad] = dealii::determinant(metric_jac_int[iquad]);
+        jac_det_ext[iquad] = dealii::determinant(metric_jac_ext[iquad]);
+        jac_inv_tran_int[iquad] = dealii::transpose(dealii::invert(metric_jac_int[iquad]));
+        jac_inv_tran_ext[iquad] = dealii::transpose(dealii::invert(metric_jac_ext[iquad]));
+    }
+#ifdef KOPRIVA_METRICS_FACE
+    if constexpr (dim != 1) {
+        evaluate_covariant_metric_jacobian<dim,real> ( face_quadrature_int, coords_coeff_int, fe_metric, jac_inv_tran_int, jac_det_int);
+        evaluate_covariant_metric_jacobian<dim,real> ( face_quadrature_ext, coords_coeff_ext, fe_metric, jac_inv_tran_ext, jac_det_ext);
+    }
+#endif
+    const dealii::Tensor<1,dim,real> unit_normal_int = dealii::GeometryInfo<dim>::unit_normal_vector[face_subface_int.first];
+    const dealii::Tensor<1,dim,real> unit_normal_ext = dealii::GeometryInfo<dim>::unit_normal_vector[face_subface_ext.first];
+
+    std::vector<std::array<real,nstate>> soln_int(n_face_quad_pts), soln_ext(n_face_quad_pts);
+    evaluate_finite_element_values<dim, real, nstate> (unit_quad_pts_int, soln_coeff_int, fe_int, soln_int);
+    evaluate_finite_element_values<dim, real, nstate> (unit_quad_pts_ext, soln_coeff_ext, fe_ext, soln_ext);
+
+    dealii::FullMatrix<real> interpolation_operator_int(n_soln_dofs_int, n_face_quad_pts);
+    dealii::FullMatrix<real> interpolation_operator_ext(n_soln_dofs_ext, n_face_quad_pts);
+    for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+        for (unsigned int idof=0; idof<n_soln_dofs_int; ++idof) {
+            interpolation_operator_int[idof][iquad] = fe_int.shape_value(idof,unit_quad_pts_int[iquad]);
+        }
+        for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) {
+            interpolation_operator_ext[idof][iquad] = fe_ext.shape_value(idof,unit_quad_pts_ext[iquad]);
+        }
+    }
+
+    dealii::FullMatrix<real> dR_int_dW_int(n_soln_dofs_int, n_soln_dofs_int);
+    dealii::FullMatrix<real> dR_int_dW_ext(n_soln_dofs_int, n_soln_dofs_ext);
+    dealii::FullMatrix<real> dR_ext_dW_int(n_soln_dofs_ext, n_soln_dofs_int);
+    dealii::FullMatrix<real> dR_ext_dW_ext(n_soln_dofs_ext, n_soln_dofs_ext);
+
+    for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+
+        const dealii::Tensor<1,dim,real> normal_int = vmult(jac_inv_tran_int[iquad], unit_normal_int);
+        const dealii::Tensor<1,dim,real> normal_ext = vmult(jac_inv_tran_ext[iquad], unit_normal_ext);
+        const real area_int = norm(normal_int);
+        const real area_ext = norm(normal_ext);
+        const dealii::Tensor<1,dim,real> phys_unit_normal_int = normal_int / area_int;
+
+        const real surface_jac_det_int = area_int*jac_det_int[iquad];
+        const real surface_jac_det_ext = area_ext*jac_det_ext[iquad];
+        const real surface_jac_det = (surface_jac_det_int > surface_jac_det_ext) ? surface_jac_det_ext : surface_jac_det_int;
+        const real faceJxW = surface_jac_det * face_quadrature_int.weight(iquad);
+
+        dealii::Tensor<2,nstate,real> dflux_dsoln_int, dflux_dsoln_ext;
+        conv_num_flux.evaluate_flux_jacobian(soln_int[iquad], soln_ext[iquad], phys_unit_normal_int, dflux_dsoln_int, dflux_dsoln_ext);
+
+        // R_int -= phi_int * F* JxW and R_ext += phi_ext * F* JxW
+        for (unsigned int itest_int=0; itest_int<n_soln_dofs_int; ++itest_int) {
+            const unsigned int istate = fe_int.system_to_component_index(itest_int).first;
+            const real test_JxW = interpolation_operator_int[itest_int][iquad] * faceJxW;
+            for (unsigned int idof=0; idof<n_soln_dofs_int; ++idof) {
+                const unsigned int jstate = fe_int.system_to_component_index(idof).first;
+                dR_int_dW_int[itest_int][idof] -= test_JxW * dflux_dsoln_int[istate][jstate] * interpolation_operator_int[idof][iquad];
+            }
+            for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) {
+                const unsigned int jstate = fe_ext.system_to_component_index(idof).first;
+                dR_int_dW_ext[itest_int][idof] -= test_JxW * dflux_dsoln_ext[istate][jstate] * interpolation_operator_ext[idof][iquad];
+            }
+        }
+        for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
+            const unsigned int istate = fe_ext.system_to_component_index(itest_ext).first;
+            const real test_JxW = interpolation_operator_ext[itest_ext][iquad] * faceJxW;
+            for (unsigned int idof=0; idof<n_soln_dofs_int; ++idof) {
+                const unsigned int jstate = fe_int.system_to_component_index(idof).first;
+                dR_ext_dW_int[itest_ext][idof] += test_JxW * dflux_dsoln_int[istate][jstate] * interpolation_operator_int[idof][iquad];
+            }
+            for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) {
+                const unsigned int jstate = fe_ext.system_to_component_index(idof).first;
+                dR_ext_dW_ext[itest_ext][idof] += test_JxW * dflux_dsoln_ext[istate][jstate] * interpolation_operator_ext[idof][iquad];
+            }
+        }
+    }
+
+    const bool elide_zero_values = false;
+    std::vector<real> residual_derivatives;
+    for (unsigned int itest_int=0; itest_int<n_soln_dofs_int; ++itest_int) {
+        residual_derivatives.resize(n_soln_dofs_int);
+        for (unsigned int idof=0; idof<n_soln_dofs_int; ++idof) residual_derivatives[idof] = dR_int_dW_int[itest_int][idof];
+        this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+
+        residual_derivatives.resize(n_soln_dofs_ext);
+        for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) residual_derivatives[idof] = dR_int_dW_ext[itest_int][idof];
+        this->system_matrix.add(soln_dof_indices_int[itest_int], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
+    }
+    for (unsigned int itest_ext=0; itest_ext<n_soln_dofs_ext; ++itest_ext) {
+        residual_derivatives.resize(n_soln_dofs_int);
+        for (unsigned int idof=0; idof<n_soln_dofs_int; ++idof) residual_derivatives[idof] = dR_ext_dW_int[itest_ext][idof];
+        this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_int, residual_derivatives, elide_zero_values);
+
+        residual_derivatives.resize(n_soln_dofs_ext);
+        for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) residual_derivatives[idof] = dR_ext_dW_ext[itest_ext][idof];
+        this->system_matrix.add(soln_dof_indices_ext[itest_ext], soln_dof_indices_ext, residual_derivatives, elide_zero_values);
     }
 }
 
@@ -4096,7 +4830,27 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_volume_term_derivatives(
 {
     (void) current_cell_index;
     (void) fe_values_lagrange;
-    if (compute_d2R) {
+    const bool reuse_hessian_tape = this->all_parameters->reuse_volume_hessian_tapes
+                                    && !this->all_parameters->artificial_dissipation_param.add_artificial_dissipation;
+    if (use_analytic_flux_jacobians(compute_dRdW, compute_dRdX, compute_d2R)) {
+        assemble_volume_analytic_jacobian(
+            cell,
+            current_cell_index,
+            fe_values_vol,
+            fe_soln, quadrature,
+            metric_dof_indices, soln_dof_indices,
+            local_rhs_cell,
+            fe_values_lagrange);
+    } else if (compute_d2R && !compute_dRdW && !compute_dRdX && reuse_hessian_tape && !this->d2R_product_w) {
+        assemble_volume_codi_cached_hessian(
+            cell,
+            current_cell_index,
+            fe_values_vol,
+            fe_soln, quadrature,
+            metric_dof_indices, soln_dof_indices,
+            local_rhs_cell,
+            *(DGBaseState<dim,nstate,real,MeshType>::pde_physics_rad_fad));
+    } else if (compute_d2R) {
         assemble_volume_codi_taped_derivatives<codi_HessianComputationType>(
         cell,
             current_cell_index,
@@ -4159,7 +4913,28 @@ void DGWeak<dim,nstate,real,MeshType>::assemble_face_term_derivatives(
 {
     (void) current_cell_index;
     (void) neighbor_cell_index;
-    if (compute_d2R) {
+    if (use_analytic_flux_jacobians(compute_dRdW, compute_dRdX, compute_d2R)) {
+        assemble_face_analytic_jacobian(
+            cell,
+            current_cell_index,
+            neighbor_cell_index,
+            face_subface_int,
+            face_subface_ext,
+            face_data_set_int,
+            face_data_set_ext,
+            fe_values_int,
+            fe_values_ext,
+            penalty,
+            fe_int,
+            fe_ext,
+            face_quadrature,
+            metric_dof_indices_int,
+            metric_dof_indices_ext,
+            soln_dof_indices_int,
+            soln_dof_indices_ext,
+            local_rhs_int_cell,
+            local_rhs_ext_cell);
+    } else if (compute_d2R) {
         assemble_face_codi_taped_derivatives<codi_HessianComputationType>(
         cell,
             current_cell_index,
@@ -1,6 +1,10 @@
 #ifndef __WEAK_DISCONTINUOUSGALERKIN_H__
 #define __WEAK_DISCONTINUOUSGALERKIN_H__
 
+#include <array>
+#include <map>
+#include <memory>
+
 #include "dg.h"
 
 namespace PHiLiP {
@@ -33,8 +37,10 @@ private:
 
     /// Main function responsible for evaluating the integral over the cell volume and the specified derivatives.
     /** This function templates the solution and metric coefficients in order to possible AD the residual.
+     *  The physics are called through their virtual functions if PhysicsType is the abstract PhysicsBase,
+     *  and are otherwise bound at compile time (see Physics::is_statically_dispatched).
      */
-    template <typename real2>
+    template <typename real2, typename PhysicsType>
     void assemble_volume_term(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
         const dealii::types::global_dof_index current_cell_index,
@@ -44,7 +50,7 @@ private:
         const dealii::FESystem<dim,dim> &fe_soln,
         const dealii::FESystem<dim,dim> &fe_metric,
         const dealii::Quadrature<dim> &quadrature,
-        const Physics::PhysicsBase<dim, nstate, real2> &physics,
+        const PhysicsType &physics,
         std::vector<real2> &rhs,
         real2 &dual_dot_residual,
         const bool compute_metric_derivatives,
@@ -52,8 +58,9 @@ private:
 
     /// Main function responsible for evaluating the boundary integral and the specified derivatives.
     /** This function templates the solution and metric coefficients in order to possible AD the residual.
+     *  Same static dispatch of the physics and numerical fluxes as assemble_volume_term().
      */
-    template <typename adtype>
+    template <typename adtype, typename PhysicsType, typename ConvFluxType, typename DissFluxType>
     void assemble_boundary_term(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
         const dealii::types::global_dof_index current_cell_index,
@@ -62,9 +69,9 @@ private:
         const std::vector< real > &local_dual,
         const unsigned int face_number,
         const unsigned int boundary_id,
-        const Physics::PhysicsBase<dim, nstate, adtype> &physics,
-        const NumericalFlux::NumericalFluxConvective<dim, nstate, adtype> &conv_num_flux,
-        const NumericalFlux::NumericalFluxDissipative<dim, nstate, adtype> &diss_num_flux,
+        const PhysicsType &physics,
+        const ConvFluxType &conv_num_flux,
+        const DissFluxType &diss_num_flux,
         const dealii::FEFaceValuesBase<dim,dim> &fe_values_boundary,
         const real penalty,
         const dealii::FESystem<dim,dim> &fe_soln,
@@ -76,8 +83,12 @@ private:
 
     /// Main function responsible for evaluating the internal face integral and the specified derivatives.
     /** This function templates the solution and metric coefficients in order to possible AD the residual.
+     *  Same static dispatch of the physics and numerical fluxes as assemble_volume_term().
+     *
+     *  If @p soln_ext_trace is provided, the exterior solution and its gradient are taken from the face trace
+     *  received from the neighbouring processor instead of @p soln_coeff_ext.
      */
-    template <typename real2>
+    template <typename real2, typename PhysicsType, typename ConvFluxType, typename DissFluxType>
     void assemble_face_term(
         typename dealii::DoFHandler<dim>::active_cell_iterator cell,
         const dealii::types::global_dof_index current_cell_index,
@@ -92,9 +103,9 @@ private:
         const std::pair<unsigned int, int> face_subface_ext,
         const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
         const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
-        const Physics::PhysicsBase<dim, nstate, real2> &physics,
-        const NumericalFlux::NumericalFluxConvective<dim, nstate, real2> &conv_num_flux,
-        const NumericalFlux::NumericalFluxDissipative<dim, nstate, real2> &diss_num_flux,
+        const PhysicsType &physics,
+        const ConvFluxType &conv_num_flux,
+        const DissFluxType &diss_num_flux,
         const dealii::FEFaceValuesBase<dim,dim> &fe_values_int,
         const dealii::FEFaceValuesBase<dim,dim> &fe_values_ext,
         const real penalty,
@@ -105,7 +116,8 @@ private:
         std::vector<real2> &rhs_int,
         std::vector<real2> &rhs_ext,
         real2 &dual_dot_residual,
-        const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
+        const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R,
+        const double *const soln_ext_trace = nullptr);
 
 private:
 
@@ -127,6 +139,41 @@ private:
         const Physics::PhysicsBase<dim, nstate, real2> &physics,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
 
+    /// Adds the Hessian-vector product of a recorded dual-weighted residual to d2R_product_w and d2R_product_x.
+    /** The tape's only output is the dual-weighted residual. Its inputs are the solution coefficients
+     *  at soln_dof_indices followed by the metric coefficients at metric_dof_indices.
+     */
+    void add_codi_taped_d2R_vmult(
+        codi::TapeHelper<codi_HessianComputationType> &th,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices);
+
+    /// Second-order derivatives of the volume integral from a tape recorded once per element type.
+    /** Compute the right-hand side and the corresponding blocks of d2RdWdW, d2RdWdX, and d2RdXdX.
+     *  The tape of the residual (not the dual-weighted residual) is re-evaluated at the cell's
+     *  solution and metric coefficients, and the dual is seeded through the output adjoints.
+     */
+    void assemble_volume_codi_cached_hessian(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::FEValues<dim,dim> &fe_values_vol,
+        const dealii::FESystem<dim,dim> &fe_soln,
+        const dealii::Quadrature<dim> &quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        dealii::Vector<real> &local_rhs_cell,
+        const Physics::PhysicsBase<dim, nstate, codi_HessianComputationType> &physics);
+
+    /// Volume residual recording reused by assemble_volume_codi_cached_hessian().
+    struct VolumeHessianTape {
+        /// Recorded tape, swapped into the global tape while being evaluated.
+        std::unique_ptr<typename codi_HessianComputationType::TapeType> tape;
+        /// Inputs and outputs registered during the recording.
+        std::unique_ptr<codi::TapeHelper<codi_HessianComputationType>> tape_helper;
+    };
+    /// Recorded volume tapes keyed by the number of solution DoFs, metric DoFs, and quadrature points.
+    std::map<std::array<unsigned int,3>, VolumeHessianTape> volume_hessian_tapes;
+
     /// Preparation of CoDiPack taping for boundary integral, and derivative evaluation.
     /** Compute both the right-hand side and the corresponding block of dRdW, dRdX, and/or d2R. 
      *  Uses CoDiPack to automatically differentiate the functions.
@@ -143,9 +190,9 @@ private:
         const dealii::Quadrature<dim-1> &quadrature,
         const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
         const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
-        const Physics::PhysicsBase<dim, nstate, adtype> &physics,
-        const NumericalFlux::NumericalFluxConvective<dim, nstate, adtype> &conv_num_flux,
-        const NumericalFlux::NumericalFluxDissipative<dim, nstate, adtype> &diss_num_flux,
+        const PhysicsType &physics,
+        const ConvFluxType &conv_num_flux,
+        const DissFluxType &diss_num_flux,
         dealii::Vector<real> &local_rhs_cell,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
 
@@ -174,9 +221,9 @@ private:
         const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
         const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
         const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
-        const Physics::PhysicsBase<dim, nstate, adtype> &physics,
-        const NumericalFlux::NumericalFluxConvective<dim, nstate, adtype> &conv_num_flux,
-        const NumericalFlux::NumericalFluxDissipative<dim, nstate, adtype> &diss_num_flux,
+        const PhysicsType &physics,
+        const ConvFluxType &conv_num_flux,
+        const DissFluxType &diss_num_flux,
         dealii::Vector<real>          &local_rhs_int_cell,
         dealii::Vector<real>          &local_rhs_ext_cell,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
@@ -305,6 +352,90 @@ private:
         dealii::Vector<real>          &local_rhs_ext_cell,
         const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R);
 
+    /// Evaluate the solution values and gradients at the face quadrature points sent to the neighbouring processor.
+    /** Uses the same quadrature points and metric terms as the exterior side of assemble_face_term(),
+     *  such that the face trace matches the one the neighbouring processor would evaluate from the coefficients.
+     */
+    void evaluate_face_trace(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const unsigned int face_number,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        double *const face_trace);
+
+    /// Evaluate the integral over a face shared with another processor from the neighbour's face trace.
+    /** Compute the right-hand side of the current cell only. */
+    void assemble_face_term_from_trace(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::types::global_dof_index neighbor_cell_index,
+        const std::pair<unsigned int, int> face_subface_int,
+        const std::pair<unsigned int, int> face_subface_ext,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_int,
+        const dealii::FESystem<dim,dim> &fe_ext,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+        const double *const neighbor_face_trace,
+        dealii::Vector<real>          &local_rhs_int_cell);
+
+    /// Whether dRdW is assembled from the analytic flux Jacobians rather than automatic differentiation.
+    /** Requires the use_analytic_flux_jacobians parameter, a dRdW-only assembly, and analytic_flux_jacobians_available().
+     *  Boundary faces always use automatic differentiation.
+     */
+    bool use_analytic_flux_jacobians (const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R) const;
+
+    /// Whether the physics and numerical fluxes have analytic Jacobians.
+    /** Only inviscid physics providing convective_flux_directional_jacobian() with the Lax-Friedrichs flux
+     *  and without artificial dissipation are supported. The Roe-Pike and L2Roe convective fluxes and
+     *  the SIPG and BR2 dissipative fluxes fall back to automatic differentiation.
+     */
+    bool analytic_flux_jacobians_available () const;
+
+    /// Evaluate the integral over the cell volume and its dRdW block from the analytic convective flux Jacobians.
+    /** The block is \f$ \int \nabla \phi_i \cdot \frac{\partial \mathbf{F}}{\partial w} \phi_j \f$, where the
+     *  physical basis gradients and values are tabulated once per cell.
+     */
+    void assemble_volume_analytic_jacobian(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::FEValues<dim,dim> &fe_values_vol,
+        const dealii::FESystem<dim,dim> &fe_soln,
+        const dealii::Quadrature<dim> &quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices,
+        dealii::Vector<real> &local_rhs_cell,
+        const dealii::FEValues<dim,dim> &fe_values_lagrange);
+
+    /// Evaluate the integral over the internal face and its 4 dRdW blocks from the analytic numerical flux Jacobians.
+    void assemble_face_analytic_jacobian(
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell,
+        const dealii::types::global_dof_index current_cell_index,
+        const dealii::types::global_dof_index neighbor_cell_index,
+        const std::pair<unsigned int, int> face_subface_int,
+        const std::pair<unsigned int, int> face_subface_ext,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_int,
+        const typename dealii::QProjector<dim>::DataSetDescriptor face_data_set_ext,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_int,
+        const dealii::FEFaceValuesBase<dim,dim>     &fe_values_ext,
+        const real penalty,
+        const dealii::FESystem<dim,dim> &fe_int,
+        const dealii::FESystem<dim,dim> &fe_ext,
+        const dealii::Quadrature<dim-1> &face_quadrature,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &metric_dof_indices_ext,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_int,
+        const std::vector<dealii::types::global_dof_index> &soln_dof_indices_ext,
+        dealii::Vector<real>          &local_rhs_int_cell,
+        dealii::Vector<real>          &local_rhs_ext_cell);
+
 
     /// Evaluate the integral over the cell volume
     void assemble_volume_term_explicit(
@@ -206,7 +206,9 @@ int main(int nargs, char** args) {
   const int reverseDim = 1;
   timing_ad<1,reverseDim>(mode, n, n_assemblies);
   timing_ad<2,reverseDim>(mode, n, n_assemblies);
+  timing_ad<4,reverseDim>(mode, n, n_assemblies);
   timing_ad<8,reverseDim>(mode, n, n_assemblies);
+  timing_ad<16,reverseDim>(mode, n, n_assemblies);
 
 
   return 0;
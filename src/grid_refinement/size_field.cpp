@@ -78,18 +78,41 @@ void SizeField<dim,real>::isotropic_h(
     std::unique_ptr<Field<dim,real>> &         h_field,               // (output) size field
     const dealii::Vector<real> &               p_field)               // (input)  poly field
 {
-    // setting up lambda function which, given a constant for the size field, 
-    // updates the h distribution and outputs the new complexity
-    auto f = [&](real lam) -> real{
-        update_h_optimal(lam, B, dof_handler, h_field, p_field);
-        real current_complexity = evaluate_complexity(dof_handler, mapping_collection, fe_collection, quadrature_collection, update_flags, h_field, p_field);
-        return current_complexity - complexity;
+    // cell measures and indices are fixed throughout the search
+    const dealii::Vector<real> cell_measure = evaluate_cell_measures(dof_handler, mapping_collection, fe_collection, quadrature_collection, update_flags);
+    const std::vector<unsigned int> cell_indices = get_locally_owned_indices(dof_handler);
+
+    // size field is linear in lambda, h = lambda * c_k (see update_h_optimal)
+    const real q = 2.0;
+    dealii::Vector<real> c(B.size());
+    for(const unsigned int index : cell_indices){
+        const real p = p_field[index];
+
+        const real exponent  = -1.0/(q*(p+1)+2.0);
+        const real component = q*(p+1.0)/(q*(p+1)+2.0) * B[index]/pow(p+1, dim);
+
+        c[index] = pow(exponent, component);
+    }
+
+    // setting up lambda function which, given a set of constants for the size field, 
+    // outputs the corresponding complexities relative to the target
+    auto f = [&](const std::vector<real> &lams) -> std::vector<real>{
+        std::vector<real> f_lams = evaluate_complexity_candidates(
+            lams, cell_indices, cell_measure, p_field,
+            [&](const unsigned int index, const real lam) -> real{
+                return pow(lam * c[index], dim);
+            });
+
+        for(auto &f_lam : f_lams)
+            f_lam -= complexity;
+
+        return f_lams;
     };
 
-    // call to the optimization (bisection)
+    // call to the optimization (multisection)
     real a = 0;
     real b = 1000;
-    real lam = bisection(f, a, b);
+    real lam = multisection(f, a, b);
 
     // final update with converged parameter
     update_h_optimal(lam, B, dof_handler, h_field, p_field);
@@ -139,6 +162,88 @@ real SizeField<dim,real>::evaluate_complexity(
     return dealii::Utilities::MPI::sum(complexity_sum, MPI_COMM_WORLD);
 }
 
+template <int dim, typename real>
+dealii::Vector<real> SizeField<dim,real>::evaluate_cell_measures(
+    const dealii::DoFHandler<dim> &            dof_handler,           // dof_handler
+    const dealii::hp::MappingCollection<dim> & mapping_collection,    // mapping collection
+    const dealii::hp::FECollection<dim> &      fe_collection,         // fe collection
+    const dealii::hp::QCollection<dim> &       quadrature_collection, // quadrature collection
+    const dealii::UpdateFlags &                update_flags)          // update flags for for volume fe
+{
+    dealii::Vector<real> cell_measure(dof_handler.get_triangulation().n_active_cells());
+
+    // fe_values
+    dealii::hp::FEValues<dim,dim> fe_values_collection(
+        mapping_collection,
+        fe_collection,
+        quadrature_collection,
+        update_flags);
+
+    for(auto cell = dof_handler.begin_active(); cell != dof_handler.end(); ++cell){
+        if(!cell->is_locally_owned()) continue;
+
+        const unsigned int index = cell->active_cell_index();
+
+        const unsigned int mapping_index = 0;
+        const unsigned int fe_index = cell->active_fe_index();
+        const unsigned int quad_index = fe_index;
+
+        const unsigned int n_quad = quadrature_collection[quad_index].size();
+
+        fe_values_collection.reinit(cell, quad_index, mapping_index, fe_index); 
+        const dealii::FEValues<dim,dim> &fe_values = fe_values_collection.get_present_fe_values();
+
+        real JxW = 0;
+        for(unsigned int iquad = 0; iquad < n_quad; ++iquad)
+            JxW += fe_values.JxW(iquad);
+
+        cell_measure[index] = JxW;
+    }
+
+    return cell_measure;
+}
+
+template <int dim, typename real>
+std::vector<unsigned int> SizeField<dim,real>::get_locally_owned_indices(
+    const dealii::DoFHandler<dim> &            dof_handler)           // dof_handler
+{
+    std::vector<unsigned int> cell_indices;
+    cell_indices.reserve(dof_handler.get_triangulation().n_active_cells());
+
+    for(auto cell = dof_handler.begin_active(); cell != dof_handler.end(); ++cell)
+        if(cell->is_locally_owned())
+            cell_indices.push_back(cell->active_cell_index());
+
+    return cell_indices;
+}
+
+template <int dim, typename real>
+template <typename TargetMeasureFunction>
+std::vector<real> SizeField<dim,real>::evaluate_complexity_candidates(
+    const std::vector<real> &                  candidates,            // candidate bisection parameters
+    const std::vector<unsigned int> &          cell_indices,          // locally owned cell indices
+    const dealii::Vector<real> &               cell_measure,          // integrated cell measure
+    const dealii::Vector<real> &               p_field,               // (input) poly field
+    const TargetMeasureFunction &              target_measure)        // (input) h^dim for (cell, candidate)
+{
+    const unsigned int n_candidates = candidates.size();
+    std::vector<real> complexity_sum(n_candidates, 0.0);
+
+    // single pass over the cells, candidates in the inner loop
+    for(const unsigned int index : cell_indices){
+        const real weight = pow(p_field[index]+1, dim) * cell_measure[index];
+
+        for(unsigned int j = 0; j < n_candidates; ++j)
+            complexity_sum[j] += weight / target_measure(index, candidates[j]);
+    }
+
+    // one reduction for all candidates
+    std::vector<real> complexity_sum_mpi(n_candidates);
+    dealii::Utilities::MPI::sum(complexity_sum, MPI_COMM_WORLD, complexity_sum_mpi);
+
+    return complexity_sum_mpi;
+}
+
 template <int dim, typename real>
 void SizeField<dim,real>::update_h_optimal(
     const real                          lam,         // (input) bisection parameter
@@ -367,37 +472,42 @@ void SizeField<dim,real>::adjoint_h_balan(
     std::cout << "Target complexity = " << complexity << std::endl;
     std::cout << "f_0 = " << (initial_complexity - complexity) << std::endl;
 
-    // setting up the bisection functional, based on an input value of
-    // eta_ref, determines the complexity value for the mesh (using DWR estimates
-    // weighted in the quadratic logarithmic space).
-    auto f = [&](real eta_ref) -> real{
-        // updating the size field
-        update_alpha_vector_balan(
-            eta,
-            r_max, 
-            c_max, 
-            eta_min, 
-            eta_max,
-            eta_ref,
-            dof_handler,
-            I_c,
-            h_field);
-
-        // getting the complexity and returning the difference with the target
-        real current_complexity = evaluate_complexity(
-            dof_handler, 
-            mapping_collection, 
-            fe_collection, 
-            quadrature_collection, 
-            update_flags, 
-            h_field, 
-            p_field);
-        return current_complexity - complexity;
+    // cell measures and indices are fixed throughout the search
+    const dealii::Vector<real> cell_measure = evaluate_cell_measures(
+        dof_handler, 
+        mapping_collection, 
+        fe_collection, 
+        quadrature_collection, 
+        update_flags);
+    const std::vector<unsigned int> cell_indices = get_locally_owned_indices(dof_handler);
+
+    // setting up the multisection functional, based on a set of input values of
+    // eta_ref, determines the complexity values for the mesh (using DWR estimates
+    // weighted in the quadratic logarithmic space) in a single sweep.
+    auto f = [&](const std::vector<real> &eta_refs) -> std::vector<real>{
+        // target cell measure is alpha_k * I_c (see update_alpha_vector_balan)
+        std::vector<real> f_eta_refs = evaluate_complexity_candidates(
+            eta_refs, cell_indices, cell_measure, p_field,
+            [&](const unsigned int index, const real eta_ref) -> real{
+                return I_c[index] * update_alpha_k_balan(
+                    eta[index],
+                    r_max,
+                    c_max,
+                    eta_min,
+                    eta_max,
+                    eta_ref);
+            });
+
+        // returning the difference with the target
+        for(auto &f_eta_ref : f_eta_refs)
+            f_eta_ref -= complexity;
+
+        return f_eta_refs;
     };
 
-    // call to optimization (bisection), using min and max as initial bounds
-    real eta_target = bisection(f, eta_max, eta_min);
-    std::cout << "Bisection finished with eta_ref = "<< eta_target << ", f(eta_ref)=" << f(eta_target) << std::endl;
+    // call to optimization (multisection), using min and max as initial bounds
+    real eta_target = multisection(f, eta_max, eta_min);
+    std::cout << "Multisection finished with eta_ref = "<< eta_target << ", f(eta_ref)=" << f({eta_target})[0] << std::endl;
 
     // final uppdate using the converged parameter
     update_alpha_vector_balan(
@@ -467,31 +577,34 @@ void SizeField<dim,real>::adjoint_h_equal(
     real eta_min = dealii::Utilities::MPI::min(eta_min_local, MPI_COMM_WORLD);
     real eta_max = dealii::Utilities::MPI::max(eta_max_local, MPI_COMM_WORLD);
 
-    // setting up the bisection functional, based on an input value of tau
-    // determines new size from 2p+1 root relative to local DWR
-    auto f = [&](real tau) -> real{
-        // updating the size field
-        update_h_dwr(
-            tau,
-            eta, 
-            dof_handler,
-            h_field,
-            poly_degree);
-
-        // getting the complexity and returning the difference with the target
-        real current_complexity = evaluate_complexity(
-            dof_handler, 
-            mapping_collection, 
-            fe_collection, 
-            quadrature_collection, 
-            update_flags, 
-            h_field, 
-            p_field);
-        return current_complexity - complexity;
+    // cell measures and indices are fixed throughout the search
+    const dealii::Vector<real> cell_measure = evaluate_cell_measures(
+        dof_handler, 
+        mapping_collection, 
+        fe_collection, 
+        quadrature_collection, 
+        update_flags);
+    const std::vector<unsigned int> cell_indices = get_locally_owned_indices(dof_handler);
+
+    // setting up the multisection functional, based on a set of input values of tau
+    // determines new sizes from 2p+1 root relative to local DWR (see update_h_dwr)
+    const real Nrt = dim/(2*poly_degree+1);
+    auto f = [&](const std::vector<real> &taus) -> std::vector<real>{
+        std::vector<real> f_taus = evaluate_complexity_candidates(
+            taus, cell_indices, cell_measure, p_field,
+            [&](const unsigned int index, const real tau) -> real{
+                return pow(tau/eta[index], Nrt);
+            });
+
+        // returning the difference with the target
+        for(auto &f_tau : f_taus)
+            f_tau -= complexity;
+
+        return f_taus;
     };
 
-    // performing the bisection call
-    real tau_target = bisection(f, eta_min, eta_max, 1e-10);
+    // performing the multisection call
+    real tau_target = multisection(f, eta_min, eta_max, 1e-10);
 
     // updating the size field
     update_h_dwr(
@@ -615,45 +728,72 @@ real SizeField<dim,real>::update_alpha_k_balan(
 }
 
 // functions for solving non-linear problems
+// multisection variant evaluating several candidates per functional call
 template <int dim, typename real>
-real SizeField<dim,real>::bisection(
-    const std::function<real(real)> func,  
+real SizeField<dim,real>::multisection(
+    const std::function<std::vector<real>(const std::vector<real>&)> func,  
     real                            lower_bound, 
     real                            upper_bound,
     real                            rel_tolerance,
-    real                            abs_tolerance)
+    real                            abs_tolerance,
+    const unsigned int              n_candidates)
 {
-    real f_lb = func(lower_bound);
-    real f_ub = func(upper_bound);
+    Assert(n_candidates > 0, dealii::ExcInternalError());
+
+    const std::vector<real> f_bounds = func({lower_bound, upper_bound});
+    real f_lb = f_bounds[0];
+    real f_ub = f_bounds[1];
 
     std::cout << "lb = " << lower_bound << ", f_lb = " << f_lb << std::endl;
     std::cout << "ub = " << upper_bound << ", f_ub = " << f_ub << std::endl;
 
-    // f_ub is unused before being reset if not present here
     AssertThrow(f_lb * f_ub < 0, dealii::ExcInternalError());
 
-    real x   = (lower_bound + upper_bound)/2.0;
-    real f_x = func(x);
-
-    // const real         rel_tolerance = 1e-6;
-    const unsigned int max_iter = 1000;
+    const unsigned int max_iter = 100;
 
     real tolerance = rel_tolerance * abs(f_ub-f_lb);
     if(abs_tolerance < tolerance)
         tolerance = abs_tolerance;
 
+    // best candidate so far
+    real x   = (abs(f_lb) < abs(f_ub)) ? lower_bound : upper_bound;
+    real f_x = (abs(f_lb) < abs(f_ub)) ? f_lb : f_ub;
+
+    std::vector<real> x_j(n_candidates);
     unsigned int i = 0;
     while(abs(f_x) > tolerance && i < max_iter){
-        if(f_x * f_lb < 0){
-            upper_bound = x;
-            f_ub        = f_x;
-        }else{
-            lower_bound = x;
-            f_lb        = f_x;
+        // equally spaced interior candidates
+        const real dx = (upper_bound - lower_bound) / (n_candidates + 1);
+        for(unsigned int j = 0; j < n_candidates; ++j)
+            x_j[j] = lower_bound + (j+1) * dx;
+
+        const std::vector<real> f_j = func(x_j);
+
+        // closest candidate to the root
+        for(unsigned int j = 0; j < n_candidates; ++j){
+            if(abs(f_j[j]) < abs(f_x)){
+                x   = x_j[j];
+                f_x = f_j[j];
+            }
         }
 
-        x   = (lower_bound + upper_bound)/2.0;
-        f_x = func(x);
+        // narrowing the bracket to the first sign change
+        real x_left = lower_bound, f_left = f_lb;
+        for(unsigned int j = 0; j <= n_candidates; ++j){
+            const real x_right = (j < n_candidates) ? x_j[j] : upper_bound;
+            const real f_right = (j < n_candidates) ? f_j[j] : f_ub;
+
+            if(f_left * f_right <= 0){
+                lower_bound = x_left;
+                f_lb        = f_left;
+                upper_bound = x_right;
+                f_ub        = f_right;
+                break;
+            }
+
+            x_left = x_right;
+            f_left = f_right;
+        }
 
         std::cout << "iter #" << i << ", x = " << x << ", fx = " << f_x << std::endl;
 
@@ -1,6 +1,9 @@
 #ifndef __SIZE_FIELD_H__
 #define __SIZE_FIELD_H__
 
+#include <vector>
+#include <functional>
+
 #include <deal.II/grid/tria.h>
 
 #include <deal.II/fe/fe.h>
@@ -459,19 +462,65 @@ protected:
         const real eta_ref  ///< Threshold value of DWR for deciding between coarsening and refinement
         );
 
-    /// Bisect function based on starting bounds
-    /** Performs bisection on an input lambda function \f$f(x)\f$ with starting bounds
-      * \f$x\in\left[a,b\right]\f$. Assumes that \f$f(a)\f$ and \f$f(b)\f$ are of opposite sign
-      * and iteratively chooses half interval until a suitably accurate approximation
-      * of \f$f(x)\approx 0\f$ is found. Stops when either a absolute or relative (to
+    /// Evaluates the integrated cell measure for each locally owned cell
+    /** Sums the quadrature weights \f$JxW\f$ of the volume finite elements on each locally owned
+      * cell. As the reference mesh is fixed during the continuous complexity optimization, this 
+      * is computed once before the multisection sweeps, allowing evaluate_complexity_candidates
+      * to avoid reinitializing the FEValues for every candidate parameter.
+      */
+    static dealii::Vector<real> evaluate_cell_measures(
+        const dealii::DoFHandler<dim> &            dof_handler,           ///< DoFHandler describing the mesh
+        const dealii::hp::MappingCollection<dim> & mapping_collection,    ///< Element mapping collection
+        const dealii::hp::FECollection<dim> &      fe_collection,         ///< Finite element collection
+        const dealii::hp::QCollection<dim> &       quadrature_collection, ///< Quadrature rules collection
+        const dealii::UpdateFlags &                update_flags           ///< Update flags for the volume finite elements
+        );
+
+    /// Gets the contiguous list of active cell indices owned by the current processor
+    static std::vector<unsigned int> get_locally_owned_indices(
+        const dealii::DoFHandler<dim> &            dof_handler            ///< DoFHandler describing the mesh
+        );
+
+    /// Evaluates the continuous complexity for a set of candidate bisection parameters in a single sweep
+    /** Equivalent to calling evaluate_complexity after updating the size-field for each of the candidate 
+      * parameters. Instead, the target element measure \f$h_i^{dim}\f$ is evaluated directly from the
+      * input functor for each cell and candidate such that
+      * 
+      * \f[
+      *     \mathcal{C}_j = 
+      *     \sum_{i=0}^{N} {
+      *         \frac{\left(p_i+1\right)^{dim} \left|K_i\right|}{h_i(\lambda_j)^{dim}}
+      *     }
+      * \f]
+      * 
+      * Cell contributions are accumulated over a contiguous array of the locally owned cells with the
+      * candidates in the inner loop and the results for all candidates are combined in a single MPI reduction.
+      */
+    template <typename TargetMeasureFunction>
+    static std::vector<real> evaluate_complexity_candidates(
+        const std::vector<real> &                  candidates,            ///< Candidate bisection parameters \f$\lambda_j\f$
+        const std::vector<unsigned int> &          cell_indices,          ///< Locally owned active cell indices
+        const dealii::Vector<real> &               cell_measure,          ///< Integrated measure of each cell \f$\left|K_i\right|\f$
+        const dealii::Vector<real> &               p_field,               ///< (Input) Current polynomial field
+        const TargetMeasureFunction &              target_measure         ///< Functor (cell index, candidate) returning \f$h_i^{dim}\f$
+        );
+
+    /// Multisection function based on starting bounds
+    /** Generalization of bisection where the input functor evaluates \f$f(x)\f$
+      * for a vector of candidate values at once. Assumes that \f$f(a)\f$ and \f$f(b)\f$ are of
+      * opposite sign. On each sweep, n_candidates equally spaced interior points of \f$\left[a,b\right]\f$
+      * are evaluated and the bracket is reduced to the sub-interval containing the sign change, shrinking the range by a factor of n_candidates+1
+      * rather than 2. As each functor call performs a single global reduction, the complexity target
+      * is matched in a handful of sweeps over the mesh. Stops when either an absolute or relative (to
       * the initial range) function value tolerance is achieved.
-      */ 
-    static real bisection(
-        const std::function<real(real)> func,                 ///< Input lambda function to be solved for \f$f(x)=0\f$, takes real value and returns real value 
+      */
+    static real multisection(
+        const std::function<std::vector<real>(const std::vector<real>&)> func, ///< Input lambda function evaluating \f$f(x_j)\f$ for each candidate \f$x_j\f$
         real                            lower_bound,          ///< lower bound of the search, \f$a\f$
         real                            upper_bound,          ///< upper bound of the search, \f$b\f$
         real                            rel_tolerance = 1e-6, ///< Relative tolerance scale, stops search when \f$\left|f(x_i)\right|<\epsilon \left|f(a)-f(b)\right|\f$
-        real                            abs_tolerance = 1.0   ///< Absolute tolerance scale, stops search when \f$\left|f(x_i)\right|<\epsilon\f$
+        real                            abs_tolerance = 1.0,  ///< Absolute tolerance scale, stops search when \f$\left|f(x_i)\right|<\epsilon\f$
+        const unsigned int              n_candidates  = 15    ///< Number of interior candidates evaluated per sweep
         );
 
 };
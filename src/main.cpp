@@ -13,6 +13,10 @@
 
 #include "global_counter.hpp"
 
+#ifdef PHILIP_USE_KOKKOS
+#include <Kokkos_Core.hpp>
+#endif
+
 int main (int argc, char *argv[])
 {
 // #if !defined(__APPLE__)
@@ -26,6 +30,10 @@ int main (int argc, char *argv[])
     d2R_mult = 0;
 
     dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+#ifdef PHILIP_USE_KOKKOS
+    // Used by the explicit ODE solver to assemble the strong DG residual.
+    Kokkos::ScopeGuard kokkos_guard(argc, argv);
+#endif
     const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
     const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
     if (n_mpi==1 || mpi_rank==0) {
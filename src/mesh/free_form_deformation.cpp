@@ -1,10 +1,12 @@
 #include <fstream>
+#include <map>
 #include <boost/math/special_functions/binomial.hpp>
 
 #include <Sacado.hpp>
 
 #include "free_form_deformation.h"
 #include "meshmover_linear_elasticity.hpp"
+#include "meshmover_rbf.hpp"
 
 #include <deal.II/base/utilities.h>
 #include <deal.II/grid/grid_out.h>
@@ -18,16 +20,39 @@
 
 namespace PHiLiP {
 
+template<int dim>
+struct FreeFormDeformation<dim>::MeshMoverCache
+{
+    /// Mesh mover of a given type and the surface displacements it references.
+    /** Kept together such that a mover handed out by get_meshmover() never references a reinitialized vector.
+     */
+    struct Entry
+    {
+        /// HighOrderGrid::grid_id of the grid on which the meshmover was built.
+        /** The address of the grid is not used since a new grid may be allocated at the address of a deleted one.
+         */
+        unsigned long long grid_id = 0;
+        /// Surface displacements referenced by the meshmover.
+        dealii::LinearAlgebra::distributed::Vector<double> surface_node_displacements;
+        /// Mesh mover built on the initial mesh of the grid.
+        std::unique_ptr<MeshMover::MeshMoverBase<dim,double>> meshmover;
+    };
+    /// Entry of the last grid given to get_meshmover() for each mesh mover type.
+    std::map<Parameters::AllParameters::MeshMoverType, std::shared_ptr<Entry>> entries;
+};
+
 template<int dim>
 FreeFormDeformation<dim>::FreeFormDeformation (
         const dealii::Point<dim> &_origin,
         const std::array<dealii::Tensor<1,dim,double>,dim> _parallepiped_vectors,
         const std::array<unsigned int,dim> &_ndim_control_pts)
-        : origin(_origin)
+        : mesh_mover_type(Parameters::AllParameters::MeshMoverType::linear_elasticity)
+        , origin(_origin)
         , parallepiped_vectors(_parallepiped_vectors)
         , ndim_control_pts(_ndim_control_pts)
         , n_control_pts(compute_total_ctl_pts())
         , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+        , meshmover_cache(std::make_shared<MeshMoverCache>())
 { 
     control_pts.resize(n_control_pts);
     for (unsigned int ictl = 0; ictl < n_control_pts; ++ictl) {
@@ -341,19 +366,59 @@ void FreeFormDeformation<dim>
 {
     dealii::LinearAlgebra::distributed::Vector<double>  surface_node_displacements = get_surface_displacement (high_order_grid);
 
-    MeshMover::LinearElasticity<dim, double>
-        meshmover( 
-          *(high_order_grid.triangulation),
-          high_order_grid.initial_mapping_fe_field,
-          high_order_grid.dof_handler_grid,
-          high_order_grid.surface_to_volume_indices,
-          surface_node_displacements);
-    dealii::LinearAlgebra::distributed::Vector<double> volume_displacements = meshmover.get_volume_displacements();
+    std::shared_ptr<MeshMover::MeshMoverBase<dim,double>> meshmover = get_meshmover(high_order_grid, surface_node_displacements);
+    dealii::LinearAlgebra::distributed::Vector<double> volume_displacements = meshmover->get_volume_displacements();
     high_order_grid.volume_nodes = high_order_grid.initial_volume_nodes;
     high_order_grid.volume_nodes += volume_displacements;
     high_order_grid.volume_nodes.update_ghost_values();
 }
 
+template<int dim>
+std::shared_ptr<MeshMover::MeshMoverBase<dim,double>>
+FreeFormDeformation<dim>
+::get_meshmover (const HighOrderGrid<dim,double> &high_order_grid) const
+{
+    std::shared_ptr<typename MeshMoverCache::Entry> &entry = meshmover_cache->entries[mesh_mover_type];
+    // The meshmover invalidates its own system when the triangulation changes.
+    // It only needs to be rebuilt for another grid or another surface partitioning.
+    const bool is_reusable = entry
+                             && entry->grid_id == high_order_grid.grid_id
+                             && entry->surface_node_displacements.partitioners_are_compatible(*(high_order_grid.surface_nodes.get_partitioner()));
+    if (!is_reusable) {
+        // Movers previously handed out keep their own entry alive.
+        entry = std::make_shared<typename MeshMoverCache::Entry>();
+        entry->grid_id = high_order_grid.grid_id;
+        entry->surface_node_displacements.reinit(high_order_grid.surface_nodes);
+        if (mesh_mover_type == Parameters::AllParameters::MeshMoverType::radial_basis_function) {
+            entry->meshmover = std::make_unique<MeshMover::RadialBasisFunction<dim,double>>(
+                high_order_grid,
+                entry->surface_node_displacements);
+        } else {
+            entry->meshmover = std::make_unique<MeshMover::LinearElasticity<dim,double>>(
+                *(high_order_grid.triangulation),
+                high_order_grid.initial_mapping_fe_field,
+                high_order_grid.dof_handler_grid,
+                high_order_grid.surface_to_volume_indices,
+                entry->surface_node_displacements);
+        }
+    }
+    return std::shared_ptr<MeshMover::MeshMoverBase<dim,double>>(entry, entry->meshmover.get());
+}
+
+template<int dim>
+std::shared_ptr<MeshMover::MeshMoverBase<dim,double>>
+FreeFormDeformation<dim>
+::get_meshmover (
+    const HighOrderGrid<dim,double> &high_order_grid,
+    const dealii::LinearAlgebra::distributed::Vector<double> &surface_node_displacements) const
+{
+    std::shared_ptr<MeshMover::MeshMoverBase<dim,double>> meshmover = get_meshmover(high_order_grid);
+    dealii::LinearAlgebra::distributed::Vector<double> &cached_displacements = meshmover_cache->entries.at(mesh_mover_type)->surface_node_displacements;
+    cached_displacements = surface_node_displacements;
+    cached_displacements.update_ghost_values();
+    return meshmover;
+}
+
 template<int dim>
 dealii::LinearAlgebra::distributed::Vector<double> 
 FreeFormDeformation<dim>
@@ -473,7 +538,7 @@ FreeFormDeformation<dim>
 
             for (int d=0; d<dim; ++d) { 
                 if ((unsigned int)d!=ctl_axis) {
-                    assert(dxsdxp[d] == 0.0);
+                    Assert(dxsdxp[d] == 0.0, dealii::ExcInternalError());
                 }
                 const dealii::types::global_dof_index vol_index = high_order_grid.point_and_axis_to_global_index.at(std::make_pair(ipoint,(unsigned int)d));
                 if (nodes_locally_owned.is_element(vol_index)) {
@@ -504,23 +569,27 @@ FreeFormDeformation<dim>
     const dealii::IndexSet &row_part = high_order_grid.dof_handler_grid.locally_owned_dofs();
     const dealii::IndexSet col_part = dealii::Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,n_cols);
 
-    dealii::DynamicSparsityPattern full_dsp(n_rows, n_cols, row_part);
-    for (const auto &i_row: row_part) {
-        for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
-            full_dsp.add(i_row, i_col);
+    // Only the surface nodes in the direction of the FFD control point displacement are non-zero.
+    const dealii::IndexSet &nodes_locally_owned = high_order_grid.volume_nodes.get_partitioner()->locally_owned_range();
+    dealii::DynamicSparsityPattern surface_dsp(n_rows, n_cols, row_part);
+    for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
+        const unsigned int ctl_axis = ffd_design_variables_indices_dim[i_col].second;
+        for (unsigned int ipoint = 0; ipoint < high_order_grid.initial_locally_relevant_surface_points.size(); ++ipoint) {
+            const dealii::types::global_dof_index vol_index = high_order_grid.point_and_axis_to_global_index.at(std::make_pair(ipoint,ctl_axis));
+            if (nodes_locally_owned.is_element(vol_index)) {
+                surface_dsp.add(vol_index, i_col);
+            }
         }
     }
     dealii::IndexSet locally_relevant_dofs;
     dealii::DoFTools::extract_locally_relevant_dofs(high_order_grid.dof_handler_grid, locally_relevant_dofs);
-    dealii::SparsityTools::distribute_sparsity_pattern(full_dsp, row_part, MPI_COMM_WORLD, locally_relevant_dofs);
+    dealii::SparsityTools::distribute_sparsity_pattern(surface_dsp, row_part, MPI_COMM_WORLD, locally_relevant_dofs);
 
-    dealii::SparsityPattern full_sp;
-    full_sp.copy_from(full_dsp);
+    dealii::SparsityPattern surface_sp;
+    surface_sp.copy_from(surface_dsp);
 
-    dXvsdXp.reinit(row_part, col_part, full_sp, MPI_COMM_WORLD);
+    dXvsdXp.reinit(row_part, col_part, surface_sp, MPI_COMM_WORLD);
 
-
-    const dealii::IndexSet &nodes_locally_owned = high_order_grid.volume_nodes.get_partitioner()->locally_owned_range();
     for (unsigned int i_col = 0; i_col < ffd_design_variables_indices_dim.size(); ++i_col) {
 
         const auto ffd_pair = ffd_design_variables_indices_dim[i_col];
@@ -533,13 +602,14 @@ FreeFormDeformation<dim>
             dealii::Point<dim,double> dxsdxp = dXdXp (surface_point, ctl_index, ctl_axis);
 
             for (int d=0; d<dim; ++d) { 
+                if ((unsigned int)d!=ctl_axis) {
+                    Assert(dxsdxp[d] == 0.0, dealii::ExcInternalError());
+                    continue;
+                }
                 const dealii::types::global_dof_index vol_index = high_order_grid.point_and_axis_to_global_index.at(std::make_pair(ipoint,(unsigned int)d));
                 if (nodes_locally_owned.is_element(vol_index)) {
                     dXvsdXp.set(vol_index,i_col, dxsdxp[d]);
                 }
-                if ((unsigned int)d!=ctl_axis) {
-                    assert(dxsdxp[d] == 0.0);
-                }
             }
 
             ipoint++;
@@ -561,16 +631,10 @@ FreeFormDeformation<dim>
 
     std::vector<dealii::LinearAlgebra::distributed::Vector<double>> dXvsdXp_vector = get_dXvsdXp(high_order_grid, ffd_design_variables_indices_dim);
 
-    dealii::LinearAlgebra::distributed::Vector<double> surface_node_displacements(high_order_grid.surface_nodes);
-    MeshMover::LinearElasticity<dim, double>
-        meshmover( 
-          *(high_order_grid.triangulation),
-          high_order_grid.initial_mapping_fe_field,
-          high_order_grid.dof_handler_grid,
-          high_order_grid.surface_to_volume_indices,
-          surface_node_displacements);
+    std::shared_ptr<MeshMover::MeshMoverBase<dim,double>> meshmover = get_meshmover(high_order_grid);
     //meshmover.evaluate_dXvdXs();
-    meshmover.apply_dXvdXvs(dXvsdXp_vector, dXvdXp);
+    meshmover->prepare_dXvdXvs(dXvsdXp_vector);
+    meshmover->apply_dXvdXvs(dXvsdXp_vector, dXvdXp);
 }
 
 template<int dim>
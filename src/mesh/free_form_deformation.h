@@ -5,6 +5,10 @@
 
 namespace PHiLiP {
 
+namespace MeshMover {
+template <int dim, typename real> class MeshMoverBase;
+} // namespace MeshMover
+
 /// Free form deformation class from Sederberg 1986.
 template<int dim>
 class FreeFormDeformation
@@ -144,6 +148,18 @@ public:
     /// Output a .vtu file of the FFD box to visualize.
     void output_ffd_vtu(const unsigned int cycle) const;
 
+    /// Mesh mover used by deform_mesh(), get_dXvdXp() and get_meshmover().
+    /** Defaults to linear elasticity. */
+    Parameters::AllParameters::MeshMoverType mesh_mover_type;
+
+    /// Returns the mesh mover of type mesh_mover_type built on the initial mesh of @p high_order_grid.
+    /** The mover is cached by HighOrderGrid::grid_id and shared by the copies of this FreeFormDeformation,
+     *  such that deform_mesh(), get_dXvdXp(), FlowConstraints and ROLObjectiveSimOpt use
+     *  a single assembled and factorized elasticity system per reference mesh.
+     *  The returned pointer keeps the mover valid even if the cache moves on to another grid.
+     */
+    std::shared_ptr<MeshMover::MeshMoverBase<dim,double>> get_meshmover (const HighOrderGrid<dim,double> &high_order_grid) const;
+
 protected:
 
     /// Returns the local coordinates s-t-u within the FFD box.
@@ -175,6 +191,19 @@ private:
     /// Outputs if MPI rank is 0.
     dealii::ConditionalOStream pcout;
 
+    /// Mesh mover kept between the deformations of the same HighOrderGrid.
+    struct MeshMoverCache;
+    /** The elasticity system of the initial mesh is assembled and preconditioned once,
+     *  and reused by every deform_mesh() and get_dXvdXp() call. Likewise for the RBF control points.
+     *  Shared such that copies of this FreeFormDeformation reuse the same system.
+     */
+    std::shared_ptr<MeshMoverCache> meshmover_cache;
+
+    /// Returns the cached mesh mover of @p high_order_grid with the given surface displacements.
+    std::shared_ptr<MeshMover::MeshMoverBase<dim,double>> get_meshmover (
+        const HighOrderGrid<dim,double> &high_order_grid,
+        const dealii::LinearAlgebra::distributed::Vector<double> &surface_node_displacements) const;
+
     /// Initial message.
     void init_msg() const;
 };
@@ -1,6 +1,13 @@
-#include <fstream>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <map>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/utilities.h>
 
@@ -138,178 +145,287 @@ assign_1d_boundary_ids(const std::map<unsigned int, dealii::types::boundary_id>
 }
 
 
-void open_file_toRead(const std::string filepath, std::ifstream& file_in)
+/// Memory-mapped view of a Gmsh 4.1 .msh file.
+/** Provides sequential, block-wise access to both the ASCII (file-type 0) and the binary
+  * (file-type 1) flavours of the format, such that the same parsing routines are used for both.
+  * In the binary format, entity tags and types are stored as int, while node tags, element tags
+  * and block sizes are stored as size_t. Section markers ($Nodes, $EndNodes, ...) are ASCII in both.
+  */
+class GmshFileBuffer
 {
-    file_in.open(filepath);
-    if(!file_in) {
+public:
+    /// Constructor. Memory-maps the file.
+    explicit GmshFileBuffer(const std::string &filepath);
+
+    /// Destructor. Unmaps the file.
+    ~GmshFileBuffer();
+
+    /// Reads the next whitespace-delimited ASCII word.
+    /** In binary mode, the newline ending a section marker is consumed such that the cursor
+      * is positioned at the start of the binary block.
+      */
+    std::string read_word();
+
+    /// Reads a node tag, element tag or block size.
+    unsigned long read_size();
+
+    /// Reads an entity tag, dimension or element type.
+    int read_int();
+
+    /// Reads a coordinate.
+    double read_double();
+
+    /// Reads n_values consecutive sizes. Single copy in binary mode.
+    void read_sizes(std::vector<unsigned long> &values, const unsigned long n_values);
+
+    /// Reads n_values consecutive coordinates. Single copy in binary mode.
+    void read_doubles(std::vector<double> &values, const unsigned long n_values);
+
+    /// Current position of the cursor.
+    size_t tell() const { return position; }
+
+    /// Move the cursor to a previously stored position.
+    void seek(const size_t new_position) { position = new_position; }
+
+    /// Whether the cursor is still within the file.
+    bool good() const { return position <= length; }
+
+    /// Whether the file uses the binary format. Set once the $MeshFormat header has been read.
+    bool binary = false;
+
+private:
+    /// Skip spaces and newlines in ASCII mode.
+    void skip_whitespace();
+
+    /// Copy raw bytes into the given location and advance the cursor.
+    void read_bytes(void *destination, const size_t n_bytes);
+
+    int file_descriptor; ///< File descriptor of the mapped file.
+    const char *data;    ///< Start of the mapped file.
+    size_t length;       ///< Size of the mapped file in bytes.
+    size_t position;     ///< Cursor location in bytes.
+};
+
+GmshFileBuffer::GmshFileBuffer(const std::string &filepath)
+    : file_descriptor(-1)
+    , data(nullptr)
+    , length(0)
+    , position(0)
+{
+    file_descriptor = open(filepath.c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
         std::cout << "Could not open file "<< filepath << std::endl;
         std::abort();
     }
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) != 0) {
+        std::cout << "Could not stat file "<< filepath << std::endl;
+        std::abort();
+    }
+    length = file_status.st_size;
+
+    void *mapped_file = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapped_file == MAP_FAILED) {
+        std::cout << "Could not memory-map file "<< filepath << std::endl;
+        std::abort();
+    }
+    // File is parsed front to back. Let the kernel read ahead.
+    madvise(mapped_file, length, MADV_SEQUENTIAL);
+    data = static_cast<const char*>(mapped_file);
 }
 
+GmshFileBuffer::~GmshFileBuffer()
+{
+    if (data) munmap(const_cast<char*>(data), length);
+    if (file_descriptor >= 0) close(file_descriptor);
+}
 
-void read_gmsh_entities(std::ifstream &infile, std::array<std::map<int, int>, 4> &tag_maps)
+void GmshFileBuffer::skip_whitespace()
 {
-    std::string  line;
-    // if the next block is of kind $Entities, parse it
-    unsigned long n_points, n_curves, n_surfaces, n_volumes;
-
-    infile >> n_points >> n_curves >> n_surfaces >> n_volumes;
-    int entity_tag;
-    unsigned int n_physicals;
-    double box_min_x, box_min_y, box_min_z, box_max_x, box_max_y, box_max_z;
-    (void) box_min_x; (void) box_min_y; (void) box_min_z;
-    (void) box_max_x; (void) box_max_y; (void) box_max_z;
-    for (unsigned int i = 0; i < n_points; ++i) {
-        // parse point ids
-
-        // we only care for 'tag' as key for tag_maps[0]
-        infile >> entity_tag >> box_min_x >> box_min_y >> box_min_z >> n_physicals;
-
-        // if there is a physical tag, we will use it as boundary id below
-        AssertThrow(n_physicals < 2, dealii::ExcMessage("More than one tag is not supported!"));
-        // if there is no physical tag, use 0 as default
-        int physical_tag = 0;
-        for (unsigned int j = 0; j < n_physicals; ++j) {
-            infile >> physical_tag;
-        }
-        //std::cout << "Entity point tag " << entity_tag << " with physical tag " << physical_tag << std::endl;
-        tag_maps[0][entity_tag] = physical_tag;
+    while (position < length && std::isspace(static_cast<unsigned char>(data[position]))) ++position;
+}
+
+void GmshFileBuffer::read_bytes(void *destination, const size_t n_bytes)
+{
+    AssertThrow(position + n_bytes <= length, dealii::ExcIO());
+    std::memcpy(destination, data + position, n_bytes);
+    position += n_bytes;
+}
+
+std::string GmshFileBuffer::read_word()
+{
+    skip_whitespace();
+    const size_t start = position;
+    while (position < length && !std::isspace(static_cast<unsigned char>(data[position]))) ++position;
+    std::string word(data + start, position - start);
+
+    if (binary && position < length && data[position] == '\n') ++position;
+    return word;
+}
+
+unsigned long GmshFileBuffer::read_size()
+{
+    if (binary) {
+        size_t value;
+        read_bytes(&value, sizeof(size_t));
+        return value;
     }
-    for (unsigned int i = 0; i < n_curves; ++i) {
-        // parse curve ids
-
-        // we only care for 'tag' as key for tag_maps[1]
-        infile >> entity_tag >> box_min_x >> box_min_y >> box_min_z >> box_max_x >> box_max_y >> box_max_z >> n_physicals;
-        // if there is a physical tag, we will use it as boundary id below
-        AssertThrow(n_physicals < 2, dealii::ExcMessage("More than one tag is not supported!"));
-        // if there is no physical tag, use 0 as default
-        int physical_tag = 0;
-        for (unsigned int j = 0; j < n_physicals; ++j) {
-            infile >> physical_tag;
-        }
-        tag_maps[1][entity_tag] = physical_tag;
-        //std::cout << "Entity curve tag " << entity_tag << " with physical tag " << physical_tag << std::endl;
-        // we don't care about the points associated to a curve, but have
-        // to parse them anyway because their format is unstructured
-        infile >> n_points;
-        for (unsigned int j = 0; j < n_points; ++j) {
-            infile >> entity_tag;
-        }
+    char *end;
+    const unsigned long value = std::strtoul(data + position, &end, 10);
+    position = end - data;
+    return value;
+}
+
+int GmshFileBuffer::read_int()
+{
+    if (binary) {
+        int value;
+        read_bytes(&value, sizeof(int));
+        return value;
     }
-    for (unsigned int i = 0; i < n_surfaces; ++i) {
-        // parse surface ids
-
-        // we only care for 'tag' as key for tag_maps[2]
-        infile >> entity_tag >> box_min_x >> box_min_y >> box_min_z >> box_max_x >> box_max_y >> box_max_z >> n_physicals;
-        // if there is a physical tag, we will use it as boundary id below
-        AssertThrow(n_physicals < 2, dealii::ExcMessage("More than one tag is not supported!"));
-        // if there is no physical tag, use 0 as default
-        int physical_tag = 0;
-        for (unsigned int j = 0; j < n_physicals; ++j) {
-          infile >> physical_tag;
-        }
-        //std::cout << "Entity surface tag " << entity_tag << " with physical tag " << physical_tag << std::endl;
-        tag_maps[2][entity_tag] = physical_tag;
-        // we don't care about the curves associated to a surface, but
-        // have to parse them anyway because their format is unstructured
-        infile >> n_curves;
-        for (unsigned int j = 0; j < n_curves; ++j) {
-          infile >> entity_tag;
-        }
+    char *end;
+    const long value = std::strtol(data + position, &end, 10);
+    position = end - data;
+    return static_cast<int>(value);
+}
+
+double GmshFileBuffer::read_double()
+{
+    if (binary) {
+        double value;
+        read_bytes(&value, sizeof(double));
+        return value;
     }
-    for (unsigned int i = 0; i < n_volumes; ++i) {
-        // parse volume ids
-
-        // we only care for 'tag' as key for tag_maps[3]
-        infile >> entity_tag >> box_min_x >> box_min_y >> box_min_z >> box_max_x >> box_max_y >> box_max_z >> n_physicals;
-        // if there is a physical tag, we will use it as boundary id below
-        AssertThrow(n_physicals < 2,
-                    dealii::ExcMessage("More than one tag is not supported!"));
-        // if there is no physical tag, use 0 as default
-        int physical_tag = 0;
-        for (unsigned int j = 0; j < n_physicals; ++j) {
-            infile >> physical_tag;
-        }
-        //std::cout << "Entity volume tag " << entity_tag << " with physical tag " << physical_tag << std::endl;
-        tag_maps[3][entity_tag] = physical_tag;
-        // we don't care about the surfaces associated to a volume, but
-        // have to parse them anyway because their format is unstructured
-        infile >> n_surfaces;
-        for (unsigned int j = 0; j < n_surfaces; ++j) {
-            infile >> entity_tag;
+    char *end;
+    const double value = std::strtod(data + position, &end);
+    position = end - data;
+    return value;
+}
+
+void GmshFileBuffer::read_sizes(std::vector<unsigned long> &values, const unsigned long n_values)
+{
+    values.resize(n_values);
+    if (binary) {
+        static_assert(sizeof(unsigned long) == sizeof(size_t), "Gmsh binary sizes are read as unsigned long.");
+        read_bytes(values.data(), n_values*sizeof(size_t));
+        return;
+    }
+    for (unsigned long i = 0; i < n_values; ++i) values[i] = read_size();
+}
+
+void GmshFileBuffer::read_doubles(std::vector<double> &values, const unsigned long n_values)
+{
+    values.resize(n_values);
+    if (binary) {
+        read_bytes(values.data(), n_values*sizeof(double));
+        return;
+    }
+    for (unsigned long i = 0; i < n_values; ++i) values[i] = read_double();
+}
+
+/// Reads the physical tag list of an entity, and returns the tag. 0 if none.
+int read_gmsh_physical_tag(GmshFileBuffer &infile)
+{
+    const unsigned long n_physicals = infile.read_size();
+    // if there is a physical tag, we will use it as boundary id below
+    AssertThrow(n_physicals < 2, dealii::ExcMessage("More than one tag is not supported!"));
+    // if there is no physical tag, use 0 as default
+    int physical_tag = 0;
+    for (unsigned long j = 0; j < n_physicals; ++j) {
+        physical_tag = infile.read_int();
+    }
+    return physical_tag;
+}
+
+void read_gmsh_entities(GmshFileBuffer &infile, std::array<std::map<int, int>, 4> &tag_maps)
+{
+    // if the next block is of kind $Entities, parse it
+    unsigned long n_entities[4];
+    for (int d = 0; d < 4; ++d) {
+        n_entities[d] = infile.read_size();
+    }
+
+    for (int entity_dim = 0; entity_dim < 4; ++entity_dim) {
+        for (unsigned long i = 0; i < n_entities[entity_dim]; ++i) {
+            // we only care for 'tag' as key for tag_maps[entity_dim]
+            const int entity_tag = infile.read_int();
+
+            // points only have a location, others have a bounding box
+            const unsigned int n_box_values = (entity_dim == 0) ? 3 : 6;
+            for (unsigned int b = 0; b < n_box_values; ++b) {
+                infile.read_double();
+            }
+
+            tag_maps[entity_dim][entity_tag] = read_gmsh_physical_tag(infile);
+
+            // we don't care about the lower dimensional entities bounding this one, 
+            // but have to parse them anyway because their format is unstructured
+            if (entity_dim > 0) {
+                const unsigned long n_bounding = infile.read_size();
+                for (unsigned long j = 0; j < n_bounding; ++j) {
+                    infile.read_int();
+                }
+            }
         }
     }
-    infile >> line;
+    const std::string line = infile.read_word();
     //AssertThrow(line == "$EndEntities", PHiLiP::ExcInvalidGMSHInput(line));
+    (void) line;
 }
 
+/// Reads the $Nodes section.
+/** The map from Gmsh node tags to the vertices vector is stored as a dense array
+  * indexed by the node tag. Unused tags are set to dealii::numbers::invalid_unsigned_int.
+  */
 template<int spacedim>
-void read_gmsh_nodes( std::ifstream &infile, std::vector<dealii::Point<spacedim>> &vertices, std::map<int, int> &vertex_indices )
+void read_gmsh_nodes( GmshFileBuffer &infile, std::vector<dealii::Point<spacedim>> &vertices, std::vector<unsigned int> &vertex_indices )
 {
-    std::string  line;
     // now read the nodes list
-    unsigned int n_entity_blocks, n_vertices;
-    int min_node_tag;
-    int max_node_tag;
-    infile >> n_entity_blocks >> n_vertices >> min_node_tag >> max_node_tag;
+    const unsigned long n_entity_blocks = infile.read_size();
+    const unsigned long n_vertices      = infile.read_size();
+    const unsigned long min_node_tag    = infile.read_size();
+    const unsigned long max_node_tag    = infile.read_size();
+    (void) min_node_tag;
     std::cout << "Reading nodes..." << std::endl;
     //std::cout << "Number of entity blocks: " << n_entity_blocks << " with a total of " << n_vertices << " vertices." << std::endl;
 
     vertices.resize(n_vertices);
-  
-    unsigned int global_vertex = 0;
-    for (unsigned int entity_block = 0; entity_block < n_entity_blocks; ++entity_block) {
-        int           parametric;
-        unsigned long numNodes;
+    vertex_indices.assign(max_node_tag+1, dealii::numbers::invalid_unsigned_int);
 
-        // for gmsh_file_format 4.1 the order of tag and dim is reversed,
-        // but we are ignoring both anyway.
-        int tagEntity, dimEntity;
-        infile >> tagEntity >> dimEntity >> parametric >> numNodes;
+    std::vector<unsigned long> vertex_numbers;
+    std::vector<double> coordinates;
+
+    unsigned int global_vertex = 0;
+    for (unsigned long entity_block = 0; entity_block < n_entity_blocks; ++entity_block) {
+        const int dimEntity = infile.read_int();
+        const int tagEntity = infile.read_int();
+        const int parametric = infile.read_int();
+        const unsigned long numNodes = infile.read_size();
+        (void) tagEntity;
 
         //std::cout << "Entity block: " << entity_block << " with tag " << tagEntity << " in " << dimEntity << " dimension with " << numNodes << " nodes. Parametric: " << parametric << std::endl;
 
-        std::vector<int> vertex_numbers;
+        infile.read_sizes(vertex_numbers, numNodes);
 
-        for (unsigned long vertex_per_entity = 0; vertex_per_entity < numNodes; ++vertex_per_entity) {
-            int vertex_number;
-            infile >> vertex_number;
-            //std::cout << vertex_number << std::endl;
-            vertex_numbers.push_back(vertex_number);
+        // ignore parametric coordinates
+        int n_parametric = 0;
+        if (parametric != 0) {
+            n_parametric = dimEntity;
+            if (dimEntity == 0) n_parametric = 1;
         }
+        const unsigned int values_per_node = 3 + n_parametric;
+        infile.read_doubles(coordinates, numNodes*values_per_node);
 
         for (unsigned long vertex_per_entity = 0; vertex_per_entity < numNodes; ++vertex_per_entity, ++global_vertex) {
             // read vertex
-            double x[3];
-            infile >> x[0] >> x[1] >> x[2];
-            //std::cout << x[0] << " " << x[1] << " " << x[2] << " ";
-            //if (parametric == 0) std::cout << std::endl;
-
-
+            const double *x = &coordinates[vertex_per_entity*values_per_node];
             for (unsigned int d = 0; d < spacedim; ++d) {
                 vertices[global_vertex](d) = x[d];
             }
 
-            int vertex_number;
-            vertex_number = vertex_numbers[vertex_per_entity];
             // store mapping
-            vertex_indices[vertex_number] = global_vertex;
-
-
-            // ignore parametric coordinates
-            if (parametric != 0) {
-                int n_parametric = dimEntity;
-                if (dimEntity == 0) n_parametric = 1;
-                double uvw[3];
-                for (int d=0; d<n_parametric; ++d) {
-                    infile >> uvw[d];
-                    //std::cout << uvw[d] << " ";
-
-                }
-                //std::cout << std::endl;
-                (void)uvw;
-            }
+            AssertIndexRange(vertex_numbers[vertex_per_entity], vertex_indices.size());
+            vertex_indices[vertex_numbers[vertex_per_entity]] = global_vertex;
         }
     }
     AssertDimension(global_vertex, n_vertices);
@@ -345,28 +461,27 @@ unsigned int gmsh_cell_type_to_order(unsigned int cell_type)
 }
 
 template<int dim>
-unsigned int find_grid_order(std::ifstream &infile)
+unsigned int find_grid_order(GmshFileBuffer &infile)
 {
-    auto entity_file_position = infile.tellg();
+    const size_t entity_file_position = infile.tell();
 
     unsigned int grid_order = 0;
 
-    unsigned int n_entity_blocks, n_cells;
-    int min_ele_tag, max_ele_tag;
-    infile >> n_entity_blocks >> n_cells >> min_ele_tag >> max_ele_tag;
+    const unsigned long n_entity_blocks = infile.read_size();
+    const unsigned long n_cells = infile.read_size();
+    infile.read_size(); // min_ele_tag
+    infile.read_size(); // max_ele_tag
 
     std::cout << "Finding grid order..." << std::endl;
     std::cout << n_entity_blocks << " entity blocks with a total of " << n_cells << " cells. " << std::endl;
 
-    std::vector<unsigned int> vertices_id;
-
-    unsigned int global_cell = 0;
-    for (unsigned int entity_block = 0; entity_block < n_entity_blocks; ++entity_block) {
-        unsigned long numElements;
-        int           cell_type;
-
-        int tagEntity, dimEntity;
-        infile >> dimEntity >> tagEntity >> cell_type >> numElements;
+    unsigned long global_cell = 0;
+    for (unsigned long entity_block = 0; entity_block < n_entity_blocks; ++entity_block) {
+        const int dimEntity = infile.read_int();
+        const int tagEntity = infile.read_int();
+        const int cell_type = infile.read_int();
+        const unsigned long numElements = infile.read_size();
+        (void) tagEntity;
         //std::cout << "Entity block " << entity_block << " of dimension " << dimEntity << " with tag " << tagEntity << " and celltype = " << cell_type << " containing " << numElements << " elements. " << std::endl;
 
         const unsigned int cell_order = gmsh_cell_type_to_order(cell_type);
@@ -374,23 +489,21 @@ unsigned int find_grid_order(std::ifstream &infile)
 
         grid_order = std::max(cell_order, grid_order);
 
-        vertices_id.resize(nodes_per_element);
-
-        for (unsigned int cell_per_entity = 0; cell_per_entity < numElements; ++cell_per_entity, ++global_cell) {
-            // note that since infile the input file we found the number of p1_cells at the top, there
-            // should still be input here, so check this:
-            AssertThrow(infile, dealii::ExcIO());
-
-            int tag;
-            infile >> tag;
-
-            for (unsigned int i = 0; i < nodes_per_element; ++i) {
-                infile >> vertices_id[i];
+        // Skip the element block: one tag followed by the nodes of each element
+        if (infile.binary) {
+            infile.seek(infile.tell() + numElements * (1 + nodes_per_element) * sizeof(size_t));
+        } else {
+            for (unsigned long i = 0; i < numElements * (1 + nodes_per_element); ++i) {
+                infile.read_size();
             }
-        } // End of cell per entity
+        }
+        global_cell += numElements;
+        // note that since infile the input file we found the number of p1_cells at the top, there
+        // should still be input here, so check this:
+        AssertThrow(infile.good(), dealii::ExcIO());
     } // End of entity block
 
-    infile.seekg(entity_file_position);
+    infile.seek(entity_file_position);
 
     AssertDimension(global_cell, n_cells);
     std::cout << "Found grid order = " << grid_order << std::endl;
@@ -630,34 +743,21 @@ void fe_q_node_number(const unsigned int index,
     k = index;
 }
 
+/// Parses the Gmsh file on the current processor.
+/** Fills the linear (p1) description of the cells and boundary faces, as well as all
+  * the nodes of the file and the high-order node indices of every cell, stored contiguously
+  * in Gmsh's hierarchic ordering. Returns the grid order.
+  */
 template <int dim, int spacedim>
-std::shared_ptr< HighOrderGrid<dim, double> >
-read_gmsh(std::string filename, int requested_grid_order)
+unsigned int parse_gmsh_file(
+    const std::string &                                  filename,
+    std::vector<dealii::Point<spacedim>> &               all_vertices,
+    std::vector<dealii::CellData<dim>> &                 p1_cells,
+    std::vector<unsigned int> &                          high_order_cells_vertices,
+    dealii::SubCellData &                                subcelldata,
+    std::map<unsigned int, dealii::types::boundary_id> & boundary_ids_1d)
 {
-
-    //for (unsigned int deg = 1; deg < 7; ++deg) {
-    //    std::cout << "DEGREE " << deg << std::endl;
-    //    std::vector<unsigned int> h2l = gmsh_hierarchic_to_lexicographic<dim>(deg);
-    //    std::vector<unsigned int> l2h = dealii::Utilities::invert_permutation(h2l);
-
-    //    unsigned int n = deg+1;
-    //    std::cout << "L2H "  << std::endl;
-    //    for (int j=n-1; j>=0; --j) {
-    //        for (unsigned int i=0; i<n; ++i) {
-    //            const unsigned int ij = ij_to_num(i,j,n);
-    //            std::cout << l2h[ij] << " ";
-    //        }
-    //        std::cout << std::endl;
-    //    }
-
-    //    std::cout << std::endl << std::endl;
-    //}
-    //std::abort();
-
-    Assert(dim==2, dealii::ExcInternalError());
-    std::ifstream infile;
-
-    open_file_toRead(filename, infile);
+    GmshFileBuffer infile(filename);
   
     std::string  line;
     // This array stores maps from the 'entities' to the 'physical tags' for
@@ -665,10 +765,7 @@ read_gmsh(std::string filename, int requested_grid_order)
     // assign boundary ids.
     std::array<std::map<int, int>, 4> tag_maps;
   
-  
-    infile >> line;
-  
-    //Assert(tria != nullptr, dealii::ExcNoTriangulationSelected());
+    line = infile.read_word();
   
     // first determine file format
     unsigned int gmsh_file_format = 0;
@@ -678,49 +775,54 @@ read_gmsh(std::string filename, int requested_grid_order)
       //AssertThrow(false, dealii::ExcInvalidGMSHInput(line));
     }
   
-  
     // if file format is 2.0 or greater then we also have to read the rest of the
     // header
     if (gmsh_file_format == 20) {
-        double       version;
-        unsigned int file_type, data_size;
-  
-        infile >> version >> file_type >> data_size;
+        const double version = std::stod(infile.read_word());
+        const unsigned int file_type = std::stoi(infile.read_word());
   
         Assert((version == 4.1), dealii::ExcNotImplemented());
         gmsh_file_format = static_cast<unsigned int>(version * 10);
   
-  
-        Assert(file_type == 0, dealii::ExcNotImplemented());
+        Assert(file_type == 0 || file_type == 1, dealii::ExcNotImplemented());
+        infile.binary = (file_type == 1);
+
+        const unsigned int data_size = std::stoi(infile.read_word());
         Assert(data_size == sizeof(double), dealii::ExcNotImplemented());
-  
+        (void) data_size;
+
+        // binary files store the integer 1 to detect endianness
+        if (infile.binary) {
+            const int one = infile.read_int();
+            AssertThrow(one == 1, dealii::ExcMessage("Gmsh binary file has a different endianness."));
+            (void) one;
+        }
   
         // read the end of the header and the first line of the nodes description
         // to synch ourselves with the format 1 handling above
-        infile >> line;
+        line = infile.read_word();
         //AssertThrow(line == "$EndMeshFormat", PHiLiP::ExcInvalidGMSHInput(line));
   
-  
-        infile >> line;
+        line = infile.read_word();
         // if the next block is of kind $PhysicalNames, ignore it
         if (line == "$PhysicalNames") {
             do {
-                infile >> line;
+                line = infile.read_word();
             } while (line != "$EndPhysicalNames");
-            infile >> line;
+            line = infile.read_word();
         }
   
-  
         // if the next block is of kind $Entities, parse it
         if (line == "$Entities") read_gmsh_entities(infile, tag_maps);
-        infile >> line;
+        line = infile.read_word();
   
         // if the next block is of kind $PartitionedEntities, ignore it
         if (line == "$PartitionedEntities") {
+            AssertThrow(!infile.binary, dealii::ExcNotImplemented());
             do {
-                infile >> line;
+                line = infile.read_word();
             } while (line != "$EndPartitionedEntities");
-            infile >> line;
+            line = infile.read_word();
         }
   
         // but the next thing should,
@@ -729,91 +831,83 @@ read_gmsh(std::string filename, int requested_grid_order)
         //AssertThrow(line == "$Nodes", PHiLiP::ExcInvalidGMSHInput(line));
     }
   
-    std::vector<dealii::Point<spacedim>> vertices;
     // set up mapping between numbering
     // infile msh-file (nod) and infile the
     // vertices vector
-    std::map<int, int> vertex_indices;
-    read_gmsh_nodes( infile, vertices, vertex_indices );
+    std::vector<unsigned int> vertex_indices;
+    read_gmsh_nodes( infile, all_vertices, vertex_indices );
   
     // Assert we reached the end of the block
-    infile >> line;
+    line = infile.read_word();
     static const std::string end_nodes_marker = "$EndNodes";
     //AssertThrow(line == end_nodes_marker, PHiLiP::ExcInvalidGMSHInput(line));
   
     // Now read infile next bit
-    infile >> line;
+    line = infile.read_word();
     static const std::string begin_elements_marker = "$Elements";
     //AssertThrow(line == begin_elements_marker, PHiLiP::ExcInvalidGMSHInput(line));
 
     const unsigned int grid_order = find_grid_order<dim>(infile);
+    const unsigned int nodes_per_cell = dealii::Utilities::fixed_power<dim>(grid_order + 1);
   
-    using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
-    std::shared_ptr<Triangulation> triangulation = std::make_shared<Triangulation>(
-        MPI_COMM_WORLD,
-        typename dealii::Triangulation<dim>::MeshSmoothing(
-            dealii::Triangulation<dim>::smoothing_on_refinement |
-            dealii::Triangulation<dim>::smoothing_on_coarsening));
-
-    auto high_order_grid = std::make_shared<HighOrderGrid<dim, double>>(grid_order, triangulation);
-  
-    unsigned int n_entity_blocks, n_cells;
-    int min_ele_tag, max_ele_tag;
-    infile >> n_entity_blocks >> n_cells >> min_ele_tag >> max_ele_tag;
+    const unsigned long n_entity_blocks = infile.read_size();
+    const unsigned long n_cells = infile.read_size();
+    infile.read_size(); // min_ele_tag
+    infile.read_size(); // max_ele_tag
     // set up array of p1_cells and subcells (faces). In 1d, there is currently no
     // standard way infile deal.II to pass boundary indicators attached to individual
     // vertices, so do this by hand via the boundary_ids_1d array
 
-    std::vector<dealii::CellData<dim>> p1_cells;
-    std::vector<dealii::CellData<dim>> high_order_cells;
-    dealii::CellData<dim> temp_high_order_cells;
-
-    dealii::SubCellData                                subcelldata;
-    std::map<unsigned int, dealii::types::boundary_id> boundary_ids_1d;
+    const auto to_vertex_index = [&vertex_indices](const unsigned long node_tag) {
+        return (node_tag < vertex_indices.size()) ? vertex_indices[node_tag] : dealii::numbers::invalid_unsigned_int;
+    };
 
+    std::vector<unsigned long> element_block;
   
-  
-    unsigned int global_cell = 0;
-    for (unsigned int entity_block = 0; entity_block < n_entity_blocks; ++entity_block) {
-        unsigned int  material_id;
-        unsigned long numElements;
-        int           cell_type;
-
+    unsigned long global_cell = 0;
+    for (unsigned long entity_block = 0; entity_block < n_entity_blocks; ++entity_block) {
         // for gmsh_file_format 4.1 the order of tag and dim is reversed,
-        int tagEntity, dimEntity;
-        infile >> dimEntity >> tagEntity >> cell_type >> numElements;
-        material_id = tag_maps[dimEntity][tagEntity];
+        const int dimEntity = infile.read_int();
+        const int tagEntity = infile.read_int();
+        const int cell_type = infile.read_int();
+        const unsigned long numElements = infile.read_size();
+        const unsigned int material_id = tag_maps[dimEntity][tagEntity];
 
         const unsigned int cell_order = gmsh_cell_type_to_order(cell_type);
 
-        unsigned int vertices_per_element = std::pow(2, dimEntity);
-        unsigned int nodes_per_element = std::pow(cell_order + 1, dimEntity);
+        const unsigned int vertices_per_element = std::pow(2, dimEntity);
+        const unsigned int nodes_per_element = std::pow(cell_order + 1, dimEntity);
+
+        // Read the whole block at once: one tag followed by the nodes of each element
+        const unsigned int stride = 1 + nodes_per_element;
+        infile.read_sizes(element_block, numElements*stride);
 
+        if (dimEntity == dim) {
+            p1_cells.reserve(p1_cells.size() + numElements);
+            high_order_cells_vertices.reserve(high_order_cells_vertices.size() + numElements*nodes_per_cell);
+            AssertDimension(nodes_per_element, nodes_per_cell);
+        }
 
-        for (unsigned int cell_per_entity = 0; cell_per_entity < numElements; ++cell_per_entity, ++global_cell) {
+        for (unsigned long cell_per_entity = 0; cell_per_entity < numElements; ++cell_per_entity, ++global_cell) {
 
             // ignore tag
-            int tag;
-            infile >> tag;
+            const unsigned long *element_nodes = &element_block[cell_per_entity*stride + 1];
 
             if (dimEntity == dim) {
                 // Found a cell
 
-                // Allocate and read indices
+                // Allocate and transform from gmsh to consecutive numbering
                 p1_cells.emplace_back(vertices_per_element);
-                high_order_cells.emplace_back(vertices_per_element);
-
                 auto &p1_vertices_id = p1_cells.back().vertices;
-                auto &high_order_vertices_id = high_order_cells.back().vertices;
-
                 p1_vertices_id.resize(vertices_per_element);
-                high_order_vertices_id.resize(nodes_per_element);
 
                 for (unsigned int i = 0; i < nodes_per_element; ++i) {
-                    infile >> high_order_vertices_id[i];
+                    const unsigned int vertex = to_vertex_index(element_nodes[i]);
+                    Assert(vertex != dealii::numbers::invalid_unsigned_int, dealii::ExcInternalError());
+                    high_order_cells_vertices.push_back(vertex);
                 }
                 for (unsigned int i = 0; i < vertices_per_element; ++i) {
-                    p1_vertices_id[i] = high_order_vertices_id[i];
+                    p1_vertices_id[i] = to_vertex_index(element_nodes[i]);
                 }
 
                 // to make sure that the cast won't fail
@@ -824,32 +918,12 @@ read_gmsh(std::string filename, int requested_grid_order)
 
                 p1_cells.back().material_id = material_id;
 
-                // transform from ucd to consecutive numbering
-                for (unsigned int i = 0; i < vertices_per_element; ++i) {
-                    //AssertThrow( vertex_indices.find(p1_cells.back().vertices[i]) != vertex_indices.end(),
-                    //  dealii::ExcInvalidVertexIndexGmsh(global_cell, elm_number, p1_cells.back().vertices[i]));
-
-                    // vertex with this index exists
-                    p1_vertices_id[i] = vertex_indices[p1_cells.back().vertices[i]];
-                }
-                for (unsigned int i = 0; i < nodes_per_element; ++i) {
-                    high_order_vertices_id[i] = vertex_indices[high_order_cells.back().vertices[i]];
-                }
             } else if (dimEntity == 1 && dimEntity < dim) {
                 // Boundary info
                 subcelldata.boundary_lines.emplace_back(vertices_per_element);
                 auto &p1_vertices_id = subcelldata.boundary_lines.back().vertices;
                 p1_vertices_id.resize(vertices_per_element);
 
-                temp_high_order_cells.vertices.resize(nodes_per_element);
-
-                for (unsigned int i = 0; i < nodes_per_element; ++i) {
-                    infile >> temp_high_order_cells.vertices[i];
-                }
-                for (unsigned int i = 0; i < vertices_per_element; ++i) {
-                    p1_vertices_id[i] = temp_high_order_cells.vertices[i];
-                }
-
                 // to make sure that the cast won't fail
                 Assert(material_id <= std::numeric_limits<dealii::types::boundary_id>::max(),
                        dealii::ExcIndexRange( material_id, 0, std::numeric_limits<dealii::types::boundary_id>::max()));
@@ -859,13 +933,11 @@ read_gmsh(std::string filename, int requested_grid_order)
                 subcelldata.boundary_lines.back().boundary_id = static_cast<dealii::types::boundary_id>(material_id);
 
                 // transform from ucd to consecutive numbering
-                for (unsigned int &vertex : subcelldata.boundary_lines.back().vertices) {
-                    if (vertex_indices.find(vertex) != vertex_indices.end()) {
-                      vertex = vertex_indices[vertex];
-                    } else {
+                for (unsigned int i = 0; i < vertices_per_element; ++i) {
+                    p1_vertices_id[i] = to_vertex_index(element_nodes[i]);
+                    if (p1_vertices_id[i] == dealii::numbers::invalid_unsigned_int) {
                         // no such vertex index
                         //AssertThrow(false, dealii::ExcInvalidVertexIndex(cell_per_entity, vertex));
-                        vertex = dealii::numbers::invalid_unsigned_int;
                         std::abort();
                     }
                 }
@@ -875,15 +947,6 @@ read_gmsh(std::string filename, int requested_grid_order)
                 auto &p1_vertices_id = subcelldata.boundary_quads.back().vertices;
                 p1_vertices_id.resize(vertices_per_element);
 
-                temp_high_order_cells.vertices.resize(nodes_per_element);
-
-                for (unsigned int i = 0; i < nodes_per_element; ++i) {
-                    infile >> temp_high_order_cells.vertices[i];
-                }
-                for (unsigned int i = 0; i < vertices_per_element; ++i) {
-                    p1_vertices_id[i] = temp_high_order_cells.vertices[i];
-                }
-
                 // to make sure that the cast won't fail
                 Assert(material_id <= std::numeric_limits<dealii::types::boundary_id>::max(),
                        dealii::ExcIndexRange( material_id, 0, std::numeric_limits<dealii::types::boundary_id>::max()));
@@ -893,24 +956,18 @@ read_gmsh(std::string filename, int requested_grid_order)
                 subcelldata.boundary_quads.back().boundary_id = static_cast<dealii::types::boundary_id>(material_id);
 
                 // transform from gmsh to consecutive numbering
-                for (unsigned int &vertex : subcelldata.boundary_quads.back().vertices) {
-                    if (vertex_indices.find(vertex) != vertex_indices.end()) {
-                      vertex = vertex_indices[vertex];
-                    } else {
-                        // no such vertex index
-                        //Assert(false, dealii::ExcInvalidVertexIndex(cell_per_entity, vertex));
-                        vertex = dealii::numbers::invalid_unsigned_int;
-                    }
+                for (unsigned int i = 0; i < vertices_per_element; ++i) {
+                    // no such vertex index is left as invalid
+                    p1_vertices_id[i] = to_vertex_index(element_nodes[i]);
                 }
             } else if (cell_type == MSH_PNT) {
               // read the indices of nodes given
-              unsigned int node_index = 0;
-              infile >> node_index;
+              const unsigned long node_index = element_nodes[0];
 
               // We only care about boundary indicators assigned to individual
               // vertices infile 1d (because otherwise the vertices are not faces)
               if (dim == 1) {
-                  boundary_ids_1d[vertex_indices[node_index]] = material_id;
+                  boundary_ids_1d[to_vertex_index(node_index)] = material_id;
               }
             } else {
               //AssertThrow(false, dealii::ExcGmshUnsupportedGeometry(cell_type));
@@ -920,7 +977,7 @@ read_gmsh(std::string filename, int requested_grid_order)
     AssertDimension(global_cell, n_cells);
 
     // Assert we reached the end of the block
-    infile >> line;
+    line = infile.read_word();
     static const std::string end_elements_marker[] = {"$ENDELM", "$EndElements"};
     //AssertThrow(line == end_elements_marker[gmsh_file_format == 10 ? 0 : 1],
     //            PHiLiP::ExcInvalidGMSHInput(line));
@@ -928,22 +985,205 @@ read_gmsh(std::string filename, int requested_grid_order)
     // check that no forbidden arrays are used
     Assert(subcelldata.check_consistency(dim), dealii::ExcInternalError());
   
-  
-    AssertThrow(infile, dealii::ExcIO());
-  
+    AssertThrow(infile.good(), dealii::ExcIO());
   
     // // check that we actually read some p1_cells.
     // AssertThrow(p1_cells.size() > 0, dealii::ExcGmshNoCellInformation());
-  
-    // do some clean-up on vertices...
-    auto all_vertices = vertices;
-    dealii::GridTools::delete_unused_vertices(vertices, p1_cells, subcelldata);
-    // ... and p1_cells
-    if (dim == spacedim) {
-      dealii::GridReordering<dim, spacedim>::invert_all_cells_of_negative_grid(vertices, p1_cells);
+
+    return grid_order;
+}
+
+/// Broadcast a contiguous vector from the root processor.
+template <typename T>
+void broadcast_vector(std::vector<T> &values, const MPI_Datatype mpi_type)
+{
+    unsigned long n_values = values.size();
+    MPI_Bcast(&n_values, 1, MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
+    values.resize(n_values);
+    if (n_values > 0) MPI_Bcast(values.data(), n_values, mpi_type, 0, MPI_COMM_WORLD);
+}
+
+/// Broadcast the coarse (linear) grid description parsed by the root processor.
+/** Only the vertices used by the linear cells are sent, the high-order nodes stay on the root processor.
+  * Cells and boundary faces are packed into flat arrays of vertex indices followed by their material/boundary id.
+  */
+template <int dim, int spacedim>
+void broadcast_coarse_grid(
+    unsigned int &                                       grid_order,
+    std::vector<dealii::Point<spacedim>> &               vertices,
+    std::vector<dealii::CellData<dim>> &                 p1_cells,
+    dealii::SubCellData &                                subcelldata,
+    std::map<unsigned int, dealii::types::boundary_id> & boundary_ids_1d)
+{
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+    MPI_Bcast(&grid_order, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+
+    // Vertices
+    std::vector<double> packed_vertices;
+    if (mpi_rank == 0) {
+        packed_vertices.reserve(vertices.size()*spacedim);
+        for (const auto &vertex : vertices) {
+            for (int d = 0; d < spacedim; ++d) packed_vertices.push_back(vertex[d]);
+        }
+    }
+    broadcast_vector(packed_vertices, MPI_DOUBLE);
+    vertices.resize(packed_vertices.size() / spacedim);
+    for (unsigned int i = 0; i < vertices.size(); ++i) {
+        for (int d = 0; d < spacedim; ++d) vertices[i][d] = packed_vertices[i*spacedim + d];
+    }
+    packed_vertices.clear();
+
+    // Cells and boundary faces
+    const auto pack = [](const auto &cells, std::vector<unsigned int> &packed) {
+        for (const auto &cell : cells) {
+            packed.insert(packed.end(), cell.vertices.begin(), cell.vertices.end());
+            packed.push_back(cell.material_id);
+        }
+    };
+    const auto unpack = [](const std::vector<unsigned int> &packed, const unsigned int n_vertices, auto &cells) {
+        const unsigned int stride = n_vertices + 1;
+        cells.resize(packed.size() / stride);
+        for (unsigned int icell = 0; icell < cells.size(); ++icell) {
+            cells[icell].vertices.assign(packed.begin() + icell*stride, packed.begin() + icell*stride + n_vertices);
+            cells[icell].material_id = packed[icell*stride + n_vertices];
+        }
+    };
+
+    std::vector<unsigned int> packed_cells, packed_lines, packed_quads;
+    if (mpi_rank == 0) {
+        pack(p1_cells, packed_cells);
+        pack(subcelldata.boundary_lines, packed_lines);
+        pack(subcelldata.boundary_quads, packed_quads);
+    }
+    broadcast_vector(packed_cells, MPI_UNSIGNED);
+    broadcast_vector(packed_lines, MPI_UNSIGNED);
+    broadcast_vector(packed_quads, MPI_UNSIGNED);
+    if (mpi_rank != 0) {
+        unpack(packed_cells, dealii::GeometryInfo<dim>::vertices_per_cell, p1_cells);
+        unpack(packed_lines, 2, subcelldata.boundary_lines);
+        unpack(packed_quads, 4, subcelldata.boundary_quads);
     }
-    dealii::GridReordering<dim, spacedim>::reorder_cells(p1_cells);
+
+    // 1D boundary vertices
+    std::vector<unsigned int> packed_boundary_ids_1d;
+    if (mpi_rank == 0) {
+        for (const auto &boundary_id : boundary_ids_1d) {
+            packed_boundary_ids_1d.push_back(boundary_id.first);
+            packed_boundary_ids_1d.push_back(boundary_id.second);
+        }
+    }
+    broadcast_vector(packed_boundary_ids_1d, MPI_UNSIGNED);
+    for (unsigned int i = 0; i < packed_boundary_ids_1d.size(); i += 2) {
+        boundary_ids_1d[packed_boundary_ids_1d[i]] = packed_boundary_ids_1d[i+1];
+    }
+}
+
+/// Sends the high-order nodes of the locally owned cells from the root processor.
+/** Each processor gathers the (global) coarse cell indices it owns on the root processor, 
+  * which is the only one holding the high-order nodes. The root processor then scatters
+  * their coordinates back, in Gmsh's hierarchic ordering. Therefore, the peak memory of
+  * the other processors only scales with their number of locally owned cells.
+  */
+template <int spacedim>
+std::vector<dealii::Point<spacedim>> scatter_high_order_nodes(
+    const std::vector<unsigned int> &            locally_owned_cells,
+    const unsigned int                           nodes_per_cell,
+    const std::vector<dealii::Point<spacedim>> & all_vertices,
+    const std::vector<unsigned int> &            high_order_cells_vertices)
+{
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+    int n_locally_owned_cells = locally_owned_cells.size();
+    std::vector<int> n_cells_per_mpi(n_mpi);
+    MPI_Gather(&n_locally_owned_cells, 1, MPI_INT, n_cells_per_mpi.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    std::vector<int> cell_offsets(n_mpi, 0);
+    for (int i_mpi = 1; i_mpi < n_mpi; ++i_mpi) {
+        cell_offsets[i_mpi] = cell_offsets[i_mpi-1] + n_cells_per_mpi[i_mpi-1];
+    }
+    std::vector<unsigned int> requested_cells;
+    if (mpi_rank == 0) requested_cells.resize(cell_offsets[n_mpi-1] + n_cells_per_mpi[n_mpi-1]);
+    MPI_Gatherv(locally_owned_cells.data(), n_locally_owned_cells, MPI_UNSIGNED,
+                requested_cells.data(), n_cells_per_mpi.data(), cell_offsets.data(), MPI_UNSIGNED,
+                0, MPI_COMM_WORLD);
+
+    const int values_per_cell = nodes_per_cell * spacedim;
+    std::vector<double> packed_nodes;
+    std::vector<int> n_values_per_mpi(n_mpi), value_offsets(n_mpi);
+    if (mpi_rank == 0) {
+        packed_nodes.reserve(requested_cells.size() * values_per_cell);
+        for (const unsigned int icell : requested_cells) {
+            for (unsigned int inode = 0; inode < nodes_per_cell; ++inode) {
+                const dealii::Point<spacedim> &node = all_vertices[high_order_cells_vertices[icell*nodes_per_cell + inode]];
+                for (int d = 0; d < spacedim; ++d) packed_nodes.push_back(node[d]);
+            }
+        }
+        for (int i_mpi = 0; i_mpi < n_mpi; ++i_mpi) {
+            n_values_per_mpi[i_mpi] = n_cells_per_mpi[i_mpi] * values_per_cell;
+            value_offsets[i_mpi] = cell_offsets[i_mpi] * values_per_cell;
+        }
+    }
+
+    std::vector<double> local_packed_nodes(n_locally_owned_cells * values_per_cell);
+    MPI_Scatterv(packed_nodes.data(), n_values_per_mpi.data(), value_offsets.data(), MPI_DOUBLE,
+                 local_packed_nodes.data(), local_packed_nodes.size(), MPI_DOUBLE,
+                 0, MPI_COMM_WORLD);
+
+    std::vector<dealii::Point<spacedim>> local_nodes(n_locally_owned_cells * nodes_per_cell);
+    for (unsigned int inode = 0; inode < local_nodes.size(); ++inode) {
+        for (int d = 0; d < spacedim; ++d) local_nodes[inode][d] = local_packed_nodes[inode*spacedim + d];
+    }
+    return local_nodes;
+}
+
+template <int dim, int spacedim>
+std::shared_ptr< HighOrderGrid<dim, double> >
+read_gmsh(std::string filename, int requested_grid_order)
+{
+    Assert(dim==2, dealii::ExcInternalError());
+
+    const unsigned int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+    // Only the root processor parses the file and holds all the high-order nodes.
+    // The coarse grid is then broadcasted since every processor needs it to build
+    // the parallel::distributed::Triangulation.
+    unsigned int grid_order = 0;
+    std::vector<dealii::Point<spacedim>> vertices;
+    std::vector<dealii::Point<spacedim>> all_vertices;
+    std::vector<dealii::CellData<dim>> p1_cells;
+    std::vector<unsigned int> high_order_cells_vertices;
+
+    dealii::SubCellData                                subcelldata;
+    std::map<unsigned int, dealii::types::boundary_id> boundary_ids_1d;
+
+    if (mpi_rank == 0) {
+        grid_order = parse_gmsh_file<dim,spacedim>(filename, all_vertices, p1_cells, high_order_cells_vertices, subcelldata, boundary_ids_1d);
+
+        // do some clean-up on vertices...
+        vertices = all_vertices;
+        dealii::GridTools::delete_unused_vertices(vertices, p1_cells, subcelldata);
+        // ... and p1_cells
+        if (dim == spacedim) {
+          dealii::GridReordering<dim, spacedim>::invert_all_cells_of_negative_grid(vertices, p1_cells);
+        }
+        dealii::GridReordering<dim, spacedim>::reorder_cells(p1_cells);
+    }
+    broadcast_coarse_grid<dim,spacedim>(grid_order, vertices, p1_cells, subcelldata, boundary_ids_1d);
+  
+    using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+    std::shared_ptr<Triangulation> triangulation = std::make_shared<Triangulation>(
+        MPI_COMM_WORLD,
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+    auto high_order_grid = std::make_shared<HighOrderGrid<dim, double>>(grid_order, triangulation);
+
     triangulation->create_triangulation_compatibility(vertices, p1_cells, subcelldata);
+    p1_cells.clear();
+    p1_cells.shrink_to_fit();
 
     triangulation->repartition();
 
@@ -964,80 +1204,45 @@ read_gmsh(std::string filename, int requested_grid_order)
     std::vector<unsigned int> gmsh_h2l = gmsh_hierarchic_to_lexicographic<dim>(grid_order);
     std::vector<unsigned int> gmsh_l2h = dealii::Utilities::invert_permutation(gmsh_h2l);
 
-    // Visualize indexing
-    // for (unsigned int deg = 1; deg < 7; ++deg) {
-    //     std::cout << "DEGREE " << deg << std::endl;
-    //     {
-    //         std::vector<unsigned int> h2l = gmsh_hierarchic_to_lexicographic<dim>(deg);
-    //         std::vector<unsigned int> l2h = dealii::Utilities::invert_permutation(h2l);
-
-    //         unsigned int n = deg+1;
-    //         std::cout << "GMSH L2H "  << std::endl;
-    //         for (int j=n-1; j>=0; --j) {
-    //             for (unsigned int i=0; i<n; ++i) {
-    //                 const unsigned int ij = ij_to_num(i,j,n);
-    //                 std::cout << l2h[ij] << " ";
-    //             }
-    //             std::cout << std::endl;
-    //         }
-
-    //         std::cout << std::endl << std::endl;
-    //     }
-    //     {
-    //         std::vector<unsigned int> h2l = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(deg);
-    //         std::vector<unsigned int> l2h = dealii::Utilities::invert_permutation(h2l);
-
-    //         unsigned int n = deg+1;
-    //         std::cout << "DEAL L2H "  << std::endl;
-    //         for (int j=n-1; j>=0; --j) {
-    //             for (unsigned int i=0; i<n; ++i) {
-    //                 const unsigned int ij = ij_to_num(i,j,n);
-    //                 std::cout << l2h[ij] << " ";
-    //             }
-    //             std::cout << std::endl;
-    //         }
-
-    //         std::cout << std::endl << std::endl;
-    //     }
-    // }
-    // std::abort();
-
-    int icell = 0;
+    // Get the high-order nodes of the locally owned cells from the root processor
+    const unsigned int nodes_per_cell = dealii::Utilities::fixed_power<dim>(grid_order + 1);
+    std::vector<unsigned int> locally_owned_cells;
+    {
+        unsigned int icell = 0;
+        for (const auto &cell : high_order_grid->dof_handler_grid.active_cell_iterators()) {
+            if (cell->is_locally_owned()) locally_owned_cells.push_back(icell);
+            icell++;
+        }
+    }
+    const std::vector<dealii::Point<spacedim>> locally_owned_nodes
+        = scatter_high_order_nodes<spacedim>(locally_owned_cells, nodes_per_cell, all_vertices, high_order_cells_vertices);
+    all_vertices.clear();
+    all_vertices.shrink_to_fit();
+    high_order_cells_vertices.clear();
+    high_order_cells_vertices.shrink_to_fit();
+
+    std::vector<unsigned int> rotate_z90degree;
+    rotate_indices<dim>(rotate_z90degree, grid_order+1, 'Z');
+
+    int ilocal_cell = 0;
     std::vector<dealii::types::global_dof_index> dof_indices(high_order_grid->fe_system.dofs_per_cell);
+    std::vector<dealii::Point<spacedim>> high_order_vertices(nodes_per_cell);
 
-    //for (unsigned int i=0; i<all_vertices.size(); ++i) {
-    //    std::cout << " i " << i 
-    //              << " maps to global id " 
-    //              << " vertices high_order_vertices_id[i] << " point " << all_vertices[high_order_vertices_id[i]] << std::endl;
-    //}
     for (const auto &cell : high_order_grid->dof_handler_grid.active_cell_iterators()) {
         if (cell->is_locally_owned()) {
-            auto &high_order_vertices_id = high_order_cells[icell].vertices;
+            const dealii::Point<spacedim> *cell_nodes = &locally_owned_nodes[ilocal_cell*nodes_per_cell];
 
-            //for (unsigned int i=0; i<high_order_vertices_id.size(); ++i) {
-            //    std::cout << " I " << high_order_vertices_id[i] << " point " << all_vertices[high_order_vertices_id[i]] << std::endl;
-            //}
             cell->get_dof_indices(dof_indices);
 
-            //std::cout << " cell " << icell << " with vertices: " << std::endl;
-            //for (unsigned int i=0; i < cell->n_vertices(); ++i) {
-            //    std::cout << cell->vertex(i) << std::endl;
-            //}
-            //std::cout << " highordercell with vertices: " << std::endl;
-
-            std::vector<unsigned int> rotate_z90degree;
-            rotate_indices<dim>(rotate_z90degree, grid_order+1, 'Z');
-
             bool good_rotation = false;
 
-            auto high_order_vertices_id_lexico = high_order_vertices_id;
-            for (unsigned int ihierachic=0; ihierachic<high_order_vertices_id.size(); ++ihierachic) {
+            std::vector<dealii::Point<spacedim>> high_order_vertices_lexico(nodes_per_cell);
+            for (unsigned int ihierachic=0; ihierachic<nodes_per_cell; ++ihierachic) {
                 const unsigned int lexico_id = gmsh_h2l[ihierachic];
-                high_order_vertices_id_lexico[lexico_id] = high_order_vertices_id[ihierachic];
+                high_order_vertices_lexico[lexico_id] = cell_nodes[ihierachic];
             }
 
-            //auto high_order_vertices_id_rotated = high_order_cells[icell].vertices;
-            auto high_order_vertices_id_rotated = high_order_vertices_id_lexico;
+            auto high_order_vertices_rotated = high_order_vertices_lexico;
             for (int zr = 0; zr < 4; ++zr) {
                 
                 std::vector<int> matching(cell->n_vertices());
@@ -1046,16 +1251,11 @@ read_gmsh(std::string filename, int requested_grid_order)
                     const unsigned int base_index = i_vertex;
                     const unsigned int lexicographic_index = deal_h2l[base_index];
 
-                    //const unsigned int gmsh_hierarchical_index = gmsh_l2h[lexicographic_index];
-                    //const unsigned int vertex_id = high_order_vertices_id_rotated[gmsh_hierarchical_index];
-                    const unsigned int vertex_id = high_order_vertices_id_rotated[lexicographic_index];
-                    const dealii::Point<dim,double> high_order_vertex = all_vertices[vertex_id];
-                    //std::cout << high_order_vertex << std::endl;
+                    const dealii::Point<spacedim> &high_order_vertex = high_order_vertices_rotated[lexicographic_index];
 
                     bool found = false;
                     for (unsigned int i=0; i < cell->n_vertices(); ++i) {
                         if (cell->vertex(i) == high_order_vertex) {
-                            //std::cout << " cell vertex " << i << " matches HO vertex " << i_vertex << std::endl;
                             found = true;
                         }
                     }
@@ -1073,14 +1273,12 @@ read_gmsh(std::string filename, int requested_grid_order)
                 }
                 good_rotation = all_matching;
                 if (good_rotation) {
-                    //std::cout << "Found rotation cell..." << std::endl;
                     break;
                 }
 
-                //std::cout << "Rotating indices " << std::endl;
-                high_order_vertices_id = high_order_vertices_id_rotated;
-                for (unsigned int i=0; i<high_order_vertices_id.size(); ++i) {
-                    high_order_vertices_id_rotated[i] = high_order_vertices_id[rotate_z90degree[i]];
+                high_order_vertices = high_order_vertices_rotated;
+                for (unsigned int i=0; i<nodes_per_cell; ++i) {
+                    high_order_vertices_rotated[i] = high_order_vertices[rotate_z90degree[i]];
                 }
             }
             if (!good_rotation) {
@@ -1088,40 +1286,22 @@ read_gmsh(std::string filename, int requested_grid_order)
                 std::abort();
             } 
 
-
-
-            for (unsigned int i_vertex = 0; i_vertex < high_order_vertices_id.size(); ++i_vertex) {
+            for (unsigned int i_vertex = 0; i_vertex < nodes_per_cell; ++i_vertex) {
 
                 const unsigned int base_index = i_vertex;
                 const unsigned int lexicographic_index = deal_h2l[base_index];
-                //const unsigned int gmsh_hierarchical_index = gmsh_l2h[lexicographic_index];
-                //const unsigned int vertex_id = high_order_vertices_id[gmsh_hierarchical_index];
-                const unsigned int vertex_id = high_order_vertices_id_rotated[lexicographic_index];
-                const dealii::Point<dim,double> vertex = all_vertices[vertex_id];
-
-                //std::cout << "i_vertex " << i_vertex << " point: " << vertex << std::endl;
+                const dealii::Point<spacedim> &vertex = high_order_vertices_rotated[lexicographic_index];
 
                 for (int d = 0; d < dim; ++d) {
                     const unsigned int comp = d;
                     const unsigned int shape_index = high_order_grid->dof_handler_grid.get_fe().component_to_system_index(comp, base_index);
                     const unsigned int idof_global = dof_indices[shape_index];
 
-                    //std::cout << " icell " << icell
-                    //          << " i_vertex " << i_vertex
-                    //          << " i_dim " << d
-                    //          << " base_index " << base_index
-                    //          << " shape_index " << shape_index 
-                    //          << " idof_global " << idof_global
-                    //          << " lexicographic_index " << lexicographic_index
-                    //          //<< " gmsh_hierarchical_index " << gmsh_hierarchical_index
-                    //          << " vertex_id " << vertex_id
-                    //          << std::endl;
                     high_order_grid->volume_nodes[idof_global] = vertex[d];
                 }
-                //std::cout << std::endl;
             }
+            ilocal_cell++;
         }
-        icell++;
     }
     high_order_grid->volume_nodes.update_ghost_values();
     high_order_grid->ensure_conforming_mesh();
@@ -55,6 +55,11 @@ namespace PHiLiP {
     /** Can request to convert the input grid's order to the 
       * requested_grid_order, which will simply interpolate
       * the high-order nodes.
+      *
+      * Supports both the ASCII and binary flavours of the Gmsh 4.1 format.
+      * Only the root processor parses the (memory-mapped) file. The coarse grid
+      * is broadcasted to build the distributed triangulation, and each processor
+      * then only receives the high-order nodes of its locally owned cells.
       */
     template <int dim, int spacedim>
     std::shared_ptr< HighOrderGrid<dim, double> >
@@ -49,11 +49,15 @@ namespace PHiLiP {
 template <int dim, typename real, typename MeshType, typename VectorType, typename DoFHandlerType>
 unsigned int HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::nth_refinement=0;
 
+template <int dim, typename real, typename MeshType, typename VectorType, typename DoFHandlerType>
+unsigned long long HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::n_constructed_grids=0;
+
 template <int dim, typename real, typename MeshType, typename VectorType, typename DoFHandlerType>
 HighOrderGrid<dim,real,MeshType,VectorType,DoFHandlerType>::HighOrderGrid(
         const unsigned int max_degree,
         const std::shared_ptr<MeshType> triangulation_input)
     : max_degree(max_degree)
+    , grid_id(n_constructed_grids++)
     , triangulation(triangulation_input)
     , dof_handler_grid(*triangulation)
     , fe_q(max_degree) // The grid must be at least p1. A p0 solution required a p1 grid.
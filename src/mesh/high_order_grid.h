@@ -159,6 +159,12 @@ public:
     /// Maximum degree of the geometry polynomial representing the grid.
     const unsigned int max_degree;
 
+    /// Identifier unique to this HighOrderGrid.
+    /** Unlike the address of the object, it is never reused by a grid constructed later on,
+     *  and can therefore be used to key data cached for a given grid.
+     */
+    const unsigned long long grid_id;
+
     const std::shared_ptr<MeshType> triangulation; ///< Mesh
 
     /// Degrees of freedom handler for the high-order grid
@@ -394,6 +400,7 @@ public:
     dealii::IndexSet locally_relevant_dofs_grid; ///< Union of locally owned degrees of freedom and relevant ghost degrees of freedom for the grid
 
     static unsigned int nth_refinement; ///< Used to name the various files outputted.
+    static unsigned long long n_constructed_grids; ///< Number of grids constructed so far, used to assign grid_id.
 protected:
     int n_mpi; ///< Number of MPI processes.
     int mpi_rank; ///< This processor's MPI rank.
@@ -0,0 +1,51 @@
+#include <numeric>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+
+#include "meshmover_base.hpp"
+
+namespace PHiLiP {
+namespace MeshMover {
+
+    template <int dim, typename real>
+    void
+    MeshMoverBase<dim,real>
+    ::apply_dXvdXvs(
+        std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors,
+        dealii::TrilinosWrappers::SparseMatrix &output_matrix)
+    {
+        const unsigned int n_cols = list_of_vectors.size();
+        AssertThrow(n_cols > 0, dealii::ExcMessage("No vector to apply dXvdXvs onto."));
+
+        std::vector<dealii::LinearAlgebra::distributed::Vector<double>> columns(n_cols);
+        for (unsigned int col = 0; col < n_cols; ++col) {
+            apply_dXvdXvs(list_of_vectors[col], columns[col]);
+        }
+
+        // Each process only inserts its locally owned rows, so the pattern does not need to be distributed.
+        const dealii::IndexSet &row_part = columns[0].get_partitioner()->locally_owned_range();
+        const unsigned int n_rows = columns[0].size();
+        dealii::DynamicSparsityPattern full_dsp(n_rows, n_cols, row_part);
+        for (const auto &i_row: row_part) {
+            for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
+                full_dsp.add(i_row, i_col);
+            }
+        }
+        const dealii::IndexSet col_part = dealii::Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,n_cols);
+        output_matrix.reinit(row_part, col_part, full_dsp, MPI_COMM_WORLD);
+
+        std::vector<dealii::types::global_dof_index> col_indices(n_cols);
+        std::iota(col_indices.begin(), col_indices.end(), 0);
+        std::vector<double> row_values(n_cols);
+        for (const auto &row: row_part) {
+            for (unsigned int col = 0; col < n_cols; ++col) {
+                row_values[col] = columns[col][row];
+            }
+            output_matrix.set(row, n_cols, col_indices.data(), row_values.data());
+        }
+        output_matrix.compress(dealii::VectorOperation::insert);
+    }
+
+template class MeshMoverBase<PHILIP_DIM, double>;
+} // namespace MeshMover
+} // namespace PHiLiP
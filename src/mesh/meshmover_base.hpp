@@ -0,0 +1,62 @@
+#ifndef __MESHMOVER_BASE_H__
+#define __MESHMOVER_BASE_H__
+
+#include <vector>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+namespace PHiLiP {
+
+namespace MeshMover
+{
+    /** Interface of the mesh movers deforming the volume nodes given the surface displacements.
+     *
+     *  The sensitivities follow the convention of apply_dXvdXvs(): the inputs are of size n_volume_nodes
+     *  and only their surface entries are used, and the outputs are volume displacements that
+     *  include the prescribed surface displacements.
+     */
+    template <int dim = PHILIP_DIM, typename real = double>
+    class MeshMoverBase
+    {
+    /// Distributed vector of double.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<real>;
+      public:
+        /// Virtual destructor.
+        virtual ~MeshMoverBase() = default;
+
+        /** Evaluate and return volume displacements given boundary displacements.
+         */
+        virtual VectorType get_volume_displacements() = 0;
+
+        /** Prepares the mover for repeated dXvdXvs products of the given surface displacement modes.
+         *  The modes are of size n_volume_nodes, e.g. the FreeFormDeformation::get_dXvsdXp() columns.
+         */
+        virtual void prepare_dXvdXvs(const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &surface_displacement_modes) = 0;
+
+        /** Apply the analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a vector.
+         */
+        virtual void
+        apply_dXvdXvs(const dealii::LinearAlgebra::distributed::Vector<double> &input_vector, dealii::LinearAlgebra::distributed::Vector<double> &output_vector) = 0;
+
+        /** Apply the analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a set of vectors, and store the results as the columns of a dense matrix.
+         *  The default implementation applies apply_dXvdXvs() onto each vector.
+         */
+        virtual void
+        apply_dXvdXvs(std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors, dealii::TrilinosWrappers::SparseMatrix &output_matrix);
+
+        /** Apply the transposed analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a vector.
+         */
+        virtual void
+        apply_dXvdXvs_transpose(
+            const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+            dealii::LinearAlgebra::distributed::Vector<double> &output_vector) = 0;
+    };
+} // namespace MeshMover
+
+} // namespace PHiLiP
+
+#endif
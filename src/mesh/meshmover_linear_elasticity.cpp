@@ -1,3 +1,5 @@
+#include <numeric>
+
 #include <deal.II/lac/constrained_linear_operator.h>
 
 #include <deal.II/dofs/dof_tools.h>
@@ -16,6 +18,9 @@
 
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
+#include <Amesos.h>
+#include <Epetra_Vector.h>
+
 #include "meshmover_linear_elasticity.hpp"
 
 namespace PHiLiP {
@@ -58,7 +63,9 @@ namespace MeshMover {
         const DoFHandlerType &_dof_handler,
         const dealii::LinearAlgebra::distributed::Vector<int> &_boundary_ids_vector,
         const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector)
-      : triangulation(_triangulation)
+      : system_is_assembled(false)
+      , use_factorization(false)
+      , triangulation(_triangulation)
       , mapping_fe_field(mapping_fe_field)
       , dof_handler(_dof_handler)
       , quadrature_formula(dof_handler.get_fe().degree + 1)
@@ -73,6 +80,23 @@ namespace MeshMover {
 
         boundary_displacements_vector.update_ghost_values();
         setup_system();
+
+        triangulation_change_connection = triangulation.signals.any_change.connect([this]() { invalidate_system(); });
+    }
+
+    template <int dim, typename real>
+    LinearElasticity<dim,real>::~LinearElasticity()
+    {
+        triangulation_change_connection.disconnect();
+    }
+
+    template <int dim, typename real>
+    void LinearElasticity<dim,real>::invalidate_system()
+    {
+        system_is_assembled = false;
+        ilut_preconditioner.reset();
+        direct_solver.reset();
+        factorized_problem.reset();
     }
 
     // template <int dim, typename real>
@@ -184,6 +208,11 @@ namespace MeshMover {
     template <int dim, typename real>
     void LinearElasticity<dim,real>::assemble_system()
     {
+        if (system_is_assembled) {
+            // The stiffness of the reference mesh does not depend on the boundary displacements.
+            assemble_dirichlet_rhs();
+            return;
+        }
         pcout << "    Assembling MeshMover::LinearElasticity system..." << std::endl;
 
         setup_system();
@@ -326,10 +355,7 @@ namespace MeshMover {
             const bool is_accessible = partitionner->in_local_range(isurf) || partitionner->is_ghost_entry(isurf);
             if (is_accessible) {
                 const unsigned int iglobal_row = boundary_ids_vector[isurf];
-                const double dirichlet_value = boundary_displacements_vector[isurf];
-
                 system_matrix.clear_row(iglobal_row,1.0);
-                system_rhs[iglobal_row] = dirichlet_value;
             }
         }
         // Until deal.II accepts the pull request to fix TrilinosWrappers::SparseMatrix::clear_row(row,new_diag_value)
@@ -342,9 +368,42 @@ namespace MeshMover {
             }
         }
         system_matrix.compress(dealii::VectorOperation::insert);
-        system_rhs.compress(dealii::VectorOperation::insert);
         system_matrix_unconstrained.compress(dealii::VectorOperation::insert);
         system_rhs_unconstrained.compress(dealii::VectorOperation::insert);
+        system_is_assembled = true;
+
+        assemble_dirichlet_rhs();
+    }
+
+    template <int dim, typename real>
+    void LinearElasticity<dim,real>::assemble_dirichlet_rhs()
+    {
+        // No body forces, the right-hand side only holds the Dirichlet values.
+        system_rhs = 0;
+        const auto &partitionner = boundary_ids_vector.get_partitioner();
+        for (unsigned int isurf = 0; isurf < boundary_ids_vector.size(); ++isurf) {
+            const bool is_accessible = partitionner->in_local_range(isurf) || partitionner->is_ghost_entry(isurf);
+            if (is_accessible) {
+                const unsigned int iglobal_row = boundary_ids_vector[isurf];
+                system_rhs[iglobal_row] = boundary_displacements_vector[isurf];
+            }
+        }
+        system_rhs.compress(dealii::VectorOperation::insert);
+    }
+
+    template <int dim, typename real>
+    void LinearElasticity<dim,real>::initialize_preconditioner()
+    {
+        if (ilut_preconditioner) return;
+
+        const unsigned int ilut_fill=50;
+        const double ilut_drop=1e-15;
+        const double ilut_atol=1e-6;
+        const double ilut_rtol=1.00001;
+        const unsigned int overlap=1;
+        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
+        ilut_preconditioner = std::make_unique<dealii::TrilinosWrappers::PreconditionILUT>();
+        ilut_preconditioner->initialize(system_matrix, precond_settings);
     }
     template <int dim, typename real>
     void LinearElasticity<dim,real>::solve_timestep()
@@ -362,6 +421,10 @@ namespace MeshMover {
         const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
         dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
     {
+        if (use_factorization) {
+            apply_dXvdXvs_factorized(input_vector, output_vector);
+            return;
+        }
         pcout << "Applying [dXvdXs] onto a vector..." << std::endl;
         assert(input_vector.size() == output_vector.size());
 
@@ -393,14 +456,8 @@ namespace MeshMover {
         //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
         //precondition.initialize(system_matrix, precond_settings);
 
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=1e-15;
-        const double ilut_atol=1e-6;
-        const double ilut_rtol=1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
+        initialize_preconditioner();
+        const dealii::TrilinosWrappers::PreconditionILUT &precondition = *ilut_preconditioner;
 
 
         //const double 	omega = 1;
@@ -439,6 +496,124 @@ namespace MeshMover {
         }
     }
 
+    template <int dim, typename real>
+    void LinearElasticity<dim,real>::factorize_system()
+    {
+        assemble_system();
+        if (direct_solver) return;
+
+        pcout << "Factorizing MeshMover::LinearElasticity system..." << std::endl;
+
+        // The problem only holds the matrix. The left and right-hand sides are set before each solve.
+        const Epetra_CrsMatrix &epetra_matrix = system_matrix.trilinos_matrix();
+        direct_solver.reset();
+        factorized_problem = std::make_unique<Epetra_LinearProblem>();
+        factorized_problem->SetOperator(const_cast<Epetra_CrsMatrix *>(&epetra_matrix));
+
+        Amesos amesos_factory;
+        direct_solver.reset(amesos_factory.Create("Amesos_Klu", *factorized_problem));
+        AssertThrow(direct_solver, dealii::ExcMessage("Amesos_Klu direct solver is not available."));
+
+        int ierr = direct_solver->SymbolicFactorization();
+        AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+        ierr = direct_solver->NumericFactorization();
+        AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+    }
+
+    template <int dim, typename real>
+    void LinearElasticity<dim,real>::prepare_dXvdXvs(
+        const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &/*surface_displacement_modes*/)
+    {
+        factorize_system();
+        use_factorization = true;
+    }
+
+    template <int dim, typename real>
+    void LinearElasticity<dim,real>::solve_factorized(
+        Epetra_MultiVector &solution,
+        const Epetra_MultiVector &rhs,
+        const bool transpose)
+    {
+        if (!direct_solver) factorize_system();
+
+        factorized_problem->SetLHS(&solution);
+        factorized_problem->SetRHS(const_cast<Epetra_MultiVector *>(&rhs));
+        // The transposed system is solved with the same factors.
+        direct_solver->SetUseTranspose(transpose);
+        const int ierr = direct_solver->Solve();
+        AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+    }
+
+    template <int dim, typename real>
+    std::shared_ptr<Epetra_MultiVector>
+    LinearElasticity<dim,real>
+    ::apply_dXvdXvs_multivector(
+        const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors)
+    {
+        if (!direct_solver) factorize_system();
+
+        const unsigned int n_cols = list_of_vectors.size();
+        pcout << "Applying [dXvdXs] onto " << n_cols << " vectors through a single factorization..." << std::endl;
+
+        const Epetra_CrsMatrix &epetra_matrix = system_matrix.trilinos_matrix();
+        Epetra_MultiVector rhs_multivector(epetra_matrix.RangeMap(), n_cols);
+        std::shared_ptr<Epetra_MultiVector> solution_multivector = std::make_shared<Epetra_MultiVector>(epetra_matrix.DomainMap(), n_cols);
+
+        // Both the distributed vectors and the Epetra maps store the locally owned rows in increasing global order.
+        const int n_local_rows = rhs_multivector.MyLength();
+        for (unsigned int col = 0; col < n_cols; ++col) {
+            const auto &input_vector = list_of_vectors[col];
+            AssertDimension(input_vector.locally_owned_elements().n_elements(), (unsigned int) n_local_rows);
+            double *rhs_column = rhs_multivector[col];
+            for (int i = 0; i < n_local_rows; ++i) {
+                rhs_column[i] = input_vector.local_element(i);
+            }
+        }
+
+        // The system matrix does not change between the columns.
+        // Solve for all the columns at once instead of one GMRES per column.
+        const bool transpose = false;
+        solve_factorized(*solution_multivector, rhs_multivector, transpose);
+
+        return solution_multivector;
+    }
+
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::apply_dXvdXvs_factorized(
+        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    {
+        if (!direct_solver) factorize_system();
+
+        output_vector.reinit(input_vector, true);
+        const Epetra_CrsMatrix &epetra_matrix = system_matrix.trilinos_matrix();
+        Epetra_Vector x(View, epetra_matrix.DomainMap(), output_vector.begin());
+        Epetra_Vector b(View, epetra_matrix.RangeMap(), const_cast<double *>(input_vector.begin()));
+        const bool transpose = false;
+        solve_factorized(x, b, transpose);
+        output_vector.update_ghost_values();
+    }
+
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::apply_dXvdXvs_transpose_factorized(
+        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    {
+        if (!direct_solver) factorize_system();
+
+        output_vector.reinit(input_vector, true);
+        const Epetra_CrsMatrix &epetra_matrix = system_matrix.trilinos_matrix();
+        Epetra_Vector x(View, epetra_matrix.RangeMap(), output_vector.begin());
+        Epetra_Vector b(View, epetra_matrix.DomainMap(), const_cast<double *>(input_vector.begin()));
+        const bool transpose = true;
+        solve_factorized(x, b, transpose);
+        output_vector.update_ghost_values();
+    }
+
     template <int dim, typename real>
     void
     LinearElasticity<dim,real>
@@ -446,11 +621,10 @@ namespace MeshMover {
         std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors,
         dealii::TrilinosWrappers::SparseMatrix &output_matrix)
     {
-        assemble_system();
+        const std::shared_ptr<Epetra_MultiVector> dXvdXvs_multivector = apply_dXvdXvs_multivector(list_of_vectors);
 
         const unsigned int n_rows = dof_handler.n_dofs();
         const unsigned int n_cols = list_of_vectors.size();
-        //const unsigned int max_per_row = n_cols;
 
         const dealii::IndexSet &row_part = dof_handler.locally_owned_dofs();
         dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
@@ -470,84 +644,17 @@ namespace MeshMover {
 
         output_matrix.reinit(row_part, col_part, full_sp, mpi_communicator);
 
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
-
-        //dealii::TrilinosWrappers::PreconditionILU  precondition;
-        //const int ilu_fill = 2;
-        //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        //precondition.initialize(system_matrix, precond_settings);
-
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=0.0;//1e-15;
-        const double ilut_atol=0.0;//1e-6;
-        const double ilut_rtol=1.0;//1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
-
-
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
-
-        using trilinos_vector_type = dealii::LinearAlgebra::distributed::Vector<double>;
-        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
-
-        dXvdXs.clear();
-        pcout << "Applying for [dXvdXs] onto " << list_of_vectors.size() << " vectors..." << std::endl;
-
-        unsigned int col = 0;
-        dealii::LinearAlgebra::distributed::Vector<double> output_vector;
-        output_vector.reinit(list_of_vectors[0]);
-        for (auto &input_vector: list_of_vectors) {
-
-            pcout << " Vector " << col << " out of " << list_of_vectors.size() << std::endl;
-
-            dealii::deallog.depth_console(0);
-
-            double input_vector_norm = input_vector.l2_norm();
-            if (input_vector_norm == 0.0) {
-                pcout << "Zero input vector. Zero output vector." << std::endl;
-                output_vector = 0.0;
-            } else {
-                const bool log_history = (this_mpi_process == 0);
-                dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
-                //dealii::SolverControl solver_control(20000, 1e-14, log_history);
-                solver_control.log_frequency(100);
-                const int max_n_tmp_vectors=200;
-                const bool right_preconditioning=true;
-                const bool use_default_residual=true;
-                const bool force_re_orthogonalization=false;
-                dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
-                dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
-
-                //dealii::SolverBicgstab<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control);
-
-                dealii::deallog.depth_console(2);
-                solver.solve(op_a, output_vector, input_vector, precondition);
-                pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-                      << "Residual: " << solver_control.last_value() << ". "
-                      << std::endl;
-
-                solver.solve(op_a, output_vector, input_vector, precondition);
-                pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-                      << "Residual: " << solver_control.last_value() << ". "
-                      << std::endl;
-            }
-
-            dXvdXs.push_back(output_vector);
-
-            for (const auto &row: dof_handler.locally_owned_dofs()) {
-                output_matrix.set(row, col, dXvdXs[col][row]);
+        // Insert one full row at a time.
+        std::vector<dealii::types::global_dof_index> col_indices(n_cols);
+        std::iota(col_indices.begin(), col_indices.end(), 0);
+        std::vector<double> row_values(n_cols);
+        int local_row = 0;
+        for (const auto &row: row_part) {
+            for (unsigned int col = 0; col < n_cols; ++col) {
+                row_values[col] = (*dXvdXvs_multivector)[col][local_row];
             }
-            col++;
+            output_matrix.set(row, n_cols, col_indices.data(), row_values.data());
+            ++local_row;
         }
         output_matrix.compress(dealii::VectorOperation::insert);
 
@@ -560,6 +667,10 @@ namespace MeshMover {
         const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
         dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
     {
+        if (use_factorization) {
+            apply_dXvdXvs_transpose_factorized(input_vector, output_vector);
+            return;
+        }
         pcout << "Applying [transpose(dXvdXvs)] onto a vector..." << std::endl;
 
         double input_vector_norm = input_vector.l2_norm();
@@ -590,14 +701,8 @@ namespace MeshMover {
         // dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
         // precondition.initialize(system_matrix, precond_settings);
 
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=1e-15;
-        const double ilut_atol=1e-6;
-        const double ilut_rtol=1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
+        initialize_preconditioner();
+        const dealii::TrilinosWrappers::PreconditionILUT &precondition = *ilut_preconditioner;
 
         //const double 	omega = 1;
         //const double 	min_diagonal = 1e-8;
@@ -902,8 +1007,17 @@ namespace MeshMover {
 
             unit_rhs_vector.push_back(unit_rhs);
         }
-        dealii::TrilinosWrappers::SparseMatrix dXvdXs_matrix;
-        apply_dXvdXvs(unit_rhs_vector, dXvdXs_matrix);
+        const std::shared_ptr<Epetra_MultiVector> dXvdXs_multivector = apply_dXvdXvs_multivector(unit_rhs_vector);
+        for (unsigned int iconstraint = 0; iconstraint < n_dirichlet_constraints; iconstraint++) {
+            dealii::LinearAlgebra::distributed::Vector<double> dXvdXs_column;
+            dXvdXs_column.reinit(system_rhs);
+            const double *solution_column = (*dXvdXs_multivector)[iconstraint];
+            for (int i = 0; i < dXvdXs_multivector->MyLength(); ++i) {
+                dXvdXs_column.local_element(i) = solution_column[i];
+            }
+            dXvdXs_column.update_ghost_values();
+            dXvdXs.push_back(dXvdXs_column);
+        }
     }
 
     // template <int dim, typename real>
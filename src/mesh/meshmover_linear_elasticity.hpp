@@ -1,20 +1,31 @@
 #ifndef __MESHMOVER_LINEAR_ELASTICITY_H__
 #define __MESHMOVER_LINEAR_ELASTICITY_H__
 
+#include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
+#include <Epetra_MultiVector.h>
+#include <Epetra_LinearProblem.h>
+#include <Amesos_BaseSolver.h>
+
 #include "parameters/all_parameters.h"
 
 #include "high_order_grid.h"
+#include "meshmover_base.hpp"
 
 namespace PHiLiP {
 
 namespace MeshMover
 {
     /** Linear elasticity mesh movement based on the deal.II example step-8 and step-42.
+     *
+     *  The stiffness only depends on the mesh given by mapping_fe_field when it is first assembled.
+     *  The assembled system, its ILUT preconditioner and its direct factorization are therefore kept
+     *  for all subsequent deformations and sensitivity products, and are only discarded when the
+     *  triangulation changes or when invalidate_system() is called.
      */
     template <int dim = PHILIP_DIM, typename real = double>
-    class LinearElasticity
+    class LinearElasticity : public MeshMoverBase<dim,real>
     {
     /// Distributed vector of double.
     using VectorType = dealii::LinearAlgebra::distributed::Vector<real>;
@@ -47,9 +58,24 @@ namespace MeshMover
             const HighOrderGrid<dim,real> &high_order_grid,
    const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector);
 
+        /// Destructor disconnecting from the triangulation signals.
+        ~LinearElasticity();
+
+        /** Discards the assembled stiffness, its preconditioner and its factorization.
+         *  They are rebuilt on next use from the current mapping_fe_field.
+         *  Automatically called whenever the triangulation changes.
+         */
+        void invalidate_system();
+
         /** Evaluate and return volume displacements given boundary displacements.
          */
-        VectorType get_volume_displacements();
+        VectorType get_volume_displacements() override;
+
+        /** Factorizes the elasticity system, which is independent of the @p surface_displacement_modes.
+         *  Subsequent apply_dXvdXvs() and apply_dXvdXvs_transpose() calls then use the factorization
+         *  instead of preconditioned GMRES, also after the system has been invalidated.
+         */
+        void prepare_dXvdXvs(const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &surface_displacement_modes) override;
 
         /** Evaluates the analytical derivatives of volume displacements with respect
          *  to surface displacements.
@@ -64,7 +90,39 @@ namespace MeshMover
          *  volume_nodes (which include the prescribed surface nodes).
          */
         void
-        apply_dXvdXvs(std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors, dealii::TrilinosWrappers::SparseMatrix &output_matrix);
+        apply_dXvdXvs(std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors, dealii::TrilinosWrappers::SparseMatrix &output_matrix) override;
+
+        /** Apply the analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a set of various right-hand sides at once.
+         *  The elasticity system is factorized once with a sparse direct solver and the
+         *  factorization is used to solve for all the right-hand sides in a single block solve.
+         *  The result is a dense column-major multivector where each column corresponds to
+         *  a right-hand side, and the rows are distributed the same way as the volume nodes.
+         */
+        std::shared_ptr<Epetra_MultiVector>
+        apply_dXvdXvs_multivector(const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors);
+
+        /** Assembles and factorizes the elasticity system with a sparse direct solver.
+         *  The factorization is kept such that subsequent calls to apply_dXvdXvs_multivector(),
+         *  apply_dXvdXvs_factorized() and apply_dXvdXvs_transpose_factorized() only perform
+         *  forward and backward substitutions. It is computed on first use, and is only recomputed
+         *  after the system has been invalidated.
+         */
+        void factorize_system();
+
+        /** Same as apply_dXvdXvs() but through the cached factorization of the elasticity system.
+         */
+        void
+        apply_dXvdXvs_factorized(
+            const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+            dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
+
+        /** Same as apply_dXvdXvs_transpose() but through the cached factorization of the elasticity system.
+         */
+        void
+        apply_dXvdXvs_transpose_factorized(
+            const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+            dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
 
         /** Apply the analytical derivatives of volume displacements with respect
          *  to surface displacements onto a set of various right-hand sides.
@@ -74,7 +132,7 @@ namespace MeshMover
          *  volume_nodes (which include the prescribed surface nodes).
          */
         void
-        apply_dXvdXvs(const dealii::LinearAlgebra::distributed::Vector<double> &input_vector, dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
+        apply_dXvdXvs(const dealii::LinearAlgebra::distributed::Vector<double> &input_vector, dealii::LinearAlgebra::distributed::Vector<double> &output_vector) override;
 
         /** Apply the transposed analytical derivatives of volume displacements with respect
          *  to surface displacements onto a right-hand sides.
@@ -86,7 +144,7 @@ namespace MeshMover
         void
         apply_dXvdXvs_transpose(
             const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
-            dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
+            dealii::LinearAlgebra::distributed::Vector<double> &output_vector) override;
 
         /** Current displacement solution
          */
@@ -110,9 +168,29 @@ namespace MeshMover
       private:
         /// Allocation and boundary condition setup.
         void setup_system();
-        /// Assemble the system and its right-hand side.
+        /** Assemble the system and its right-hand side.
+         *  Once assembled, only the right-hand side is updated with the current boundary displacements.
+         */
         void assemble_system();
 
+        /// Sets the Dirichlet boundary values of the system right-hand side.
+        void assemble_dirichlet_rhs();
+
+        /// Builds the ILUT preconditioner of the system_matrix if it is not already available.
+        void initialize_preconditioner();
+
+        /// Whether system_matrix holds the stiffness of the current triangulation.
+        bool system_is_assembled;
+
+        /// Whether apply_dXvdXvs() and apply_dXvdXvs_transpose() use the factorization. Set by prepare_dXvdXvs().
+        bool use_factorization;
+
+        /// ILUT preconditioner of the system_matrix reused by apply_dXvdXvs() and apply_dXvdXvs_transpose().
+        std::unique_ptr<dealii::TrilinosWrappers::PreconditionILUT> ilut_preconditioner;
+
+        /// Connection to the triangulation signal invalidating the system on refinement.
+        boost::signals2::connection triangulation_change_connection;
+
 
         /** Solve the current time step.
          *  Currently only 1 time step since it is a linear mesh mover.
@@ -126,6 +204,16 @@ namespace MeshMover
          */
         unsigned int solve_linear_problem();
 
+        /** Solves the system, or its transpose, with the cached factorization for all the columns of @p rhs.
+         *  Factorizes the system if it has not been done yet.
+         */
+        void solve_factorized(Epetra_MultiVector &solution, const Epetra_MultiVector &rhs, const bool transpose);
+
+        /// Linear problem holding the system matrix factorized by direct_solver.
+        std::unique_ptr<Epetra_LinearProblem> factorized_problem;
+        /// Sparse direct solver holding the factorization of the system_matrix.
+        std::unique_ptr<Amesos_BaseSolver> direct_solver;
+
         const Triangulation &triangulation; ///< Triangulation on which this acts.
         /// MappingFEField corresponding to curved mesh.
         const std::shared_ptr<dealii::MappingFEField<dim,dim,VectorType,DoFHandlerType>> mapping_fe_field;
@@ -0,0 +1,453 @@
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include "meshmover_rbf.hpp"
+
+namespace PHiLiP {
+namespace MeshMover {
+
+    template <int dim, typename real>
+    RadialBasisFunction<dim,real>::RadialBasisFunction(
+        const HighOrderGrid<dim,real> &high_order_grid,
+        const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector,
+        const double _support_radius,
+        const double _greedy_tolerance,
+        const unsigned int _max_control_points)
+      : dof_handler(high_order_grid.dof_handler_grid)
+      , support_radius(_support_radius)
+      , greedy_tolerance(_greedy_tolerance)
+      , max_control_points(_max_control_points)
+      , mpi_communicator(MPI_COMM_WORLD)
+      , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+      , boundary_displacements_vector(_boundary_displacements_vector)
+    {
+        AssertDimension(boundary_displacements_vector.size(), high_order_grid.surface_to_volume_indices.size());
+
+        locally_owned_dofs = dof_handler.locally_owned_dofs();
+        dealii::IndexSet locally_relevant_dofs;
+        dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+        ghost_dofs = locally_relevant_dofs;
+        ghost_dofs.subtract_set(locally_owned_dofs);
+
+        hanging_node_constraints.clear();
+        hanging_node_constraints.reinit(locally_relevant_dofs);
+        dealii::DoFTools::make_hanging_node_constraints(dof_handler, hanging_node_constraints);
+        hanging_node_constraints.close();
+
+        setup_points(high_order_grid);
+        gather_boundary_displacements();
+        add_control_points({surface_point_displacements});
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::setup_points(const HighOrderGrid<dim,real> &high_order_grid)
+    {
+        using dealii::types::global_dof_index;
+
+        // Surface index of every surface volume DoF.
+        std::unordered_map<global_dof_index, global_dof_index> volume_to_surface_index;
+        for (global_dof_index isurf = 0; isurf < high_order_grid.all_surface_indices.size(); ++isurf) {
+            volume_to_surface_index[high_order_grid.all_surface_indices[isurf]] = isurf;
+        }
+
+        // Group the components of the FESystem sharing the same support point.
+        const dealii::FESystem<dim> &fe = dof_handler.get_fe();
+        const unsigned int n_points_per_cell = fe.base_element(0).dofs_per_cell;
+        std::vector<global_dof_index> dof_indices(fe.dofs_per_cell);
+        std::vector<PointDoFs> cell_point_dofs(n_points_per_cell);
+        std::unordered_set<global_dof_index> visited;
+
+        std::vector<global_dof_index> local_surface_dofs;
+        std::vector<double> local_surface_points;
+
+        double max_surface_cell_diameter = 0.0;
+        for (const auto &cell : dof_handler.active_cell_iterators()) {
+            if (!cell->is_locally_owned()) continue;
+            if (cell->at_boundary()) max_surface_cell_diameter = std::max(max_surface_cell_diameter, cell->diameter());
+            cell->get_dof_indices(dof_indices);
+            for (unsigned int idof = 0; idof < fe.dofs_per_cell; ++idof) {
+                const std::pair<unsigned int, unsigned int> component_and_point = fe.system_to_component_index(idof);
+                cell_point_dofs[component_and_point.second][component_and_point.first] = dof_indices[idof];
+            }
+            for (const auto &point_dofs : cell_point_dofs) {
+                if (!locally_owned_dofs.is_element(point_dofs[0])) continue;
+                if (!visited.insert(point_dofs[0]).second) continue;
+
+                dealii::Point<dim> point;
+                for (int d = 0; d < dim; ++d) {
+                    point[d] = high_order_grid.volume_nodes[point_dofs[d]];
+                }
+                const bool is_surface = volume_to_surface_index.count(point_dofs[0]) > 0;
+                volume_points.push_back(point);
+                volume_point_dofs.push_back(point_dofs);
+                volume_point_is_surface.push_back(is_surface);
+
+                if (is_surface) {
+                    for (int d = 0; d < dim; ++d) {
+                        local_surface_dofs.push_back(point_dofs[d]);
+                    }
+                    for (int d = 0; d < dim; ++d) {
+                        local_surface_points.push_back(point[d]);
+                    }
+                    for (int d = 0; d < dim; ++d) {
+                        local_surface_indices.push_back(volume_to_surface_index.at(point_dofs[d]));
+                    }
+                }
+            }
+        }
+
+        // Every process holds all the surface points, in the order of the MPI ranks.
+        const std::vector<std::vector<global_dof_index>> all_surface_dofs = dealii::Utilities::MPI::all_gather(mpi_communicator, local_surface_dofs);
+        const std::vector<std::vector<double>> all_surface_points = dealii::Utilities::MPI::all_gather(mpi_communicator, local_surface_points);
+        for (unsigned int i_mpi = 0; i_mpi < all_surface_dofs.size(); ++i_mpi) {
+            const unsigned int n_process_points = all_surface_dofs[i_mpi].size() / dim;
+            for (unsigned int ipoint = 0; ipoint < n_process_points; ++ipoint) {
+                PointDoFs point_dofs;
+                dealii::Point<dim> point;
+                for (int d = 0; d < dim; ++d) {
+                    point_dofs[d] = all_surface_dofs[i_mpi][ipoint*dim + d];
+                    point[d] = all_surface_points[i_mpi][ipoint*dim + d];
+                }
+                surface_point_dofs.push_back(point_dofs);
+                surface_points.push_back(point);
+            }
+        }
+
+        // The default support spans a few surface cells, such that each bucket only holds nearby control points.
+        if (support_radius <= 0.0) {
+            const double surface_cell_diameter = dealii::Utilities::MPI::max(max_surface_cell_diameter, mpi_communicator);
+            support_radius = default_support_cells * surface_cell_diameter;
+        }
+        if (support_radius <= 0.0) support_radius = 1.0;
+    }
+
+    template <int dim, typename real>
+    double RadialBasisFunction<dim,real>::basis_function(const double distance) const
+    {
+        const double xi = distance / support_radius;
+        if (xi >= 1.0) return 0.0;
+        const double one_minus_xi = 1.0 - xi;
+        return one_minus_xi*one_minus_xi*one_minus_xi*one_minus_xi * (4.0*xi + 1.0);
+    }
+
+    template <int dim, typename real>
+    std::array<int,dim> RadialBasisFunction<dim,real>::bucket_of(const dealii::Point<dim> &point) const
+    {
+        std::array<int,dim> bucket;
+        for (int d = 0; d < dim; ++d) {
+            bucket[d] = static_cast<int>(std::floor(point[d] / support_radius));
+        }
+        return bucket;
+    }
+
+    template <int dim, typename real>
+    template <typename Function>
+    void RadialBasisFunction<dim,real>::for_each_control_in_support(const dealii::Point<dim> &point, const Function &function) const
+    {
+        // Buckets are as large as the support, so only the 3^dim neighbouring buckets are searched.
+        const std::array<int,dim> center = bucket_of(point);
+        unsigned int n_neighbours = 1;
+        for (int d = 0; d < dim; ++d) n_neighbours *= 3;
+        for (unsigned int ineighbour = 0; ineighbour < n_neighbours; ++ineighbour) {
+            std::array<int,dim> bucket = center;
+            unsigned int offset = ineighbour;
+            for (int d = 0; d < dim; ++d) {
+                bucket[d] += static_cast<int>(offset % 3) - 1;
+                offset /= 3;
+            }
+            const auto found = control_buckets.find(bucket);
+            if (found == control_buckets.end()) continue;
+            for (const unsigned int icontrol : found->second) {
+                const double phi = basis_function(point.distance(surface_points[control_points[icontrol]]));
+                if (phi != 0.0) function(icontrol, phi);
+            }
+        }
+    }
+
+    template <int dim, typename real>
+    dealii::Tensor<1,dim,double> RadialBasisFunction<dim,real>::evaluate_interpolant(
+        const dealii::Point<dim> &point,
+        const std::vector<double> &coefficients) const
+    {
+        dealii::Tensor<1,dim,double> value;
+        for_each_control_in_support(point, [&](const unsigned int icontrol, const double phi) {
+            for (int d = 0; d < dim; ++d) {
+                value[d] += phi * coefficients[icontrol*dim + d];
+            }
+        });
+        return value;
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::add_control_point(const unsigned int ipoint)
+    {
+        // Appending a control point appends a row to the Cholesky factor L of the interpolation matrix:
+        //     [ A   b ]   [ L   0 ] [ L^T  l ]
+        //     [ b^T 1 ] = [ l^T d ] [ 0    d ],   L l = b,   d = sqrt(1 - l^T l),
+        // where b only has non-zero entries for the control points within the support of the new point.
+        const unsigned int n_controls = control_points.size();
+        std::vector<double> row(n_controls+1, 0.0);
+        for_each_control_in_support(surface_points[ipoint], [&](const unsigned int icontrol, const double phi) {
+            row[icontrol] = phi;
+        });
+        for (unsigned int i = 0; i < n_controls; ++i) {
+            for (unsigned int j = 0; j < i; ++j) row[i] -= cholesky_factor[i][j] * row[j];
+            row[i] /= cholesky_factor[i][i];
+        }
+        double diagonal = basis_function(0.0);
+        for (unsigned int j = 0; j < n_controls; ++j) diagonal -= row[j] * row[j];
+        // Wendland functions are positive definite in up to three dimensions.
+        AssertThrow(diagonal > 0.0, dealii::ExcMessage("RBF interpolation matrix is not numerically positive definite."));
+        row[n_controls] = std::sqrt(diagonal);
+
+        cholesky_factor.push_back(std::move(row));
+        control_buckets[bucket_of(surface_points[ipoint])].push_back(n_controls);
+        control_points.push_back(ipoint);
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::solve_control_coefficients(std::vector<double> &values) const
+    {
+        const unsigned int n_controls = control_points.size();
+        std::vector<double> rhs(n_controls);
+        for (int d = 0; d < dim; ++d) {
+            for (unsigned int i = 0; i < n_controls; ++i) rhs[i] = values[i*dim + d];
+            // Forward substitution with L, then backward substitution with L^T.
+            for (unsigned int i = 0; i < n_controls; ++i) {
+                for (unsigned int j = 0; j < i; ++j) rhs[i] -= cholesky_factor[i][j] * rhs[j];
+                rhs[i] /= cholesky_factor[i][i];
+            }
+            for (unsigned int i = n_controls; i-- > 0;) {
+                for (unsigned int j = i+1; j < n_controls; ++j) rhs[i] -= cholesky_factor[j][i] * rhs[j];
+                rhs[i] /= cholesky_factor[i][i];
+            }
+            for (unsigned int i = 0; i < n_controls; ++i) values[i*dim + d] = rhs[i];
+        }
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::gather_boundary_displacements()
+    {
+        boundary_displacements_vector.update_ghost_values();
+        std::vector<double> local_displacements;
+        local_displacements.reserve(local_surface_indices.size());
+        for (const auto isurf : local_surface_indices) {
+            local_displacements.push_back(boundary_displacements_vector[isurf]);
+        }
+        // Same ordering as the points gathered in setup_points().
+        const std::vector<std::vector<double>> all_displacements = dealii::Utilities::MPI::all_gather(mpi_communicator, local_displacements);
+        surface_point_displacements.clear();
+        for (const auto &process_displacements : all_displacements) {
+            surface_point_displacements.insert(surface_point_displacements.end(), process_displacements.begin(), process_displacements.end());
+        }
+    }
+
+    template <int dim, typename real>
+    std::vector<double> RadialBasisFunction<dim,real>::gather_surface_values(
+        const dealii::LinearAlgebra::distributed::Vector<double> &volume_vector) const
+    {
+        std::vector<double> surface_values(surface_points.size()*dim, 0.0);
+        for (unsigned int ipoint = 0; ipoint < surface_points.size(); ++ipoint) {
+            for (int d = 0; d < dim; ++d) {
+                const dealii::types::global_dof_index idof = surface_point_dofs[ipoint][d];
+                if (locally_owned_dofs.is_element(idof)) surface_values[ipoint*dim + d] = volume_vector[idof];
+            }
+        }
+        return dealii::Utilities::MPI::sum(surface_values, mpi_communicator);
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::add_control_points(const std::vector<std::vector<double>> &surface_modes)
+    {
+        const unsigned int n_surface_points = surface_points.size();
+        if (n_surface_points == 0) return;
+
+        double max_displacement = 0.0;
+        for (const auto &mode : surface_modes) {
+            for (unsigned int ipoint = 0; ipoint < n_surface_points; ++ipoint) {
+                double norm = 0.0;
+                for (int d = 0; d < dim; ++d) norm += std::pow(mode[ipoint*dim + d], 2);
+                max_displacement = std::max(max_displacement, std::sqrt(norm));
+            }
+        }
+
+        // The surface points are identical on every process, so is the selection.
+        // Without any displacement, no control point is needed and the interior does not move.
+        const unsigned int max_controls = std::min(max_control_points, n_surface_points);
+        const unsigned int n_initial_controls = control_points.size();
+        double max_error = 0.0;
+        while (true) {
+            unsigned int next_point = 0;
+            max_error = 0.0;
+            for (const auto &mode : surface_modes) {
+                std::vector<double> coefficients(control_points.size()*dim);
+                for (unsigned int icontrol = 0; icontrol < control_points.size(); ++icontrol) {
+                    for (int d = 0; d < dim; ++d) {
+                        coefficients[icontrol*dim + d] = mode[control_points[icontrol]*dim + d];
+                    }
+                }
+                if (!control_points.empty()) solve_control_coefficients(coefficients);
+
+                for (unsigned int ipoint = 0; ipoint < n_surface_points; ++ipoint) {
+                    const dealii::Tensor<1,dim,double> interpolated = evaluate_interpolant(surface_points[ipoint], coefficients);
+                    double error = 0.0;
+                    for (int d = 0; d < dim; ++d) error += std::pow(interpolated[d] - mode[ipoint*dim + d], 2);
+                    error = std::sqrt(error);
+                    if (error > max_error) {
+                        max_error = error;
+                        next_point = ipoint;
+                    }
+                }
+            }
+            if (max_error <= greedy_tolerance * max_displacement) break;
+            if (control_points.size() >= max_controls) break;
+            add_control_point(next_point);
+        }
+        if (control_points.size() > n_initial_controls) {
+            pcout << "RBF mesh mover selected " << control_points.size() << " control points out of " << n_surface_points
+                  << " surface points with a maximum surface error of " << max_error << std::endl;
+        }
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::prepare_dXvdXvs(
+        const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &surface_displacement_modes)
+    {
+        std::vector<std::vector<double>> surface_modes;
+        surface_modes.reserve(surface_displacement_modes.size());
+        for (const auto &mode : surface_displacement_modes) {
+            surface_modes.push_back(gather_surface_values(mode));
+        }
+        add_control_points(surface_modes);
+    }
+
+    template <int dim, typename real>
+    unsigned int RadialBasisFunction<dim,real>::n_control_points() const
+    {
+        return control_points.size();
+    }
+
+    template <int dim, typename real>
+    dealii::LinearAlgebra::distributed::Vector<real>
+    RadialBasisFunction<dim,real>::get_volume_displacements()
+    {
+        pcout << "Interpolating RBF volume displacements..." << std::endl;
+        gather_boundary_displacements();
+        add_control_points({surface_point_displacements});
+        VectorType surface_displacements(locally_owned_dofs, ghost_dofs, mpi_communicator);
+        for (unsigned int ipoint = 0; ipoint < surface_points.size(); ++ipoint) {
+            for (int d = 0; d < dim; ++d) {
+                const dealii::types::global_dof_index idof = surface_point_dofs[ipoint][d];
+                if (locally_owned_dofs.is_element(idof)) surface_displacements[idof] = surface_point_displacements[ipoint*dim + d];
+            }
+        }
+        VectorType volume_displacements;
+        apply_dXvdXvs(surface_displacements, volume_displacements);
+        return volume_displacements;
+    }
+
+    template <int dim, typename real>
+    void
+    RadialBasisFunction<dim,real>
+    ::apply_dXvdXvs(
+        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    {
+        const unsigned int n_controls = control_points.size();
+
+        // Values at the control points, contributed by their owners.
+        std::vector<double> coefficients(n_controls*dim, 0.0);
+        for (unsigned int icontrol = 0; icontrol < n_controls; ++icontrol) {
+            for (int d = 0; d < dim; ++d) {
+                const dealii::types::global_dof_index idof = surface_point_dofs[control_points[icontrol]][d];
+                if (locally_owned_dofs.is_element(idof)) coefficients[icontrol*dim + d] = input_vector[idof];
+            }
+        }
+        coefficients = dealii::Utilities::MPI::sum(coefficients, mpi_communicator);
+        if (n_controls > 0) solve_control_coefficients(coefficients);
+
+        output_vector.reinit(locally_owned_dofs, ghost_dofs, mpi_communicator);
+        for (unsigned int ipoint = 0; ipoint < volume_points.size(); ++ipoint) {
+            const PointDoFs &point_dofs = volume_point_dofs[ipoint];
+            if (volume_point_is_surface[ipoint]) {
+                for (int d = 0; d < dim; ++d) output_vector[point_dofs[d]] = input_vector[point_dofs[d]];
+            } else {
+                const dealii::Tensor<1,dim,double> displacement = evaluate_interpolant(volume_points[ipoint], coefficients);
+                for (int d = 0; d < dim; ++d) output_vector[point_dofs[d]] = displacement[d];
+            }
+        }
+        output_vector.update_ghost_values();
+        hanging_node_constraints.distribute(output_vector);
+        output_vector.update_ghost_values();
+    }
+
+    template <int dim, typename real>
+    void RadialBasisFunction<dim,real>::distribute_transpose(dealii::LinearAlgebra::distributed::Vector<double> &vector) const
+    {
+        dealii::LinearAlgebra::distributed::Vector<double> transposed(locally_owned_dofs, ghost_dofs, mpi_communicator);
+        for (const auto row : locally_owned_dofs) {
+            const auto *entries = hanging_node_constraints.get_constraint_entries(row);
+            if (entries == nullptr) {
+                transposed(row) += vector[row];
+                continue;
+            }
+            for (const auto &entry : *entries) {
+                transposed(entry.first) += entry.second * vector[row];
+            }
+        }
+        transposed.compress(dealii::VectorOperation::add);
+        vector = transposed;
+    }
+
+    template <int dim, typename real>
+    void
+    RadialBasisFunction<dim,real>
+    ::apply_dXvdXvs_transpose(
+        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    {
+        const unsigned int n_controls = control_points.size();
+
+        dealii::LinearAlgebra::distributed::Vector<double> constrained_input(locally_owned_dofs, ghost_dofs, mpi_communicator);
+        constrained_input.copy_locally_owned_data_from(input_vector);
+        distribute_transpose(constrained_input);
+
+        // Gather the interior volume contributions onto the control points.
+        std::vector<double> coefficients(n_controls*dim, 0.0);
+        for (unsigned int ipoint = 0; ipoint < volume_points.size(); ++ipoint) {
+            if (volume_point_is_surface[ipoint]) continue;
+            const PointDoFs &point_dofs = volume_point_dofs[ipoint];
+            for_each_control_in_support(volume_points[ipoint], [&](const unsigned int icontrol, const double phi) {
+                for (int d = 0; d < dim; ++d) {
+                    coefficients[icontrol*dim + d] += phi * constrained_input[point_dofs[d]];
+                }
+            });
+        }
+        coefficients = dealii::Utilities::MPI::sum(coefficients, mpi_communicator);
+        // The interpolation matrix is symmetric.
+        if (n_controls > 0) solve_control_coefficients(coefficients);
+
+        output_vector.reinit(locally_owned_dofs, ghost_dofs, mpi_communicator);
+        for (unsigned int ipoint = 0; ipoint < volume_points.size(); ++ipoint) {
+            if (!volume_point_is_surface[ipoint]) continue;
+            const PointDoFs &point_dofs = volume_point_dofs[ipoint];
+            for (int d = 0; d < dim; ++d) output_vector[point_dofs[d]] = constrained_input[point_dofs[d]];
+        }
+        for (unsigned int icontrol = 0; icontrol < n_controls; ++icontrol) {
+            for (int d = 0; d < dim; ++d) {
+                const dealii::types::global_dof_index idof = surface_point_dofs[control_points[icontrol]][d];
+                if (locally_owned_dofs.is_element(idof)) output_vector[idof] += coefficients[icontrol*dim + d];
+            }
+        }
+        output_vector.update_ghost_values();
+    }
+
+template class RadialBasisFunction<PHILIP_DIM, double>;
+} // namespace MeshMover
+} // namespace PHiLiP
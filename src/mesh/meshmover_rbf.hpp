@@ -0,0 +1,184 @@
+#ifndef __MESHMOVER_RBF_H__
+#define __MESHMOVER_RBF_H__
+
+#include <array>
+#include <map>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include "high_order_grid.h"
+#include "meshmover_base.hpp"
+
+namespace PHiLiP {
+
+namespace MeshMover
+{
+    /** Radial basis function mesh movement with greedy selection of the control points.
+     *
+     *  The volume displacements are interpolated from the surface displacements using the
+     *  compactly supported Wendland C2 function
+     *  \f[
+     *      \phi(\xi) = (1-\xi)^4 (4\xi+1), \quad \xi = \frac{\| \mathbf{x} - \mathbf{x}_c \|}{R} < 1,
+     *  \f]
+     *  centered at a reduced set of surface control points. Following Rendall and Allen,
+     *  the control points are greedily added at the surface point of largest interpolation
+     *  error until all the prescribed surface displacements are recovered within a tolerance.
+     *
+     *  Unlike LinearElasticity, no system is assembled on the volume mesh.
+     *  The control points are stored in a bucket tree of size R, such that evaluating the
+     *  interpolant at the N volume points scales as O(N log N).
+     *  The surface nodes are always given their prescribed displacements.
+     *
+     *  Once the control points are selected, the mesh movement is linear in the surface
+     *  displacements, and its derivatives are applied exactly through apply_dXvdXvs()
+     *  and apply_dXvdXvs_transpose(). Control points are only ever added, when
+     *  get_volume_displacements() or prepare_dXvdXvs() are given displacements that the
+     *  current control points do not reproduce.
+     */
+    template <int dim = PHILIP_DIM, typename real = double>
+    class RadialBasisFunction : public MeshMoverBase<dim,real>
+    {
+    /// Distributed vector of double.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<real>;
+    /// DoFHandler
+    using DoFHandlerType = dealii::DoFHandler<dim>;
+    /// Global indices of the dim components of a grid point.
+    using PointDoFs = std::array<dealii::types::global_dof_index, dim>;
+      public:
+        /// Constructor that uses information from HighOrderGrid and uses current volume_nodes from HighOrderGrid.
+        /** @param support_radius  Radius R of the basis functions. If not positive, defaults to default_support_cells
+         *                         times the largest diameter of the cells touching the boundary.
+         *  @param greedy_tolerance  Maximum surface interpolation error relative to the largest surface displacement.
+         *  @param max_control_points  Upper bound on the number of greedily selected control points.
+         */
+        RadialBasisFunction(
+            const HighOrderGrid<dim,real> &high_order_grid,
+            const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector,
+            const double support_radius = 0.0,
+            const double greedy_tolerance = 1e-3,
+            const unsigned int max_control_points = 1000);
+
+        /** Evaluate and return volume displacements given the current boundary displacements.
+         */
+        VectorType get_volume_displacements() override;
+
+        /** Adds control points until every one of the @p surface_displacement_modes is reproduced within the greedy tolerance.
+         */
+        void prepare_dXvdXvs(const std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &surface_displacement_modes) override;
+
+        using MeshMoverBase<dim,real>::apply_dXvdXvs;
+
+        /** Apply the analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a vector.
+         *  Same convention as LinearElasticity::apply_dXvdXvs(): the input is of size n_volume_nodes
+         *  and only its surface entries are used.
+         */
+        void
+        apply_dXvdXvs(const dealii::LinearAlgebra::distributed::Vector<double> &input_vector, dealii::LinearAlgebra::distributed::Vector<double> &output_vector) override;
+
+        /** Apply the transposed analytical derivatives of volume displacements with respect
+         *  to surface displacements onto a vector.
+         *  The output is of size n_volume_nodes and only its surface entries are non-zero.
+         */
+        void
+        apply_dXvdXvs_transpose(
+            const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+            dealii::LinearAlgebra::distributed::Vector<double> &output_vector) override;
+
+        /// Number of greedily selected control points.
+        unsigned int n_control_points() const;
+
+        /** Hanging node constraints
+         */
+        dealii::AffineConstraints<double> hanging_node_constraints;
+
+      private:
+        /// Groups the locally owned grid DoFs into points and gathers the surface points on every process.
+        void setup_points(const HighOrderGrid<dim,real> &high_order_grid);
+
+        /// Gathers the current boundary displacements into surface_point_displacements.
+        void gather_boundary_displacements();
+
+        /// Gathers the surface entries of a vector of size n_volume_nodes, ordered as [surface point][direction].
+        std::vector<double> gather_surface_values(const dealii::LinearAlgebra::distributed::Vector<double> &volume_vector) const;
+
+        /// Greedily adds control points until all the @p surface_modes are reproduced.
+        /** The modes are ordered as [surface point][direction].
+         */
+        void add_control_points(const std::vector<std::vector<double>> &surface_modes);
+
+        /// Appends a control point and the corresponding row of the Cholesky factor of the interpolation matrix.
+        void add_control_point(const unsigned int ipoint);
+
+        /// Solves for the basis function coefficients of each direction given values at the control points.
+        /** The values are ordered as [control point][direction] and are overwritten with the coefficients.
+         */
+        void solve_control_coefficients(std::vector<double> &values) const;
+
+        /// Wendland C2 basis function of the distance.
+        double basis_function(const double distance) const;
+
+        /// Calls @p function(control_index, basis_value) for every control point whose support contains @p point.
+        template <typename Function>
+        void for_each_control_in_support(const dealii::Point<dim> &point, const Function &function) const;
+
+        /// Evaluates the interpolant at @p point given the coefficients ordered as [control point][direction].
+        dealii::Tensor<1,dim,double> evaluate_interpolant(const dealii::Point<dim> &point, const std::vector<double> &coefficients) const;
+
+        /// Bucket of the tree containing @p point.
+        std::array<int,dim> bucket_of(const dealii::Point<dim> &point) const;
+
+        /// Transposed distribution of the hanging node constraints.
+        void distribute_transpose(dealii::LinearAlgebra::distributed::Vector<double> &vector) const;
+
+        /// Same DoFHandler as the HighOrderGrid
+        const DoFHandlerType &dof_handler;
+
+        /// Default support radius in number of surface cells.
+        static constexpr double default_support_cells = 10.0;
+        /// Radius of the basis functions.
+        double support_radius;
+        /// Maximum surface interpolation error relative to the largest surface displacement.
+        const double greedy_tolerance;
+        /// Upper bound on the number of control points.
+        const unsigned int max_control_points;
+
+        MPI_Comm mpi_communicator; ///< MPI communicator.
+        dealii::ConditionalOStream pcout; ///< ConditionalOStream for output.
+        dealii::IndexSet locally_owned_dofs; ///< Locally owned DoFs.
+        dealii::IndexSet ghost_dofs; ///< Ghost DoFs.
+
+        /// Locations of the locally owned grid points.
+        std::vector<dealii::Point<dim>> volume_points;
+        /// Global DoF indices of the locally owned grid points.
+        std::vector<PointDoFs> volume_point_dofs;
+        /// Whether the locally owned grid points lie on the surface.
+        std::vector<bool> volume_point_is_surface;
+
+        /// Locations of all the surface points, identical on every process.
+        std::vector<dealii::Point<dim>> surface_points;
+        /// Volume DoF indices of all the surface points.
+        std::vector<PointDoFs> surface_point_dofs;
+        /// Prescribed displacements of all the surface points ordered as [point][direction].
+        std::vector<double> surface_point_displacements;
+        /// Indices within boundary_displacements_vector of the components of the locally owned surface points.
+        std::vector<dealii::types::global_dof_index> local_surface_indices;
+
+        /// Indices of the control points within surface_points.
+        std::vector<unsigned int> control_points;
+        /// Rows of the lower triangular Cholesky factor of the interpolation matrix between control points.
+        /** Row i holds i+1 entries and is appended when control point i is selected.
+         */
+        std::vector<std::vector<double>> cholesky_factor;
+        /// Bucket tree of the control points with buckets the size of the support radius.
+        std::map<std::array<int,dim>, std::vector<unsigned int>> control_buckets;
+
+        /** Displacement of boundary volume_nodes corresponding to HighOrderGrid::surface_to_volume_indices.
+         */
+        const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector;
+    };
+} // namespace MeshMover
+
+} // namespace PHiLiP
+
+#endif
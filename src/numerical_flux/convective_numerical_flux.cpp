@@ -1,6 +1,11 @@
+#include <iostream>
+
 #include "ADTypes.hpp"
 
 #include "convective_numerical_flux.hpp"
+#include "physics/physics_dispatch.h"
+#include "physics/convection_diffusion.h"
+#include "physics/navier_stokes.h"
 
 namespace PHiLiP {
 namespace NumericalFlux {
@@ -24,19 +29,82 @@ std::array<real_tensor, nstate> array_average(
 template <int dim, int nstate, typename real>
 NumericalFluxConvective<dim,nstate,real>::~NumericalFluxConvective() {}
 
+template <int dim, int nstate, typename real>
+void NumericalFluxConvective<dim,nstate,real>
+::evaluate_flux_jacobian (
+    const std::array<real, nstate> &/*soln_int*/,
+    const std::array<real, nstate> &/*soln_ext*/,
+    const dealii::Tensor<1,dim,real> &/*normal_int*/,
+    dealii::Tensor<2,nstate,real> &/*flux_jacobian_int*/,
+    dealii::Tensor<2,nstate,real> &/*flux_jacobian_ext*/) const
+{
+    std::cout << "The analytic Jacobian is not available for this convective numerical flux. "
+              << "Use the automatic differentiation assembly instead." << std::endl;
+    std::abort();
+}
+
+template<int dim, int nstate, typename real>
+void LaxFriedrichs<dim,nstate,real>
+::evaluate_flux_jacobian (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int,
+    dealii::Tensor<2,nstate,real> &flux_jacobian_int,
+    dealii::Tensor<2,nstate,real> &flux_jacobian_ext) const
+{
+    // F* = 0.5*(F(u_int)+F(u_ext)).n - 0.5*lambda*(u_ext-u_int), lambda = max(lambda(u_int), lambda(u_ext))
+    const dealii::Tensor<2,nstate,real> conv_jacobian_int = pde_physics->convective_flux_directional_jacobian(soln_int, normal_int);
+    const dealii::Tensor<2,nstate,real> conv_jacobian_ext = pde_physics->convective_flux_directional_jacobian(soln_ext, normal_int);
+
+    const real conv_max_eig_int = pde_physics->max_convective_eigenvalue(soln_int);
+    const real conv_max_eig_ext = pde_physics->max_convective_eigenvalue(soln_ext);
+    const bool int_is_max = conv_max_eig_int > conv_max_eig_ext;
+    const real conv_max_eig = int_is_max ? conv_max_eig_int : conv_max_eig_ext;
+    const std::array<real,nstate> dmax_eig = int_is_max ? pde_physics->max_convective_eigenvalue_gradient(soln_int)
+                                                         : pde_physics->max_convective_eigenvalue_gradient(soln_ext);
+    dealii::Tensor<2,nstate,real> &flux_jacobian_max = int_is_max ? flux_jacobian_int : flux_jacobian_ext;
+
+    for (int s1=0; s1<nstate; ++s1) {
+        for (int s2=0; s2<nstate; ++s2) {
+            flux_jacobian_int[s1][s2] = 0.5*conv_jacobian_int[s1][s2];
+            flux_jacobian_ext[s1][s2] = 0.5*conv_jacobian_ext[s1][s2];
+        }
+        flux_jacobian_int[s1][s1] += 0.5*conv_max_eig;
+        flux_jacobian_ext[s1][s1] -= 0.5*conv_max_eig;
+    }
+    for (int s1=0; s1<nstate; ++s1) {
+        const real jump = soln_ext[s1] - soln_int[s1];
+        for (int s2=0; s2<nstate; ++s2) {
+            flux_jacobian_max[s1][s2] -= 0.5*jump*dmax_eig[s2];
+        }
+    }
+}
+
 template<int dim, int nstate, typename real>
 std::array<real, nstate> LaxFriedrichs<dim,nstate,real>
 ::evaluate_flux (
     const std::array<real, nstate> &soln_int,
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal_int) const
+{
+    return evaluate_flux<Physics::PhysicsBase<dim,nstate,real>> (*pde_physics, soln_int, soln_ext, normal_int);
+}
+
+template<int dim, int nstate, typename real>
+template <typename PhysicsType>
+std::array<real, nstate> LaxFriedrichs<dim,nstate,real>
+::evaluate_flux (
+    const PhysicsType &physics,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int) const
 {
     using RealArrayVector = std::array<dealii::Tensor<1,dim,real>,nstate>;
     RealArrayVector conv_phys_flux_int;
     RealArrayVector conv_phys_flux_ext;
 
-    conv_phys_flux_int = pde_physics->convective_flux (soln_int);
-    conv_phys_flux_ext = pde_physics->convective_flux (soln_ext);
+    conv_phys_flux_int = Physics::dispatch_convective_flux (physics, soln_int);
+    conv_phys_flux_ext = Physics::dispatch_convective_flux (physics, soln_ext);
     
     //RealArrayVector flux_avg = array_average<nstate, dealii::Tensor<1,dim,real>> (conv_phys_flux_int, conv_phys_flux_ext);
     RealArrayVector flux_avg;
@@ -47,8 +115,8 @@ std::array<real, nstate> LaxFriedrichs<dim,nstate,real>
         }
     }
 
-    const real conv_max_eig_int = pde_physics->max_convective_eigenvalue(soln_int);
-    const real conv_max_eig_ext = pde_physics->max_convective_eigenvalue(soln_ext);
+    const real conv_max_eig_int = Physics::dispatch_max_convective_eigenvalue(physics, soln_int);
+    const real conv_max_eig_ext = Physics::dispatch_max_convective_eigenvalue(physics, soln_ext);
     // Replaced the std::max with an if-statement for the AD to work properly.
     //const real conv_max_eig = std::max(conv_max_eig_int, conv_max_eig_ext);
     real conv_max_eig;
@@ -188,8 +256,8 @@ void L2Roe<dim,nstate,real>
     }
 }
 
-template <int dim, int nstate, typename real>
-std::array<real, nstate> RoeBase<dim,nstate,real>
+template <int dim, int nstate, typename real, typename Derived>
+std::array<real, nstate> RoeBase<dim,nstate,real,Derived>
 ::evaluate_flux (
     const std::array<real, nstate> &soln_int,
     const std::array<real, nstate> &soln_ext,
@@ -285,11 +353,13 @@ std::array<real, nstate> RoeBase<dim,nstate,real>
         dVt[d] = (velocities_R[d] - velocities_L[d]) - dVn*normal_int[d];
     }
 
+    const Derived &roe_flux = static_cast<const Derived&>(*this);
+
     // Evaluate entropy fix on wave speeds
-    evaluate_entropy_fix (eig_L, eig_R, eig_ravg, vel2_ravg, sound_ravg);
+    roe_flux.evaluate_entropy_fix (eig_L, eig_R, eig_ravg, vel2_ravg, sound_ravg);
 
     // Evaluate additional modifications to the Roe-Pike scheme (if applicable)
-    evaluate_additional_modifications (soln_int, soln_ext, eig_L, eig_R, dVn, dVt);
+    roe_flux.evaluate_additional_modifications (soln_int, soln_ext, eig_L, eig_R, dVn, dVt);
 
     // Physical fluxes
     const std::array<real,nstate> normal_flux_int = euler_physics->convective_normal_flux (soln_int, normal_int);
@@ -397,12 +467,6 @@ template class LaxFriedrichs<PHILIP_DIM, 3, RadFadType >;
 template class LaxFriedrichs<PHILIP_DIM, 4, RadFadType >;
 template class LaxFriedrichs<PHILIP_DIM, 5, RadFadType >;
 
-template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, double>;
-template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, FadType >;
-template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, RadType >;
-template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, FadFadType >;
-template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, RadFadType >;
-
 template class RoePike<PHILIP_DIM, PHILIP_DIM+2, double>;
 template class RoePike<PHILIP_DIM, PHILIP_DIM+2, FadType >;
 template class RoePike<PHILIP_DIM, PHILIP_DIM+2, RadType >;
@@ -414,6 +478,25 @@ template class L2Roe<PHILIP_DIM, PHILIP_DIM+2, RadType >;
 template class L2Roe<PHILIP_DIM, PHILIP_DIM+2, FadFadType >;
 template class L2Roe<PHILIP_DIM, PHILIP_DIM+2, RadFadType >;
 
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, double, RoePike<PHILIP_DIM, PHILIP_DIM+2, double>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, FadType, RoePike<PHILIP_DIM, PHILIP_DIM+2, FadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, RadType, RoePike<PHILIP_DIM, PHILIP_DIM+2, RadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, FadFadType, RoePike<PHILIP_DIM, PHILIP_DIM+2, FadFadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, RadFadType, RoePike<PHILIP_DIM, PHILIP_DIM+2, RadFadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, double, L2Roe<PHILIP_DIM, PHILIP_DIM+2, double>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, FadType, L2Roe<PHILIP_DIM, PHILIP_DIM+2, FadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, RadType, L2Roe<PHILIP_DIM, PHILIP_DIM+2, RadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, FadFadType, L2Roe<PHILIP_DIM, PHILIP_DIM+2, FadFadType>>;
+template class RoeBase<PHILIP_DIM, PHILIP_DIM+2, RadFadType, L2Roe<PHILIP_DIM, PHILIP_DIM+2, RadFadType>>;
+
+// Lax-Friedrichs flux of the statically dispatched residual kernels
+template std::array<double, 1> LaxFriedrichs<PHILIP_DIM, 1, double>::evaluate_flux<Physics::ConvectionDiffusion<PHILIP_DIM, 1, double>> (
+    const Physics::ConvectionDiffusion<PHILIP_DIM, 1, double> &, const std::array<double, 1> &, const std::array<double, 1> &, const dealii::Tensor<1,PHILIP_DIM,double> &) const;
+template std::array<double, PHILIP_DIM+2> LaxFriedrichs<PHILIP_DIM, PHILIP_DIM+2, double>::evaluate_flux<Physics::Euler<PHILIP_DIM, PHILIP_DIM+2, double>> (
+    const Physics::Euler<PHILIP_DIM, PHILIP_DIM+2, double> &, const std::array<double, PHILIP_DIM+2> &, const std::array<double, PHILIP_DIM+2> &, const dealii::Tensor<1,PHILIP_DIM,double> &) const;
+template std::array<double, PHILIP_DIM+2> LaxFriedrichs<PHILIP_DIM, PHILIP_DIM+2, double>::evaluate_flux<Physics::NavierStokes<PHILIP_DIM, PHILIP_DIM+2, double>> (
+    const Physics::NavierStokes<PHILIP_DIM, PHILIP_DIM+2, double> &, const std::array<double, PHILIP_DIM+2> &, const std::array<double, PHILIP_DIM+2> &, const dealii::Tensor<1,PHILIP_DIM,double> &) const;
+
 
 } // NumericalFlux namespace
 } // PHiLiP namespace
@@ -23,6 +23,17 @@ virtual std::array<real, nstate> evaluate_flux (
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal1) const = 0;
 
+/// Derivatives of the numerical flux with respect to the interior and exterior solutions.
+/** Used by the analytic Jacobian assembly.
+ *  The default implementation aborts since not all numerical fluxes provide it.
+ */
+virtual void evaluate_flux_jacobian (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal1,
+    dealii::Tensor<2,nstate,real> &flux_jacobian_int,
+    dealii::Tensor<2,nstate,real> &flux_jacobian_ext) const;
+
 };
 
 
@@ -46,6 +57,27 @@ std::array<real, nstate> evaluate_flux (
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal1) const;
 
+/// Lax-Friedrichs flux using the given @p physics, whose calls are bound at compile time if PhysicsType is concrete.
+/** Instantiated for PhysicsBase and for the physics of the statically dispatched residual kernels.
+ */
+template <typename PhysicsType>
+std::array<real, nstate> evaluate_flux (
+    const PhysicsType &physics,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal1) const;
+
+/// Analytic derivatives of the Lax-Friedrichs flux.
+/** The dissipation coefficient is differentiated through the side whose maximum eigenvalue is used,
+ *  consistently with the branch taken by evaluate_flux().
+ */
+void evaluate_flux_jacobian (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal1,
+    dealii::Tensor<2,nstate,real> &flux_jacobian_int,
+    dealii::Tensor<2,nstate,real> &flux_jacobian_ext) const;
+
 protected:
 /// Numerical flux requires physics to evaluate convective eigenvalues.
 const std::shared_ptr < Physics::PhysicsBase<dim, nstate, real> > pde_physics;
@@ -53,7 +85,10 @@ const std::shared_ptr < Physics::PhysicsBase<dim, nstate, real> > pde_physics;
 };
 
 /// Base class of Roe (Roe-Pike) flux with entropy fix. Derived from NumericalFluxConvective.
-template<int dim, int nstate, typename real>
+/** The entropy fix and the additional modifications are statically dispatched to Derived,
+ *  which must provide evaluate_entropy_fix() and evaluate_additional_modifications().
+ */
+template<int dim, int nstate, typename real, typename Derived>
 class RoeBase: public NumericalFluxConvective<dim, nstate, real>
 {
 protected:
@@ -70,23 +105,6 @@ public:
 	/// Destructor
 	~RoeBase() {};
 
-	/// Virtual member function for evaluating the entropy fix for a Roe-Pike flux.
-	virtual void evaluate_entropy_fix (
-	    const std::array<real, 3> &eig_L,
-	    const std::array<real, 3> &eig_R,
-	    std::array<real, 3> &eig_RoeAvg,
-	    const real vel2_ravg,
-	    const real sound_ravg) const = 0;
-
-	/// Virtual member function for evaluating additional modifications/corrections for a Roe-Pike flux.
-	virtual void evaluate_additional_modifications (
-	    const std::array<real, nstate> &soln_int,
-	    const std::array<real, nstate> &soln_ext,
-	    const std::array<real, 3> &eig_L,
-	    const std::array<real, 3> &eig_R,
-	    real &dV_normal, 
-	    dealii::Tensor<1,dim,real> &dV_tangent) const = 0;
-
 	/// Returns the convective flux at an interface
 	/// --- See Blazek 2015, p.103-105
 	/// --- Note: Modified calculation of alpha_{3,4} to use 
@@ -96,16 +114,29 @@ public:
 	    const std::array<real, nstate> &soln_int,
 	    const std::array<real, nstate> &soln_ext,
 	    const dealii::Tensor<1,dim,real> &normal1) const;
+
+	/// Same as evaluate_flux(), without going through the virtual table.
+	/** The Euler physics calls of the Roe flux are already non-virtual, hence @p physics is unused.
+	 */
+	template <typename PhysicsType>
+	std::array<real, nstate> evaluate_flux (
+	    const PhysicsType &/*physics*/,
+	    const std::array<real, nstate> &soln_int,
+	    const std::array<real, nstate> &soln_ext,
+	    const dealii::Tensor<1,dim,real> &normal1) const
+	{
+	    return RoeBase::evaluate_flux (soln_int, soln_ext, normal1);
+	}
 };
 
 /// RoePike flux with entropy fix. Derived from RoeBase.
 template<int dim, int nstate, typename real>
-class RoePike: public RoeBase<dim, nstate, real>
+class RoePike: public RoeBase<dim, nstate, real, RoePike<dim, nstate, real>>
 {
 public:
 	/// Constructor
 	RoePike(std::shared_ptr <Physics::PhysicsBase<dim, nstate, real>> physics_input)
-		:	RoeBase<dim, nstate, real>(physics_input){}
+		:	RoeBase<dim, nstate, real, RoePike<dim, nstate, real>>(physics_input){}
 
 	/// Evaluates the entropy fix of Harten
 	/// --- See Blazek 2015, p.103-105
@@ -129,12 +160,12 @@ public:
 /// L2Roe flux with entropy fix. Derived from RoeBase.
 /// --- Reference: Osswald et al. (2016 L2Roe)
 template<int dim, int nstate, typename real>
-class L2Roe: public RoeBase<dim, nstate, real>
+class L2Roe: public RoeBase<dim, nstate, real, L2Roe<dim, nstate, real>>
 {
 public:
 	/// Constructor
 	L2Roe(std::shared_ptr <Physics::PhysicsBase<dim, nstate, real>> physics_input)
-		:	RoeBase<dim, nstate, real>(physics_input){}
+		:	RoeBase<dim, nstate, real, L2Roe<dim, nstate, real>>(physics_input){}
 
 	/// (1) Van Leer et al. (1989 Sonic) entropy fix for acoustic waves (i.e. i=1,5)
 	/// (2) For waves (i=2,3,4) --> Entropy fix of Liou (2000 Mass)
@@ -0,0 +1,86 @@
+#ifndef __NUMERICAL_FLUX_DISPATCH__
+#define __NUMERICAL_FLUX_DISPATCH__
+
+#include <array>
+#include <type_traits>
+
+#include <deal.II/base/tensor.h>
+
+namespace PHiLiP {
+namespace NumericalFlux {
+
+/// Excludes a function parameter from the template argument deduction.
+/** Such that the coefficients are converted to the type of the solution, as done by the virtual functions.
+ */
+template <typename T>
+struct non_deduced { using type = T; };
+
+/// Convective numerical flux at an interface.
+/** The abstract NumericalFluxConvective is called through its virtual function with its own physics.
+ *  A concrete ConvFluxType is called through its physics-templated evaluate_flux() with @p physics.
+ */
+template <typename ConvFluxType, typename PhysicsType, typename real, std::size_t nstate, int dim>
+std::array<real, nstate> dispatch_evaluate_flux (
+    const ConvFluxType &conv_num_flux,
+    const PhysicsType &physics,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int)
+{
+    if constexpr (std::is_abstract<ConvFluxType>::value) {
+        return conv_num_flux.evaluate_flux (soln_int, soln_ext, normal_int);
+    } else {
+        return conv_num_flux.evaluate_flux (physics, soln_int, soln_ext, normal_int);
+    }
+}
+
+/// Dissipative solution flux at an interface.
+template <typename DissFluxType, typename real, std::size_t nstate, int dim>
+std::array<real, nstate> dispatch_evaluate_solution_flux (
+    const DissFluxType &diss_num_flux,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int)
+{
+    if constexpr (std::is_abstract<DissFluxType>::value) {
+        return diss_num_flux.evaluate_solution_flux (soln_int, soln_ext, normal_int);
+    } else {
+        return diss_num_flux.DissFluxType::evaluate_solution_flux (soln_int, soln_ext, normal_int);
+    }
+}
+
+/// Dissipative auxiliary flux at an interface.
+/** Same convention as dispatch_evaluate_flux().
+ */
+template <typename DissFluxType, typename PhysicsType, typename real, std::size_t nstate, int dim>
+std::array<real, nstate> dispatch_evaluate_auxiliary_flux (
+    const DissFluxType &diss_num_flux,
+    const PhysicsType &physics,
+    const typename non_deduced<real>::type artificial_diss_coeff_int,
+    const typename non_deduced<real>::type artificial_diss_coeff_ext,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_int,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_ext,
+    const dealii::Tensor<1,dim,real> &normal_int,
+    const typename non_deduced<real>::type &penalty,
+    const bool on_boundary = false)
+{
+    if constexpr (std::is_abstract<DissFluxType>::value) {
+        return diss_num_flux.evaluate_auxiliary_flux (
+            artificial_diss_coeff_int, artificial_diss_coeff_ext,
+            soln_int, soln_ext, soln_grad_int, soln_grad_ext,
+            normal_int, penalty, on_boundary);
+    } else {
+        return diss_num_flux.evaluate_auxiliary_flux (
+            physics,
+            artificial_diss_coeff_int, artificial_diss_coeff_ext,
+            soln_int, soln_ext, soln_grad_int, soln_grad_ext,
+            normal_int, penalty, on_boundary);
+    }
+}
+
+} // NumericalFlux namespace
+} // PHiLiP namespace
+
+#endif
@@ -1,6 +1,9 @@
 #include "ADTypes.hpp"
 
 #include "viscous_numerical_flux.hpp"
+#include "physics/physics_dispatch.h"
+#include "physics/convection_diffusion.h"
+#include "physics/navier_stokes.h"
 
 namespace PHiLiP {
 namespace NumericalFlux {
@@ -72,6 +75,30 @@ std::array<real, nstate> SymmetricInternalPenalty<dim,nstate,real>
     const dealii::Tensor<1,dim,real> &normal_int,
     const real &penalty,
     const bool on_boundary) const
+{
+    return evaluate_auxiliary_flux<Physics::PhysicsBase<dim,nstate,real>> (
+        *pde_physics,
+        artificial_diss_coeff_int, artificial_diss_coeff_ext,
+        soln_int, soln_ext,
+        soln_grad_int, soln_grad_ext,
+        normal_int, penalty,
+        on_boundary);
+}
+
+template<int dim, int nstate, typename real>
+template <typename PhysicsType>
+std::array<real, nstate> SymmetricInternalPenalty<dim,nstate,real>
+::evaluate_auxiliary_flux (
+    const PhysicsType &physics,
+    const real artificial_diss_coeff_int,
+    const real artificial_diss_coeff_ext,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_int,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_ext,
+    const dealii::Tensor<1,dim,real> &normal_int,
+    const real &penalty,
+    const bool on_boundary) const
 {
     using ArrayTensor1 = std::array<dealii::Tensor<1,dim,real>, nstate>;
 
@@ -84,7 +111,8 @@ std::array<real, nstate> SymmetricInternalPenalty<dim,nstate,real>
         //const std::array<dealii::Tensor<1,dim,real>, nstate> soln_grad_bc = soln_grad_ext;
         real artificial_diss_coeff_bc = artificial_diss_coeff_int;
 
-        return evaluate_auxiliary_flux ( artificial_diss_coeff_int, artificial_diss_coeff_bc,
+        return evaluate_auxiliary_flux ( physics,
+                                         artificial_diss_coeff_int, artificial_diss_coeff_bc,
                                          soln_int, soln_bc,
                                          soln_grad_int, soln_grad_bc,
                                          normal_int, penalty,
@@ -94,16 +122,16 @@ std::array<real, nstate> SymmetricInternalPenalty<dim,nstate,real>
     ArrayTensor1 phys_flux_int, phys_flux_ext;
 
     // {{A*grad_u}}
-    phys_flux_int = pde_physics->dissipative_flux (soln_int, soln_grad_int);
-    phys_flux_ext = pde_physics->dissipative_flux (soln_ext, soln_grad_ext);
+    phys_flux_int = Physics::dispatch_dissipative_flux (physics, soln_int, soln_grad_int);
+    phys_flux_ext = Physics::dispatch_dissipative_flux (physics, soln_ext, soln_grad_ext);
 
     ArrayTensor1 phys_flux_avg = array_average<nstate,dim,real>(phys_flux_int, phys_flux_ext);
 
     // {{A}}*[[u]]
     ArrayTensor1 soln_jump     = array_jump<dim,nstate,real>(soln_int, soln_ext, normal_int);
     ArrayTensor1 A_jumpu_int, A_jumpu_ext;
-    A_jumpu_int = pde_physics->dissipative_flux (soln_int, soln_jump);
-    A_jumpu_ext = pde_physics->dissipative_flux (soln_ext, soln_jump);
+    A_jumpu_int = Physics::dispatch_dissipative_flux (physics, soln_int, soln_jump);
+    A_jumpu_ext = Physics::dispatch_dissipative_flux (physics, soln_ext, soln_jump);
     const ArrayTensor1 A_jumpu_avg = array_average<nstate,dim,real>(A_jumpu_int, A_jumpu_ext);
 
     std::array<real,nstate> auxiliary_flux_dot_n;
@@ -167,6 +195,30 @@ std::array<real, nstate> BassiRebay2<dim,nstate,real>
     const dealii::Tensor<1,dim,real> &normal_int,
     const real &penalty,
     const bool on_boundary) const
+{
+    return evaluate_auxiliary_flux<Physics::PhysicsBase<dim,nstate,real>> (
+        *pde_physics,
+        artificial_diss_coeff_int, artificial_diss_coeff_ext,
+        soln_int, soln_ext,
+        soln_grad_int, soln_grad_ext,
+        normal_int, penalty,
+        on_boundary);
+}
+
+template<int dim, int nstate, typename real>
+template <typename PhysicsType>
+std::array<real, nstate> BassiRebay2<dim,nstate,real>
+::evaluate_auxiliary_flux (
+    const PhysicsType &physics,
+    const real artificial_diss_coeff_int,
+    const real artificial_diss_coeff_ext,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_int,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_ext,
+    const dealii::Tensor<1,dim,real> &normal_int,
+    const real &penalty,
+    const bool on_boundary) const
 {
     using ArrayTensor1 = std::array<dealii::Tensor<1,dim,real>, nstate>;
 
@@ -191,8 +243,8 @@ std::array<real, nstate> BassiRebay2<dim,nstate,real>
     ArrayTensor1 phys_flux_int, phys_flux_ext;
 
     // {{A*grad_u}}
-    phys_flux_int = pde_physics->dissipative_flux (soln_int, soln_grad_int);
-    phys_flux_ext = pde_physics->dissipative_flux (soln_ext, soln_grad_ext);
+    phys_flux_int = Physics::dispatch_dissipative_flux (physics, soln_int, soln_grad_int);
+    phys_flux_ext = Physics::dispatch_dissipative_flux (physics, soln_ext, soln_grad_ext);
 
     ArrayTensor1 phys_flux_avg = array_average<nstate,dim,real>(phys_flux_int, phys_flux_ext);
 
@@ -306,5 +358,19 @@ template class BassiRebay2<PHILIP_DIM, 3, RadFadType >;
 template class BassiRebay2<PHILIP_DIM, 4, RadFadType >;
 template class BassiRebay2<PHILIP_DIM, 5, RadFadType >;
 
+// Auxiliary fluxes of the statically dispatched residual kernels
+template std::array<double, 1> SymmetricInternalPenalty<PHILIP_DIM, 1, double>::evaluate_auxiliary_flux<Physics::ConvectionDiffusion<PHILIP_DIM, 1, double>> (
+    const Physics::ConvectionDiffusion<PHILIP_DIM, 1, double> &,
+    const double, const double,
+    const std::array<double, 1> &, const std::array<double, 1> &,
+    const std::array<dealii::Tensor<1,PHILIP_DIM,double>, 1> &, const std::array<dealii::Tensor<1,PHILIP_DIM,double>, 1> &,
+    const dealii::Tensor<1,PHILIP_DIM,double> &, const double &, const bool) const;
+template std::array<double, PHILIP_DIM+2> BassiRebay2<PHILIP_DIM, PHILIP_DIM+2, double>::evaluate_auxiliary_flux<Physics::NavierStokes<PHILIP_DIM, PHILIP_DIM+2, double>> (
+    const Physics::NavierStokes<PHILIP_DIM, PHILIP_DIM+2, double> &,
+    const double, const double,
+    const std::array<double, PHILIP_DIM+2> &, const std::array<double, PHILIP_DIM+2> &,
+    const std::array<dealii::Tensor<1,PHILIP_DIM,double>, PHILIP_DIM+2> &, const std::array<dealii::Tensor<1,PHILIP_DIM,double>, PHILIP_DIM+2> &,
+    const dealii::Tensor<1,PHILIP_DIM,double> &, const double &, const bool) const;
+
 } // NumericalFlux namespace
 } // PHiLiP namespace
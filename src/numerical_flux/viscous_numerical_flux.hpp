@@ -78,6 +78,22 @@ std::array<real, nstate> evaluate_auxiliary_flux (
     const dealii::Tensor<1,dim,real> &normal_int,
     const real &penalty,
     const bool on_boundary = false) const override;
+
+/// Same as the above using the given @p physics, whose calls are bound at compile time if PhysicsType is concrete.
+/** Instantiated for PhysicsBase and for the physics of the statically dispatched residual kernels.
+ */
+template <typename PhysicsType>
+std::array<real, nstate> evaluate_auxiliary_flux (
+    const PhysicsType &physics,
+    const real artificial_diss_coeff_int,
+    const real artificial_diss_coeff_ext,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_int,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_ext,
+    const dealii::Tensor<1,dim,real> &normal_int,
+    const real &penalty,
+    const bool on_boundary = false) const;
     
 };
 
@@ -118,6 +134,22 @@ std::array<real, nstate> evaluate_auxiliary_flux (
     const real &penalty,
     const bool on_boundary = false) const override;
 
+/// Same as the above using the given @p physics, whose calls are bound at compile time if PhysicsType is concrete.
+/** Instantiated for PhysicsBase and for the physics of the statically dispatched residual kernels.
+ */
+template <typename PhysicsType>
+std::array<real, nstate> evaluate_auxiliary_flux (
+    const PhysicsType &physics,
+    const real artificial_diss_coeff_int,
+    const real artificial_diss_coeff_ext,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_int,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &soln_grad_ext,
+    const dealii::Tensor<1,dim,real> &normal_int,
+    const real &penalty,
+    const bool on_boundary = false) const;
+
 };
 
 } // NumericalFlux namespace
@@ -1,13 +1,57 @@
 #include "explicit_ode_solver.h"
 
+#ifdef PHILIP_USE_KOKKOS
+#include "dg/strong_dg.hpp"
+#endif
+
 namespace PHiLiP {
 namespace ODE {
 
+#ifdef PHILIP_USE_KOKKOS
+namespace {
+/// Returns the Kokkos residual assembly of @p dg if it is a DGStrong with @p nstate to 5 states, and an empty function otherwise.
+/** The returned function only assembles the residual and returns true if DGStrong::supports_kokkos_residual(). */
+template <int dim, typename real, typename MeshType, int nstate = 1>
+std::function<bool()> get_kokkos_residual_assembly (const std::shared_ptr< DGBase<dim, real, MeshType> > &dg)
+{
+    if constexpr (nstate > 5) {
+        return std::function<bool()>();
+    } else {
+        DGStrong<dim,nstate,real,MeshType> *const dg_strong = dynamic_cast<DGStrong<dim,nstate,real,MeshType> *>(dg.get());
+        if (dg_strong) {
+            return [dg_strong] () {
+                if (!dg_strong->supports_kokkos_residual()) return false;
+                dg_strong->assemble_residual_kokkos();
+                return true;
+            };
+        }
+        return get_kokkos_residual_assembly<dim,real,MeshType,nstate+1>(dg);
+    }
+}
+} // anonymous namespace
+#endif
+
 template <int dim, typename real, typename MeshType>
 ExplicitODESolver<dim,real,MeshType>::ExplicitODESolver(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
         : ODESolverBase<dim,real,MeshType>(dg_input)
+#ifdef PHILIP_USE_KOKKOS
+        , assemble_residual_kokkos(dg_input->all_parameters->use_kokkos_residual
+                                   ? get_kokkos_residual_assembly<dim,real,MeshType>(dg_input)
+                                   : std::function<bool()>())
+#endif
         {}
 
+template <int dim, typename real, typename MeshType>
+void ExplicitODESolver<dim,real,MeshType>::assemble_unsteady_residual ()
+{
+#ifdef PHILIP_USE_KOKKOS
+    // The Kokkos residual does not evaluate the local time steps, which are only needed by the pseudotime steps.
+    // Programs that do not initialize Kokkos and unsupported discretizations keep the standard assembly.
+    if (assemble_residual_kokkos && Kokkos::is_initialized() && assemble_residual_kokkos()) return;
+#endif
+    this->dg->assemble_residual ();
+}
+
 template <int dim, typename real, typename MeshType>
 void ExplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pseudotime)
 {
@@ -45,7 +89,8 @@ void ExplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pse
         // Stage 2
         this->pcout<< "2... " << std::flush;
         this->dg->solution = this->rk_stage[1];
-        this->dg->assemble_residual ();
+        if (pseudotime) this->dg->assemble_residual ();
+        else assemble_unsteady_residual ();
         this->dg->global_inverse_mass_matrix.vmult(this->solution_update, this->dg->right_hand_side);
 
         this->rk_stage[2] = this->rk_stage[0];
@@ -63,7 +108,8 @@ void ExplicitODESolver<dim,real,MeshType>::step_in_time (real dt, const bool pse
         // Stage 3
         this->pcout<< "3... " << std::flush;
         this->dg->solution = this->rk_stage[2];
-        this->dg->assemble_residual ();
+        if (pseudotime) this->dg->assemble_residual ();
+        else assemble_unsteady_residual ();
         this->dg->global_inverse_mass_matrix.vmult(this->solution_update, this->dg->right_hand_side);
 
         this->rk_stage[3] = this->rk_stage[0];
@@ -1,6 +1,8 @@
 #ifndef __EXPLICIT_ODESOLVER__
 #define __EXPLICIT_ODESOLVER__
 
+#include <functional>
+
 #include "dg/dg.h"
 #include "ode_solver_base.h"
 
@@ -27,6 +29,16 @@ public:
 
     /// Function to allocate the ODE system
     void allocate_ode_system ();
+
+protected:
+    /// Assembles the unsteady right-hand side, with DGStrong::assemble_residual_kokkos() if requested and supported.
+    void assemble_unsteady_residual () override;
+
+#ifdef PHILIP_USE_KOKKOS
+    /// Kokkos residual assembly of the DG if use_kokkos_residual is set and the DG is a DGStrong, empty otherwise.
+    /** Returns false without assembling if the discretization is not supported by the Kokkos residual. */
+    std::function<bool()> assemble_residual_kokkos;
+#endif
 };
 
 } // ODE namespace
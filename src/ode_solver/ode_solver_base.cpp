@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
 #include "ode_solver_base.h"
 
 namespace PHiLiP {
@@ -7,6 +11,12 @@ template <int dim, typename real, typename MeshType>
 ODESolverBase<dim,real,MeshType>::ODESolverBase(std::shared_ptr< DGBase<dim, real, MeshType> > dg_input)
         : n_refine(0)
         , current_time(0.0)
+        , current_iteration(0)
+        , total_time_steps(0)
+        , CFL_factor(1.0)
+        , initial_residual_norm(1.0)
+        , advance_start_time(0.0)
+        , restart_pending(dg_input->all_parameters->ode_solver_param.restart_from_checkpoint)
         , dg(dg_input)
         , all_parameters(dg->all_parameters)
         , mpi_communicator(MPI_COMM_WORLD)
@@ -54,6 +64,56 @@ void ODESolverBase<dim,real,MeshType>::valid_initial_conditions () const
     }
 }
 
+template <int dim, typename real, typename MeshType>
+void ODESolverBase<dim,real,MeshType>::write_checkpoint ()
+{
+    const std::string &filename = all_parameters->ode_solver_param.checkpoint_filename;
+    dg->save_checkpoint(filename);
+
+    if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
+        std::ofstream state_file(filename + ".ode_state");
+        state_file.precision(17);
+        state_file << current_time << " "
+                   << current_iteration << " "
+                   << CFL_factor << " "
+                   << initial_residual_norm << " "
+                   << residual_norm << " "
+                   << advance_start_time << " "
+                   << total_time_steps << std::endl;
+        AssertThrow(state_file.good(), dealii::ExcIO());
+    }
+}
+
+template <int dim, typename real, typename MeshType>
+void ODESolverBase<dim,real,MeshType>::read_checkpoint ()
+{
+    const std::string &filename = all_parameters->ode_solver_param.checkpoint_filename;
+    dg->load_checkpoint(filename);
+
+    double state[7] = {0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0};
+    if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
+        std::ifstream state_file(filename + ".ode_state");
+        AssertThrow(state_file.good(), dealii::ExcFileNotOpen(filename + ".ode_state"));
+        for (double &value : state) state_file >> value;
+        AssertThrow(!state_file.fail(), dealii::ExcIO());
+    }
+    MPI_Bcast(state, 7, MPI_DOUBLE, 0, mpi_communicator);
+
+    current_time          = state[0];
+    current_iteration     = static_cast<unsigned int>(state[1]);
+    CFL_factor            = state[2];
+    initial_residual_norm = state[3];
+    residual_norm         = state[4];
+    advance_start_time    = state[5];
+    total_time_steps      = static_cast<unsigned int>(state[6]);
+
+    restart_pending = false;
+
+    pcout << " Restarted from checkpoint " << filename
+          << " at iteration " << current_iteration
+          << " and time " << current_time << std::endl;
+}
+
 template <int dim, typename real, typename MeshType>
 int ODESolverBase<dim,real,MeshType>::steady_state ()
 {
@@ -66,17 +126,20 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
 
     Parameters::ODESolverParam ode_param = ODESolverBase<dim,real,MeshType>::all_parameters->ode_solver_param;
     pcout << " Performing steady state analysis... " << std::endl;
+    const bool restarted = restart_pending;
+    if (restarted) read_checkpoint();
     allocate_ode_system ();
 
     this->residual_norm_decrease = 1; // Always do at least 1 iteration
     update_norm = 1; // Always do at least 1 iteration
-    this->current_iteration = 0;
+    if (!restarted) this->current_iteration = 0;
     if (ode_param.output_solution_every_x_steps >= 0) this->dg->output_results_vtk(this->current_iteration);
 
     pcout << " Evaluating right-hand side and setting system_matrix to Jacobian before starting iterations... " << std::endl;
     this->dg->assemble_residual ();
-    initial_residual_norm = this->dg->get_residual_l2norm();
-    this->residual_norm = initial_residual_norm;
+    // Keep normalizing by the residual of the original run when restarting.
+    if (!restarted) initial_residual_norm = this->dg->get_residual_l2norm();
+    this->residual_norm = this->dg->get_residual_l2norm();
     pcout << " ********************************************************** "
           << std::endl
           << " Initial absolute residual norm: " << this->residual_norm
@@ -84,7 +147,7 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
 
     // Initial Courant-Friedrichs-Lax number
     const double initial_CFL = all_parameters->ode_solver_param.initial_time_step;
-    CFL_factor = 1.0;
+    if (!restarted) CFL_factor = 1.0;
 
     auto initial_solution = dg->solution;
 
@@ -128,7 +191,11 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
         ramped_CFL = std::max(ramped_CFL,initial_CFL*CFL_factor);
         pcout << "Initial CFL = " << initial_CFL << ". Current CFL = " << ramped_CFL << std::endl;
 
-        if (this->residual_norm < 1e-12) {
+        // Freeze the artificial dissipation once converged, and in between the scheduled sensor updates.
+        // The coefficients are then held constant for the Newton step and its linesearch.
+        const int sensor_update_every_x_steps = all_parameters->artificial_dissipation_param.sensor_update_every_x_steps;
+        const bool is_sensor_update_iteration = (this->current_iteration % sensor_update_every_x_steps == 0);
+        if (this->residual_norm < 1e-12 || !is_sensor_update_iteration) {
             this->dg->freeze_artificial_dissipation = true;
         } else {
             this->dg->freeze_artificial_dissipation = false;
@@ -149,6 +216,11 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
             }
         }
 
+        if (ode_param.output_checkpoint_every_x_steps > 0
+            && this->current_iteration % ode_param.output_checkpoint_every_x_steps == 0) {
+            write_checkpoint();
+        }
+
         if ( refine && this->residual_norm < 1e-9 && i_refine < n_refine) {
             i_refine++;
             dg->refine_residual_based();
@@ -162,13 +234,19 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
         convergence_error = this->residual_norm > ode_param.nonlinear_steady_residual_tolerance
                             && this->residual_norm_decrease > ode_param.nonlinear_steady_residual_tolerance;
     }
+    // Only keep the artificial dissipation frozen if it was frozen due to convergence.
+    if (this->residual_norm >= 1e-12) this->dg->freeze_artificial_dissipation = false;
+
     if (this->residual_norm > 1e5
         || std::isnan(this->residual_norm)
         || CFL_factor <= 1e-2)
     {
         this->dg->solution = initial_solution;
 
-        if(CFL_factor <= 1e-2) this->dg->right_hand_side.add(1.0);
+        if(CFL_factor <= 1e-2) {
+            this->dg->right_hand_side.add(1.0);
+            this->dg->invalidate_residual_norms();
+        }
     }
 
     pcout << " ********************************************************** "
@@ -184,6 +262,12 @@ int ODESolverBase<dim,real,MeshType>::steady_state ()
     return convergence_error;
 }
 
+template <int dim, typename real, typename MeshType>
+void ODESolverBase<dim,real,MeshType>::assemble_unsteady_residual ()
+{
+    dg->assemble_residual(false);
+}
+
 template <int dim, typename real, typename MeshType>
 int ODESolverBase<dim,real,MeshType>::advance_solution_time (double time_advance)
 {
@@ -202,24 +286,35 @@ int ODESolverBase<dim,real,MeshType>::advance_solution_time (double time_advance
     pcout
             << " Advancing solution by " << time_advance << " time units, using "
             << number_of_time_steps << " iterations of size dt=" << constant_time_step << " ... " << std::endl;
+    const bool restarted = restart_pending;
+    if (restarted) read_checkpoint();
     allocate_ode_system ();
 
-    this->current_iteration = 0;
+    if (!restarted) {
+        this->current_iteration = 0;
+        this->advance_start_time = this->current_time;
 
-    // Output initial solution
-    this->dg->output_results_vtk(this->current_iteration);
+        // Output initial solution
+        this->dg->output_results_vtk(this->current_iteration);
+    }
 
-    while (this->current_iteration < number_of_time_steps)
+    // A restarted run only takes the steps left between the restored time and the final time of the interrupted call.
+    const double final_time = this->advance_start_time + time_advance;
+    const unsigned int remaining_time_steps = restarted
+        ? static_cast<unsigned int>(std::max(0.0, std::round((final_time - this->current_time)/constant_time_step)))
+        : number_of_time_steps;
+    const unsigned int final_iteration = this->current_iteration + remaining_time_steps;
+    while (this->current_iteration < final_iteration)
     {
         if ((ode_param.ode_output) == Parameters::OutputEnum::verbose &&
             (this->current_iteration%ode_param.print_iteration_modulo) == 0 ) {
             pcout << " ********************************************************** "
                   << std::endl
                   << " Iteration: " << this->current_iteration + 1
-                  << " out of: " << number_of_time_steps
+                  << " out of: " << final_iteration
                   << std::endl;
         }
-        dg->assemble_residual(false);
+        assemble_unsteady_residual();
 
         if ((ode_param.ode_output) == Parameters::OutputEnum::verbose &&
             (this->current_iteration%ode_param.print_iteration_modulo) == 0 ) {
@@ -244,6 +339,13 @@ int ODESolverBase<dim,real,MeshType>::advance_solution_time (double time_advance
             }
         }
         ++(this->current_iteration);
+        ++(this->total_time_steps);
+
+        // Count the steps over all the calls such that callers advancing by a single dt still checkpoint.
+        if (ode_param.output_checkpoint_every_x_steps > 0
+            && this->total_time_steps % ode_param.output_checkpoint_every_x_steps == 0) {
+            write_checkpoint();
+        }
     }
 
     if (ode_param.output_solution_vector_modulo > 0) {
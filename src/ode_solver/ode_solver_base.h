@@ -65,11 +65,24 @@ public:
     /// Virtual function to allocate the ODE system
     virtual void allocate_ode_system () = 0;
 
+    /// Writes a checkpoint of the DG state and of the ODE solver state.
+    /** The triangulation, solution and high-order grid are written through DGBase::save_checkpoint().
+     *  The scalar solver state is written by the first processor to checkpoint_filename.ode_state.
+     */
+    void write_checkpoint ();
+
+    /// Restores the DG and ODE solver state written by write_checkpoint().
+    void read_checkpoint ();
+
     double residual_norm; ///< Current residual norm. Only makes sense for steady state
     double residual_norm_decrease; ///< Current residual norm normalized by initial residual. Only makes sense for steady state
 
     unsigned int current_iteration; ///< Current iteration.
 
+    /// Time steps taken over all the advance_solution_time() calls.
+    /** Unlike current_iteration, it is not reset by each call. Used to schedule the checkpoints. */
+    unsigned int total_time_steps;
+
 protected:
     /// Hard-coded way to play around with h-adaptivity.
     /// Not recommended to be used.
@@ -82,9 +95,23 @@ protected:
      */
     double CFL_factor;
 
+    /// Assembles the right-hand side of the unsteady time steps of advance_solution_time().
+    /** Defaults to DGBase::assemble_residual() without derivatives. */
+    virtual void assemble_unsteady_residual ();
+
     double update_norm; ///< Norm of the solution update.
     double initial_residual_norm; ///< Initial residual norm.
 
+    /// Time at the start of the current advance_solution_time() call.
+    /** Stored in the checkpoint such that a restarted call stops at the final time of the interrupted one. */
+    double advance_start_time;
+
+    /// Whether the next steady_state() or advance_solution_time() restores the checkpoint.
+    /** Set by ODESolverParam::restart_from_checkpoint and cleared once the checkpoint is read,
+     *  such that repeated solves continue from the current solution.
+     */
+    bool restart_pending;
+
     /// Solution update given by the ODE solver
     dealii::LinearAlgebra::distributed::Vector<double> solution_update;
 
@@ -1,5 +1,4 @@
 #include "optimization/flow_constraints.hpp"
-#include "mesh/meshmover_linear_elasticity.hpp"
 
 #include "rol_to_dealii_vector.hpp"
 
@@ -8,6 +7,8 @@
 #include <Epetra_RowMatrixTransposer.h>
 
 #include "Ifpack.h"
+#include <Amesos.h>
+#include <AztecOO.h>
 
 #include "global_counter.hpp"
 
@@ -26,8 +27,12 @@ FlowConstraints<dim>
     , ffd_design_variables_indices_dim(_ffd_design_variables_indices_dim)
     , jacobian_prec(nullptr)
     , adjoint_jacobian_prec(nullptr)
+    , n_cache_hits(0)
+    , n_cache_misses(0)
+    , current_optimization_iteration(-1)
 {
     flow_CFL_ = 0.0;
+    use_optimizer_linear_tolerance = false;
 
     const unsigned int n_design_variables = ffd_design_variables_indices_dim.size();
     const dealii::IndexSet row_part = dealii::Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,n_design_variables);
@@ -41,13 +46,8 @@ FlowConstraints<dim>
     initial_ffd_des_var.update_ghost_values();
 
     //if(dXvdXp.m() == 0) ffd.get_dXvdXp ( *(dg->high_order_grid), ffd_design_variables_indices_dim, dXvdXp);
-    if (precomputed_dXvdXp) {
-        if (precomputed_dXvdXp->m() == dg->high_order_grid->volume_nodes.size() && precomputed_dXvdXp->n() == n_design_variables) {
-            dXvdXp.copy_from(*precomputed_dXvdXp);
-        }
-    } else {
-        ffd.get_dXvdXp ( *(dg->high_order_grid), ffd_design_variables_indices_dim, dXvdXp);
-    }
+    ffd.mesh_mover_type = dg->all_parameters->mesh_mover_type;
+    dXvdXp = std::make_shared<MeshSensitivityOperator<dim>>(ffd, dg->high_order_grid, ffd_design_variables_indices_dim, precomputed_dXvdXp);
     //ffd.get_dXvdXp_FD ( *(dg->high_order_grid), ffd_design_variables_indices_dim, dXvdXp, 1e-6);
 
     dealii::ParameterHandler parameter_handler;
@@ -82,10 +82,50 @@ FlowConstraints<dim>
 template<int dim>
 FlowConstraints<dim>::~FlowConstraints()
 {
+    report_cache_statistics();
     destroy_JacobianPreconditioner_1();
     destroy_AdjointJacobianPreconditioner_1();
 }
 
+template<int dim>
+bool FlowConstraints<dim>
+::is_current_linearization(const LinearizationPoint &point) const
+{
+    if (!point.valid || point.flow_CFL != flow_CFL_) return false;
+    if (point.solution.size() != dg->solution.size() || point.volume_nodes.size() != dg->high_order_grid->volume_nodes.size()) return false;
+
+    auto diff_solution = dg->solution;
+    diff_solution -= point.solution;
+    auto diff_nodes = dg->high_order_grid->volume_nodes;
+    diff_nodes -= point.volume_nodes;
+    return (diff_solution.linfty_norm() == 0.0 && diff_nodes.linfty_norm() == 0.0);
+}
+
+template<int dim>
+void FlowConstraints<dim>
+::store_current_linearization(LinearizationPoint &point) const
+{
+    point.valid = true;
+    point.solution = dg->solution;
+    point.volume_nodes = dg->high_order_grid->volume_nodes;
+    point.flow_CFL = flow_CFL_;
+}
+
+template<int dim>
+void FlowConstraints<dim>
+::report_cache_statistics()
+{
+    const int n_requests = n_cache_hits + n_cache_misses;
+    if (i_print && n_requests > 0) {
+        std::cout << " Optimization iteration " << current_optimization_iteration
+                  << ": reused " << n_cache_hits << " out of " << n_requests
+                  << " Jacobian preconditioners/factorizations ("
+                  << 100.0 * n_cache_hits / n_requests << "% hit rate)." << std::endl;
+    }
+    n_cache_hits = 0;
+    n_cache_misses = 0;
+}
+
 template<int dim>
 void FlowConstraints<dim>
 ::update_1( const ROL::Vector<double>& des_var_sim, bool flag, int iter )
@@ -99,7 +139,11 @@ template<int dim>
 void FlowConstraints<dim>
 ::update_2( const ROL::Vector<double>& des_var_ctl, bool flag, int iter )
 {
-    (void) flag; (void) iter;
+    (void) flag;
+    if (iter != -1 && iter != current_optimization_iteration) {
+        report_cache_statistics();
+        current_optimization_iteration = iter;
+    }
     ffd_des_var =  ROL_vector_to_dealii_vector_reference(des_var_ctl);
     auto current_ffd_des_var = ffd_des_var;
     ffd.get_design_variables( ffd_design_variables_indices_dim, current_ffd_des_var);
@@ -120,7 +164,7 @@ void FlowConstraints<dim>
         dXp -= initial_ffd_des_var;
         dXp.update_ghost_values();
         auto dXv = dg->high_order_grid->volume_nodes;
-        dXvdXp.vmult(dXv, dXp);
+        dXvdXp->apply_dXvdXp(dXp, dXv);
         dg->high_order_grid->volume_nodes = dg->high_order_grid->initial_volume_nodes;
         dg->high_order_grid->volume_nodes += dXv;
         dg->high_order_grid->volume_nodes.update_ghost_values();
@@ -207,7 +251,7 @@ void FlowConstraints<dim>
     const ROL::Vector<double>& input_vector,
     const ROL::Vector<double>& des_var_sim,
     const ROL::Vector<double>& des_var_ctl,
-    double& /*tol*/ )
+    double& tol )
 {
 
     update_1(des_var_sim);
@@ -242,7 +286,8 @@ void FlowConstraints<dim>
     //MPI_Barrier(MPI_COMM_WORLD);
     //dg->system_matrix.print(std::cout);
 
-    solve_linear (dg->system_matrix, input_vector_v, output_vector_v, this->linear_solver_param);
+    const bool adjoint = false;
+    solve_linear_cached (adjoint, input_vector_v, output_vector_v, tol);
     //solve_linear_2 ( this->dg->system_matrix, input_vector_v, output_vector_v, this->linear_solver_param);
     //try {
     //  solve_linear (dg->system_matrix, input_vector_v, output_vector_v, this->linear_solver_param);
@@ -267,85 +312,164 @@ void FlowConstraints<dim>
 }
 
 template<int dim>
-int FlowConstraints<dim>
-::construct_JacobianPreconditioner_1(
-    const ROL::Vector<double>& des_var_sim,
-    const ROL::Vector<double>& des_var_ctl)
+void FlowConstraints<dim>
+::update_preconditioner(
+    Ifpack_Preconditioner *&preconditioner,
+    LinearizationPoint &preconditioner_point,
+    const dealii::TrilinosWrappers::SparseMatrix &matrix)
 {
-    update_1(des_var_sim);
-    update_2(des_var_ctl);
-
-    const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
-    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
+    if (preconditioner && is_current_linearization(preconditioner_point)) {
+        ++n_cache_hits;
+        return;
+    }
+    ++n_cache_misses;
 
-    Epetra_CrsMatrix * jacobian = const_cast<Epetra_CrsMatrix *>(&(dg->system_matrix.trilinos_matrix()));
+    Epetra_CrsMatrix * epetra_matrix = const_cast<Epetra_CrsMatrix *>(&(matrix.trilinos_matrix()));
 
-    destroy_JacobianPreconditioner_1();
+    delete preconditioner;
+    preconditioner = nullptr;
     Ifpack Factory;
 
     Teuchos::ParameterList List;
 
     const std::string PrecType = "ILUT"; 
-    List.set("fact: ilut level-of-fill", 50.0);
-    List.set("fact: absolute threshold", 1e-3);
-    List.set("fact: relative threshold", 1.01);//1.0+1e-2);
-    List.set("fact: drop tolerance", 0.0);//1e-12);
+    List.set("fact: ilut level-of-fill", static_cast<double>(linear_solver_param.ilut_fill));
+    List.set("fact: absolute threshold", linear_solver_param.ilut_atol);
+    List.set("fact: relative threshold", linear_solver_param.ilut_rtol);
+    List.set("fact: drop tolerance", linear_solver_param.ilut_drop);
 
     //const std::string PrecType = "ILU"; 
     //List.set("fact: level-of-fill", 0);
 
     List.set("schwarz: reordering type", "rcm");
     const int OverlapLevel = 1; // one row of overlap among the processes
-    jacobian_prec = Factory.Create(PrecType, jacobian, OverlapLevel);
-    assert (jacobian_prec != 0);
-
+    preconditioner = Factory.Create(PrecType, epetra_matrix, OverlapLevel);
+    AssertThrow(preconditioner != nullptr, dealii::ExcMessage("Failed to create the Ifpack preconditioner."));
 
+    int ierr = preconditioner->SetParameters(List);
+    AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+    ierr = preconditioner->Initialize();
+    AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+    ierr = preconditioner->Compute();
+    AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
 
+    store_current_linearization(preconditioner_point);
+}
 
-    IFPACK_CHK_ERR(jacobian_prec->SetParameters(List));
-    IFPACK_CHK_ERR(jacobian_prec->Initialize());
-    IFPACK_CHK_ERR(jacobian_prec->Compute());
-
-    return 0;
+template<int dim>
+void FlowConstraints<dim>
+::solve_linear_cached(
+    const bool adjoint,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const double relative_tolerance)
+{
+    const dealii::TrilinosWrappers::SparseMatrix &matrix = adjoint ? dg->system_matrix_transpose : dg->system_matrix;
+
+    if (linear_solver_param.linear_solver_type == Parameters::LinearSolverParam::LinearSolverEnum::direct) {
+        // A single factorization of the Jacobian serves both the forward and the adjoint solves.
+        if (jacobian_direct_solver && is_current_linearization(jacobian_direct_point)) {
+            ++n_cache_hits;
+        } else {
+            ++n_cache_misses;
+            jacobian_direct_solver.reset();
+            jacobian_direct_problem = std::make_unique<Epetra_LinearProblem>();
+            jacobian_direct_problem->SetOperator(const_cast<Epetra_CrsMatrix *>(&(dg->system_matrix.trilinos_matrix())));
+            Amesos amesos_factory;
+            jacobian_direct_solver.reset(amesos_factory.Create("Amesos_Klu", *jacobian_direct_problem));
+            AssertThrow(jacobian_direct_solver, dealii::ExcMessage("Amesos_Klu direct solver is not available."));
+            int ierr = jacobian_direct_solver->SymbolicFactorization();
+            AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+            ierr = jacobian_direct_solver->NumericFactorization();
+            AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+            store_current_linearization(jacobian_direct_point);
+        }
+        Epetra_Vector x(View, dg->system_matrix.trilinos_matrix().DomainMap(), solution.begin());
+        Epetra_Vector b(View, dg->system_matrix.trilinos_matrix().RangeMap(), right_hand_side.begin());
+        jacobian_direct_problem->SetLHS(&x);
+        jacobian_direct_problem->SetRHS(&b);
+        jacobian_direct_solver->SetUseTranspose(adjoint);
+        const int ierr = jacobian_direct_solver->Solve();
+        AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+        return;
+    }
 
+    if (adjoint) {
+        update_preconditioner(adjoint_jacobian_prec, adjoint_jacobian_prec_point, matrix);
+    } else {
+        update_preconditioner(jacobian_prec, jacobian_prec_point, matrix);
+    }
+    Ifpack_Preconditioner *preconditioner = adjoint ? adjoint_jacobian_prec : jacobian_prec;
+
+    // Same GMRES settings as solve_linear(), but with the cached preconditioner.
+    solution *= 0.0;
+    Epetra_Vector x(View, matrix.trilinos_matrix().DomainMap(), solution.begin());
+    Epetra_Vector b(View, matrix.trilinos_matrix().RangeMap(), right_hand_side.begin());
+    AztecOO solver;
+    solver.SetAztecOption(AZ_output, (linear_solver_param.linear_solver_output ? AZ_all : AZ_last));
+    solver.SetAztecOption(AZ_solver, AZ_gmres);
+    solver.SetAztecOption(AZ_kspace, linear_solver_param.restart_number);
+    solver.SetAztecOption(AZ_orthog, AZ_classic);
+    solver.SetAztecOption(AZ_conv, AZ_rhs);
+    solver.SetUserMatrix(const_cast<Epetra_CrsMatrix *>(&matrix.trilinos_matrix()));
+    solver.SetPrecOperator(preconditioner);
+    solver.SetRHS(&b);
+    solver.SetLHS(&x);
+
+    // If requested, a looser tolerance from the optimizer (inexact solves) takes precedence over the linear solver parameters.
+    const double tolerance = use_optimizer_linear_tolerance ? std::max(linear_solver_param.linear_residual, relative_tolerance)
+                                                            : linear_solver_param.linear_residual;
+    const double linear_residual = tolerance * right_hand_side.l2_norm();
+    const int n_solves = 2;
+    for (int i_solve = 0; i_solve < n_solves; ++i_solve) {
+        solver.Iterate(linear_solver_param.max_iterations, linear_residual);
+        n_vmult += 7*solver.NumIters();
+        dRdW_mult += 7*solver.NumIters();
+    }
+    if(i_print) std::cout << " Linear solver with cached preconditioner reached a linear residual of " << solver.ScaledResidual() << std::endl;
 }
 
 template<int dim>
 int FlowConstraints<dim>
-::construct_AdjointJacobianPreconditioner_1(
+::construct_JacobianPreconditioner_1(
     const ROL::Vector<double>& des_var_sim,
     const ROL::Vector<double>& des_var_ctl)
 {
     update_1(des_var_sim);
     update_2(des_var_ctl);
 
+    if (jacobian_prec && is_current_linearization(jacobian_prec_point)) {
+        ++n_cache_hits;
+        return 0;
+    }
+
     const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
     dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
 
-    Epetra_CrsMatrix * adjoint_jacobian = const_cast<Epetra_CrsMatrix *>(&(dg->system_matrix_transpose.trilinos_matrix()));
+    update_preconditioner(jacobian_prec, jacobian_prec_point, dg->system_matrix);
 
-    destroy_AdjointJacobianPreconditioner_1();
-    Ifpack Factory;
+    return 0;
 
-    Teuchos::ParameterList List;
+}
 
-    const std::string PrecType = "ILUT"; 
-    List.set("fact: ilut level-of-fill", 50.0);
-    List.set("fact: absolute threshold", 1e-3);
-    List.set("fact: relative threshold", 1.01);//1.0+1e-2);
-    List.set("fact: drop tolerance", 0.0);//1e-12);
+template<int dim>
+int FlowConstraints<dim>
+::construct_AdjointJacobianPreconditioner_1(
+    const ROL::Vector<double>& des_var_sim,
+    const ROL::Vector<double>& des_var_ctl)
+{
+    update_1(des_var_sim);
+    update_2(des_var_ctl);
 
-    //const std::string PrecType = "ILU"; 
-    //List.set("fact: level-of-fill", 0);
+    if (adjoint_jacobian_prec && is_current_linearization(adjoint_jacobian_prec_point)) {
+        ++n_cache_hits;
+        return 0;
+    }
 
-    List.set("schwarz: reordering type", "rcm");
-    const int OverlapLevel = 1; // one row of overlap among the processes
-    adjoint_jacobian_prec = Factory.Create(PrecType, adjoint_jacobian, OverlapLevel);
-    assert (adjoint_jacobian_prec != 0);
+    const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
+    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
 
-    IFPACK_CHK_ERR(adjoint_jacobian_prec->SetParameters(List));
-    IFPACK_CHK_ERR(adjoint_jacobian_prec->Initialize());
-    IFPACK_CHK_ERR(adjoint_jacobian_prec->Compute());
+    update_preconditioner(adjoint_jacobian_prec, adjoint_jacobian_prec_point, dg->system_matrix_transpose);
 
     return 0;
 
@@ -420,7 +544,7 @@ void FlowConstraints<dim>
 const ROL::Vector<double>& input_vector,
 const ROL::Vector<double>& des_var_sim,
 const ROL::Vector<double>& des_var_ctl,
-double& /*tol*/ )
+double& tol )
 {
 
     if(i_print) std::cout << __PRETTY_FUNCTION__ << std::endl;
@@ -434,7 +558,8 @@ double& /*tol*/ )
     auto input_vector_v = ROL_vector_to_dealii_vector_reference(input_vector);
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
-    solve_linear (dg->system_matrix_transpose, input_vector_v, output_vector_v, this->linear_solver_param);
+    const bool adjoint = true;
+    solve_linear_cached (adjoint, input_vector_v, output_vector_v, tol);
 
 }
 
@@ -474,7 +599,7 @@ double& /*tol*/ )
     //}
 
     auto dXvdXp_input = dg->high_order_grid->volume_nodes;
-    dXvdXp.vmult(dXvdXp_input, input_vector_v);
+    dXvdXp->apply_dXvdXp(input_vector_v, dXvdXp_input);
 
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
@@ -555,7 +680,7 @@ double& /*tol*/ )
     // }
 
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
-    dXvdXp.Tvmult(output_vector_v, input_dRdXv);
+    dXvdXp->apply_dXvdXp_transpose(input_dRdXv, output_vector_v);
 
     n_vmult += 7;
     dRdX_mult += 1;
@@ -580,9 +705,17 @@ void FlowConstraints<dim>
     update_1(des_var_sim);
     update_2(des_var_ctl);
 
-    const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
-    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-    dg->d2RdWdW.vmult(ROL_vector_to_dealii_vector_reference(output_vector), ROL_vector_to_dealii_vector_reference(input_vector));
+    if (dg->all_parameters->matrix_free_d2R) {
+        auto zero_direction_x = dg->high_order_grid->volume_nodes;
+        zero_direction_x *= 0.0;
+        auto d2R_x = zero_direction_x;
+        dg->apply_d2R(ROL_vector_to_dealii_vector_reference(input_vector), zero_direction_x,
+                      ROL_vector_to_dealii_vector_reference(output_vector), d2R_x);
+    } else {
+        const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
+        dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
+        dg->d2RdWdW.vmult(ROL_vector_to_dealii_vector_reference(output_vector), ROL_vector_to_dealii_vector_reference(input_vector));
+    }
 
     n_vmult += 6;
     d2R_mult += 1;
@@ -611,7 +744,12 @@ void FlowConstraints<dim>
     const auto &input_vector_v = ROL_vector_to_dealii_vector_reference(input_vector);
 
     auto input_d2RdWdX = dg->high_order_grid->volume_nodes;
-    {
+    if (dg->all_parameters->matrix_free_d2R) {
+        auto zero_direction_x = dg->high_order_grid->volume_nodes;
+        zero_direction_x *= 0.0;
+        auto d2R_w = dg->solution;
+        dg->apply_d2R(input_vector_v, zero_direction_x, d2R_w, input_d2RdWdX);
+    } else {
         const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
         dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
         dg->d2RdWdX.Tvmult(input_d2RdWdX, input_vector_v);
@@ -637,7 +775,7 @@ void FlowConstraints<dim>
     // }
 
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
-    dXvdXp.Tvmult(output_vector_v, input_d2RdWdX);
+    dXvdXp->apply_dXvdXp_transpose(input_d2RdWdX, output_vector_v);
 
     n_vmult += 7;
     d2R_mult += 1;
@@ -688,10 +826,15 @@ void FlowConstraints<dim>
     // }
 
     auto dXvdXp_input = dg->high_order_grid->volume_nodes;
-    dXvdXp.vmult(dXvdXp_input, input_vector_v);
+    dXvdXp->apply_dXvdXp(input_vector_v, dXvdXp_input);
 
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
-    {
+    if (dg->all_parameters->matrix_free_d2R) {
+        auto zero_direction_w = dg->solution;
+        zero_direction_w *= 0.0;
+        auto d2R_x = dg->high_order_grid->volume_nodes;
+        dg->apply_d2R(zero_direction_w, dXvdXp_input, output_vector_v, d2R_x);
+    } else {
         const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
         dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
         dg->d2RdWdX.vmult(output_vector_v, dXvdXp_input);
@@ -748,10 +891,15 @@ void FlowConstraints<dim>
     // }
 
     auto dXvdXp_input = dg->high_order_grid->volume_nodes;
-    dXvdXp.vmult(dXvdXp_input, input_vector_v);
+    dXvdXp->apply_dXvdXp(input_vector_v, dXvdXp_input);
 
     auto d2RdXdX_dXvdXp_input = dg->high_order_grid->volume_nodes;
-    {
+    if (dg->all_parameters->matrix_free_d2R) {
+        auto zero_direction_w = dg->solution;
+        zero_direction_w *= 0.0;
+        auto d2R_w = dg->solution;
+        dg->apply_d2R(zero_direction_w, dXvdXp_input, d2R_w, d2RdXdX_dXvdXp_input);
+    } else {
         const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
         dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
         dg->d2RdXdX.vmult(d2RdXdX_dXvdXp_input, dXvdXp_input);
@@ -777,7 +925,7 @@ void FlowConstraints<dim>
     //}
 
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
-    dXvdXp.Tvmult(output_vector_v, d2RdXdX_dXvdXp_input);
+    dXvdXp->apply_dXvdXp_transpose(d2RdXdX_dXvdXp_input, output_vector_v);
 
     n_vmult += 8;
     d2R_mult += 1;
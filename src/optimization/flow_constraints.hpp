@@ -10,11 +10,14 @@
 #include "parameters/all_parameters.h"
 
 #include "mesh/free_form_deformation.h"
-#include "mesh/meshmover_linear_elasticity.hpp"
+
+#include "optimization/mesh_sensitivity_operator.hpp"
 
 #include "dg/dg.h"
 
 #include "Ifpack.h"
+#include <Amesos_BaseSolver.h>
+#include <Epetra_LinearProblem.h>
 
 namespace PHiLiP {
 
@@ -61,6 +64,66 @@ private:
     /** Currently uses ILUT */
     Ifpack_Preconditioner *adjoint_jacobian_prec;
 
+    /// State at which a Jacobian preconditioner or factorization was built.
+    /** The DG object is shared with other ROL objects (e.g. ROLObjectiveSimOpt) and with the ODE solver,
+     *  which may change the solution or the grid without going through FlowConstraints.
+     *  The cached preconditioners are therefore keyed on a copy of the state they were built from.
+     */
+    struct LinearizationPoint {
+        /// Whether a preconditioner or factorization was built at this point.
+        bool valid = false;
+        /// Flow solution.
+        dealii::LinearAlgebra::distributed::Vector<double> solution;
+        /// High-order grid volume nodes.
+        dealii::LinearAlgebra::distributed::Vector<double> volume_nodes;
+        /// Regularization flow_CFL_ of the Jacobian.
+        double flow_CFL = 0.0;
+    };
+    /// Linearization point for which jacobian_prec was computed.
+    LinearizationPoint jacobian_prec_point;
+    /// Linearization point for which adjoint_jacobian_prec was computed.
+    LinearizationPoint adjoint_jacobian_prec_point;
+    /// Linearization point for which jacobian_direct_solver was factorized.
+    LinearizationPoint jacobian_direct_point;
+
+    /// Linear problem holding the Jacobian factorized by jacobian_direct_solver.
+    std::unique_ptr<Epetra_LinearProblem> jacobian_direct_problem;
+    /// Sparse direct factorization of the Jacobian.
+    /** Only used when linear_solver_param requests a direct solver.
+     *  Adjoint solves use the same factors through a transposed solve.
+     */
+    std::unique_ptr<Amesos_BaseSolver> jacobian_direct_solver;
+
+    int n_cache_hits; ///< Number of reused preconditioners or factorizations during the current optimization iteration.
+    int n_cache_misses; ///< Number of built preconditioners or factorizations during the current optimization iteration.
+    int current_optimization_iteration; ///< Optimization iteration given to update_2().
+
+    /// Whether the current solution, volume nodes and flow_CFL_ are the ones stored in @p point.
+    bool is_current_linearization(const LinearizationPoint &point) const;
+    /// Stores the current solution, volume nodes and flow_CFL_ into @p point.
+    void store_current_linearization(LinearizationPoint &point) const;
+
+    /// Prints and resets the cache hits and misses.
+    void report_cache_statistics();
+
+    /// Builds the ILUT preconditioner of @p matrix, if the cached one does not correspond to the current linearization.
+    /** The matrix must have been assembled at the current linearization point. */
+    void update_preconditioner(
+        Ifpack_Preconditioner *&preconditioner,
+        LinearizationPoint &preconditioner_point,
+        const dealii::TrilinosWrappers::SparseMatrix &matrix);
+
+    /// Solves the (adjoint) Jacobian system reusing the cached preconditioner or factorization.
+    /** The Jacobian must have been assembled at the current linearization point.
+     *  If use_optimizer_linear_tolerance, the iterative solve stops at the looser of relative_tolerance
+     *  and the linear solver's residual.
+     */
+    void solve_linear_cached(
+        const bool adjoint,
+        dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+        dealii::LinearAlgebra::distributed::Vector<double> &solution,
+        const double relative_tolerance);
+
 protected:
     /// ID used when outputting the flow solution.
     int i_out = 1000;
@@ -68,14 +131,24 @@ protected:
     int iupdate = 9000;
 
 public:
-    /// Stores the mesh sensitivities.
-    dealii::TrilinosWrappers::SparseMatrix dXvdXp;
+    /// Mesh sensitivities with respect to the design variables.
+    /** Shared with the ROLObjectiveSimOpt of the same problem.
+     */
+    std::shared_ptr<MeshSensitivityOperator<dim>> dXvdXp;
 
     /// Avoid -Werror=overloaded-virtual.
     using ROL::Constraint_SimOpt<double>::value;
 
     /// Regularization of the constraint by adding flow_CFL_ times the mass matrix.
     double flow_CFL_;
+
+    /// Whether the (adjoint) Jacobian solves stop at the tolerance passed by the optimizer.
+    /** When true, applyInverseJacobian_1() and applyInverseAdjointJacobian_1() use the looser of the
+     *  tolerance given by ROL and linear_solver_param.linear_residual, e.g. for the inexact
+     *  Eisenstat-Walker full-space solves. Otherwise, the systems are solved to linear_residual.
+     *  FullSpace_BirosGhattas sets it during the KKT solve when "Use Eisenstat-Walker" is enabled.
+     */
+    bool use_optimizer_linear_tolerance;
     /// Avoid -Werror=overloaded-virtual.
     using ROL::Constraint_SimOpt<double>::applyAdjointJacobian_1;
         //(
@@ -32,6 +32,17 @@ FullSpace_BirosGhattas(
     preconditioner_name_ = parlist.sublist("Full Space").get("Preconditioner","P4");
     use_approximate_full_space_preconditioner_ = (preconditioner_name_ == "P2A" || preconditioner_name_ == "P4A");
 
+    ROL::ParameterList& Ilist = parlist.sublist("Full Space").sublist("Inexact Solves");
+    use_eisenstat_walker_    = Ilist.get("Use Eisenstat-Walker", false);
+    initial_forcing_term_    = Ilist.get("Initial Forcing Term", 1e-1);
+    minimum_forcing_term_    = Ilist.get("Minimum Forcing Term", 1e-6);
+    maximum_forcing_term_    = Ilist.get("Maximum Forcing Term", 1e-1);
+    forcing_term_gamma_      = Ilist.get("Forcing Term Gamma", 0.9);
+    forcing_term_alpha_      = Ilist.get("Forcing Term Alpha", 2.0);
+    inner_tolerance_factor_  = Ilist.get("Inner Tolerance Factor", 1e-1);
+    forcing_term_            = initial_forcing_term_;
+    previous_kkt_rhs_norm_   = -1.0;
+
     // Initialize Line Search
     if (lineSearch_ == ROL::nullPtr) {
         lineSearchName_ = Llist.sublist("Line-Search Method").get("Type","Backtracking");
@@ -291,7 +302,8 @@ std::vector<double> FullSpace_BirosGhattas<Real>::solve_linear (
     MatrixType &matrix_A,
     VectorType &right_hand_side,
     VectorType &solution,
-    PreconditionerType &preconditioner)
+    PreconditionerType &preconditioner,
+    const double forcing_term)
     //const PHiLiP::Parameters::LinearSolverParam & param = )
 {
     const bool print_kkt_operator = false;
@@ -337,7 +349,6 @@ std::vector<double> FullSpace_BirosGhattas<Real>::solve_linear (
 
 
     const double rhs_norm = right_hand_side.l2_norm();
-    (void) rhs_norm;
     // const double tolerance = rhs_norm*rhs_norm;
     //const double tolerance = std::max(1e-8 * rhs_norm, 1e-14);
 
@@ -345,7 +356,8 @@ std::vector<double> FullSpace_BirosGhattas<Real>::solve_linear (
     //const double tolerance = 1e-11;
     //const double tolerance = std::max(1e-3 * rhs_norm, 1e-11);
     // Used for almost all the results:
-    const double tolerance = std::min(1e-4, std::max(1e-6 * rhs_norm, 1e-11));
+    //const double tolerance = std::min(1e-4, std::max(1e-6 * rhs_norm, 1e-11));
+    const double tolerance = std::max(forcing_term * rhs_norm, 1e-11);
 
     dealii::SolverControl solver_control(2000, tolerance, true, true);
     solver_control.enable_history_data();
@@ -392,6 +404,32 @@ std::vector<double> FullSpace_BirosGhattas<Real>::solve_linear (
 
 }
 
+template <class Real>
+Real FullSpace_BirosGhattas<Real>::compute_forcing_term(const Real kkt_rhs_norm)
+{
+    if (!use_eisenstat_walker_) {
+        // Fixed relative tolerance, capped to an absolute tolerance of 1e-4.
+        forcing_term_ = std::min(1e-6, 1e-4 / std::max(kkt_rhs_norm, 1e-300));
+        return forcing_term_;
+    }
+
+    Real forcing_term = initial_forcing_term_;
+    if (previous_kkt_rhs_norm_ > 0.0) {
+        const Real ratio = kkt_rhs_norm / previous_kkt_rhs_norm_;
+        forcing_term = forcing_term_gamma_ * std::pow(ratio, forcing_term_alpha_);
+
+        // Safeguard against the forcing term decreasing too quickly.
+        const Real safeguard = forcing_term_gamma_ * std::pow(forcing_term_, forcing_term_alpha_);
+        if (safeguard > 0.1) forcing_term = std::max(forcing_term, safeguard);
+    }
+    forcing_term = std::min(forcing_term, maximum_forcing_term_);
+    forcing_term = std::max(forcing_term, minimum_forcing_term_);
+
+    previous_kkt_rhs_norm_ = kkt_rhs_norm;
+    forcing_term_ = forcing_term;
+    return forcing_term_;
+}
+
 template <class Real>
 std::vector<Real> FullSpace_BirosGhattas<Real>::solve_KKT_system(
     Vector<Real> &search_direction,
@@ -438,20 +476,31 @@ std::vector<Real> FullSpace_BirosGhattas<Real>::solve_KKT_system(
         makePtrFromRef<const Vector<Real>>(lagrange_mult));
 
 
+    const Real forcing_term = compute_forcing_term(rhs_rol.norm());
+    // The Jacobian solves within the preconditioner only need to be as accurate as the KKT solve.
+    const Real inner_tolerance = use_eisenstat_walker_ ? inner_tolerance_factor_ * forcing_term : 1e-15;
+
     std::shared_ptr<BirosGhattasPreconditioner<Real>> kkt_precond =
         BirosGhattasPreconditionerFactory<Real>::create_KKT_preconditioner( parlist_,
                                    objective,
                                    equal_constraints,
                                    design_variables,
                                    lagrange_mult,
-                                   secant_);
+                                   secant_,
+                                   inner_tolerance);
 
     dealiiSolverVectorWrappingROL<double> lhs(makePtrFromRef(lhs_rol));
     dealiiSolverVectorWrappingROL<double> rhs(makePtrFromRef(rhs_rol));
 
-    std::vector<double> linear_residuals = solve_linear (kkt_operator, rhs, lhs, *kkt_precond);
-    pcout << "Solving the KKT system took "
-        << linear_residuals.size() << " iterations "
+    // The flow and adjoint solves of the preconditioner only stop at inner_tolerance if FlowConstraints is told to use it.
+    // The exact solves elsewhere, e.g. for the initial Lagrange multiplier, keep the linear solver's tolerance.
+    auto &flow_constraint = (dynamic_cast<PHiLiP::FlowConstraints<PHILIP_DIM>&>(equal_constraints));
+    const bool old_use_optimizer_linear_tolerance = flow_constraint.use_optimizer_linear_tolerance;
+    flow_constraint.use_optimizer_linear_tolerance = use_eisenstat_walker_;
+    std::vector<double> linear_residuals = solve_linear (kkt_operator, rhs, lhs, *kkt_precond, forcing_term);
+    flow_constraint.use_optimizer_linear_tolerance = old_use_optimizer_linear_tolerance;
+    pcout << "Solving the KKT system with a forcing term of " << forcing_term
+        << " took " << linear_residuals.size() << " iterations "
         << " to achieve a residual of " << linear_residuals.back() << std::endl;
 
     search_direction.set(*(lhs_rol.get_1()));
@@ -97,6 +97,33 @@ private:
 
     /// Number of line searches used in the last design cycle.
     int n_linesearches;
+
+    /// Use Eisenstat-Walker forcing terms for the inexact KKT solves.
+    /** Otherwise, a fixed relative tolerance is used. */
+    bool use_eisenstat_walker_;
+    /// Forcing term used on the first KKT solve.
+    Real initial_forcing_term_;
+    /// Lower bound on the forcing term.
+    Real minimum_forcing_term_;
+    /// Upper bound on the forcing term.
+    Real maximum_forcing_term_;
+    /// Eisenstat-Walker (choice 2) scaling factor.
+    Real forcing_term_gamma_;
+    /// Eisenstat-Walker (choice 2) exponent.
+    Real forcing_term_alpha_;
+    /// Ratio between the tolerance of the Jacobian solves within the preconditioner and the forcing term.
+    Real inner_tolerance_factor_;
+    /// Forcing term used in the last KKT solve.
+    Real forcing_term_;
+    /// Norm of the KKT right-hand side at the last KKT solve.
+    /** Negative before the first KKT solve. */
+    Real previous_kkt_rhs_norm_;
+
+    /// Computes the relative tolerance of the KKT solve given the norm of its right-hand side.
+    /** Eisenstat and Walker's choice 2 with safeguards, see "Choosing the forcing terms
+     *  in an inexact Newton method", 1996.
+     */
+    Real compute_forcing_term(const Real kkt_rhs_norm);
 public:
   
     using Step<Real>::initialize; ///< See base class.
@@ -176,13 +203,15 @@ public:
         const Real offset);
 
     /// Solve a linear system using deal.II's F/GMRES solver.
+    /** The solve stops once the residual is reduced below forcing_term * ||rhs||. */
     template<typename MatrixType, typename VectorType, typename PreconditionerType>
     std::vector<double>
     solve_linear (
         MatrixType &matrix_A,
         VectorType &right_hand_side,
         VectorType &solution,
-        PreconditionerType &preconditioner);
+        PreconditionerType &preconditioner,
+        const double forcing_term);
         //const PHiLiP::Parameters::LinearSolverParam & param = );
 
     /// Setup and solve the large KKT system.
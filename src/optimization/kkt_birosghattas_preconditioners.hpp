@@ -39,6 +39,10 @@ protected:
     /// the preconditioner to obtain the "tilde" operator version of Biros and Ghattas.
     const bool use_approximate_preconditioner_;
 
+    /// Tolerance passed to the Jacobian (transpose) inverses.
+    /** Loosened by the full-space step when using inexact KKT solves. */
+    const Real inner_tolerance_;
+
 protected:
     const unsigned int mpi_rank; ///< MPI rank used to reset the deallog depth
     dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
@@ -52,7 +56,8 @@ public:
         const ROL::Ptr<const ROL::Vector<Real>> design_variables,
         const ROL::Ptr<const ROL::Vector<Real>> lagrange_mult,
         const ROL::Ptr<ROL::Secant<Real> > secant,
-        const bool use_approximate_preconditioner = false)
+        const bool use_approximate_preconditioner = false,
+        const Real inner_tolerance = 1e-15)
         : objective_
             (ROL::makePtrFromRef<ROL::Objective_SimOpt<Real>>(dynamic_cast<ROL::Objective_SimOpt<Real>&>(*objective)))
         , equal_constraints_
@@ -64,6 +69,7 @@ public:
         , control_variables_(design_variables_->get_2())
         , secant_(secant)
         , use_approximate_preconditioner_(use_approximate_preconditioner)
+        , inner_tolerance_(inner_tolerance)
         , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
         , pcout(std::cout, mpi_rank==0)
     {
@@ -133,6 +139,9 @@ protected:
     /// the preconditioner to obtain the "tilde" operator version of Biros and Ghattas.
     using BirosGhattasPreconditioner<Real>::use_approximate_preconditioner_;
 
+    /// Tolerance passed to the Jacobian (transpose) inverses.
+    using BirosGhattasPreconditioner<Real>::inner_tolerance_;
+
 protected:
     using BirosGhattasPreconditioner<Real>::mpi_rank; ///< MPI rank used to reset the deallog depth
     using BirosGhattasPreconditioner<Real>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
@@ -145,8 +154,9 @@ public:
         const ROL::Ptr<const ROL::Vector<Real>> design_variables,
         const ROL::Ptr<const ROL::Vector<Real>> lagrange_mult,
         const ROL::Ptr<ROL::Secant<Real> > secant,
-        const bool use_approximate_preconditioner = false)
-        : BirosGhattasPreconditioner<Real>(objective, equal_constraints, design_variables, lagrange_mult, secant, use_approximate_preconditioner)
+        const bool use_approximate_preconditioner = false,
+        const Real inner_tolerance = 1e-15)
+        : BirosGhattasPreconditioner<Real>(objective, equal_constraints, design_variables, lagrange_mult, secant, use_approximate_preconditioner, inner_tolerance)
     { }
 
     /// Application of KKT preconditionner on vector src outputted into dst.
@@ -156,7 +166,7 @@ public:
         static int number_of_times = 0;
         number_of_times++;
         pcout << "Number of P2_KKT vmult = " << number_of_times << std::endl;
-        Real tol = 1e-15;
+        Real tol = inner_tolerance_;
         //const Real one = 1.0;
 
         ROL::Ptr<ROL::Vector<Real>> dst_rol = dst.getVector();
@@ -244,6 +254,9 @@ protected:
     /// the preconditioner to obtain the "tilde" operator version of Biros and Ghattas.
     using BirosGhattasPreconditioner<Real>::use_approximate_preconditioner_;
 
+    /// Tolerance passed to the Jacobian (transpose) inverses.
+    using BirosGhattasPreconditioner<Real>::inner_tolerance_;
+
 protected:
     using BirosGhattasPreconditioner<Real>::mpi_rank; ///< MPI rank used to reset the deallog depth
     using BirosGhattasPreconditioner<Real>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
@@ -256,8 +269,9 @@ public:
         const ROL::Ptr<const ROL::Vector<Real>> design_variables,
         const ROL::Ptr<const ROL::Vector<Real>> lagrange_mult,
         const ROL::Ptr<ROL::Secant<Real> > secant,
-        const bool use_approximate_preconditioner = false)
-        : BirosGhattasPreconditioner<Real>(objective, equal_constraints, design_variables, lagrange_mult, secant, use_approximate_preconditioner)
+        const bool use_approximate_preconditioner = false,
+        const Real inner_tolerance = 1e-15)
+        : BirosGhattasPreconditioner<Real>(objective, equal_constraints, design_variables, lagrange_mult, secant, use_approximate_preconditioner, inner_tolerance)
     { };
 
     /// Application of KKT preconditionner on vector src outputted into dst.
@@ -267,7 +281,7 @@ public:
         static int number_of_times = 0;
         number_of_times++;
         pcout << "Number of P4_KKT vmult = " << number_of_times << std::endl;
-        Real tol = 1e-15;
+        Real tol = inner_tolerance_;
         //const Real one = 1.0;
 
         ROL::Ptr<ROL::Vector<Real>> dst_rol = dst.getVector();
@@ -381,8 +395,9 @@ public:
         const ROL::Ptr<const ROL::Vector<Real>> design_variables,
         const ROL::Ptr<const ROL::Vector<Real>> lagrange_mult,
         const ROL::Ptr<ROL::Secant<Real> > secant,
-        const bool use_approximate_preconditioner = false)
-        : BirosGhattasPreconditioner<Real>(objective, equal_constraints, design_variables, lagrange_mult, secant, use_approximate_preconditioner)
+        const bool use_approximate_preconditioner = false,
+        const Real inner_tolerance = 1e-15)
+        : BirosGhattasPreconditioner<Real>(objective, equal_constraints, design_variables, lagrange_mult, secant, use_approximate_preconditioner, inner_tolerance)
     { }
 
     /// Application of KKT preconditionner on vector src outputted into dst.
@@ -406,7 +421,8 @@ public:
                                    ROL::Constraint<Real> &equal_constraints,
                                    const ROL::Vector<Real> &design_variables,
                                    const ROL::Vector<Real> &lagrange_mult,
-                                   const ROL::Ptr< ROL::Secant<Real> > secant_)
+                                   const ROL::Ptr< ROL::Secant<Real> > secant_,
+                                   const Real inner_tolerance = 1e-15)
     {
         const std::string preconditioner_name_ = parlist.sublist("Full Space").get("Preconditioner","Identity"); 
         const bool use_approximate_full_space_preconditioner_ = (preconditioner_name_ == "P2A" || preconditioner_name_ == "P4A");
@@ -418,7 +434,8 @@ public:
                 ROL::makePtrFromRef<const ROL::Vector<Real>>(design_variables),
                 ROL::makePtrFromRef<const ROL::Vector<Real>>(lagrange_mult),
                 secant_,
-                use_approximate_full_space_preconditioner_);
+                use_approximate_full_space_preconditioner_,
+                inner_tolerance);
         } else if (preconditioner_name_ == "P4" || preconditioner_name_ == "P4A") {
             return std::make_shared<KKT_P4_Preconditioner<Real>> (
                 ROL::makePtrFromRef<ROL::Objective<Real>>(objective),
@@ -426,7 +443,8 @@ public:
                 ROL::makePtrFromRef<const ROL::Vector<Real>>(design_variables),
                 ROL::makePtrFromRef<const ROL::Vector<Real>>(lagrange_mult),
                 secant_,
-                use_approximate_full_space_preconditioner_);
+                use_approximate_full_space_preconditioner_,
+                inner_tolerance);
         } else {
             return std::make_shared<KKT_Identity_Preconditioner<Real>> (
                 ROL::makePtrFromRef<ROL::Objective<Real>>(objective),
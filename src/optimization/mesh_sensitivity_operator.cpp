@@ -0,0 +1,58 @@
+#include "optimization/mesh_sensitivity_operator.hpp"
+
+namespace PHiLiP {
+
+template<int dim>
+MeshSensitivityOperator<dim>::MeshSensitivityOperator(
+    const FreeFormDeformation<dim> &ffd,
+    std::shared_ptr<HighOrderGrid<dim,double>> _high_order_grid,
+    const std::vector< std::pair< unsigned int, unsigned int > > &ffd_design_variables_indices_dim,
+    const dealii::TrilinosWrappers::SparseMatrix *precomputed_dXvdXp)
+    : high_order_grid(_high_order_grid)
+{
+    const unsigned int n_design_variables = ffd_design_variables_indices_dim.size();
+    if (precomputed_dXvdXp && precomputed_dXvdXp->m() == high_order_grid->volume_nodes.size() && precomputed_dXvdXp->n() == n_design_variables) {
+        dXvdXp.copy_from(*precomputed_dXvdXp);
+        return;
+    }
+    // Matrix-free dXvdXp = dXvdXvs * dXvsdXp, where dXvdXvs is applied by the mesh mover,
+    // e.g. through a factorized elasticity system or the RBF interpolant.
+    ffd.get_dXvsdXp (*high_order_grid, ffd_design_variables_indices_dim, dXvsdXp);
+    meshmover = ffd.get_meshmover(*high_order_grid);
+    meshmover->prepare_dXvdXvs(ffd.get_dXvsdXp(*high_order_grid, ffd_design_variables_indices_dim));
+}
+
+template<int dim>
+bool MeshSensitivityOperator<dim>::is_matrix_free() const
+{
+    return (meshmover != nullptr);
+}
+
+template<int dim>
+void MeshSensitivityOperator<dim>::apply_dXvdXp(const VectorType &input_vector, VectorType &output_vector)
+{
+    if (!is_matrix_free()) {
+        dXvdXp.vmult(output_vector, input_vector);
+        return;
+    }
+    VectorType dXvsdXp_input;
+    dXvsdXp_input.reinit(high_order_grid->volume_nodes);
+    dXvsdXp.vmult(dXvsdXp_input, input_vector);
+    meshmover->apply_dXvdXvs(dXvsdXp_input, output_vector);
+}
+
+template<int dim>
+void MeshSensitivityOperator<dim>::apply_dXvdXp_transpose(const VectorType &input_vector, VectorType &output_vector)
+{
+    if (!is_matrix_free()) {
+        dXvdXp.Tvmult(output_vector, input_vector);
+        return;
+    }
+    VectorType dXvdXvsT_input;
+    meshmover->apply_dXvdXvs_transpose(input_vector, dXvdXvsT_input);
+    dXvsdXp.Tvmult(output_vector, dXvdXvsT_input);
+}
+
+template class MeshSensitivityOperator<PHILIP_DIM>;
+
+} // PHiLiP namespace
@@ -0,0 +1,61 @@
+#ifndef __MESHSENSITIVITYOPERATOR_H__
+#define __MESHSENSITIVITYOPERATOR_H__
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+#include "mesh/high_order_grid.h"
+#include "mesh/free_form_deformation.h"
+#include "mesh/meshmover_base.hpp"
+
+namespace PHiLiP {
+
+/// Volume nodes sensitivities with respect to the FFD design variables, dXvdXp.
+/** Either stores a precomputed dXvdXp, or applies dXvdXp = dXvdXvs * dXvsdXp matrix-free,
+ *  where dXvsdXp is the analytical FFD surface Jacobian and dXvdXvs is applied by the mesh mover,
+ *  such that the memory does not scale with the number of volume nodes times the number of design variables.
+ *
+ *  A single instance is shared by FlowConstraints and the ROLObjectiveSimOpt of the same problem.
+ */
+template<int dim>
+class MeshSensitivityOperator
+{
+    /// Distributed vector of double.
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+public:
+    /// Constructor.
+    /** The mesh mover of type FreeFormDeformation::mesh_mover_type is obtained from the @p ffd cache.
+     *  A @p precomputed_dXvdXp of the right size is copied and used instead of the matrix-free products.
+     */
+    MeshSensitivityOperator(
+        const FreeFormDeformation<dim> &ffd,
+        std::shared_ptr<HighOrderGrid<dim,double>> high_order_grid,
+        const std::vector< std::pair< unsigned int, unsigned int > > &ffd_design_variables_indices_dim,
+        const dealii::TrilinosWrappers::SparseMatrix *precomputed_dXvdXp = nullptr);
+
+    /// Applies the volume nodes sensitivities with respect to the design variables onto a vector.
+    void apply_dXvdXp(const VectorType &input_vector, VectorType &output_vector);
+    /// Applies the transposed volume nodes sensitivities with respect to the design variables onto a vector.
+    void apply_dXvdXp_transpose(const VectorType &input_vector, VectorType &output_vector);
+
+    /// Whether the products are evaluated matrix-free.
+    bool is_matrix_free() const;
+
+private:
+    /// Grid whose volume nodes are differentiated.
+    std::shared_ptr<HighOrderGrid<dim,double>> high_order_grid;
+
+    /// Precomputed mesh sensitivities. Empty if the products are evaluated matrix-free.
+    dealii::TrilinosWrappers::SparseMatrix dXvdXp;
+
+    /// Derivatives of the surface volume nodes with respect to the design variables.
+    /** Only the surface rows are non-zero. */
+    dealii::TrilinosWrappers::SparseMatrix dXvsdXp;
+    /// Mesh mover applying the surface to volume derivatives.
+    /** Obtained from FreeFormDeformation::get_meshmover() such that a single mover is built per reference mesh. */
+    std::shared_ptr<MeshMover::MeshMoverBase<dim,double>> meshmover;
+};
+
+} // PHiLiP namespace
+
+#endif
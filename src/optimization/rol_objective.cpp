@@ -3,8 +3,6 @@
 
 #include <deal.II/optimization/rol/vector_adaptor.h>
 
-#include "mesh/meshmover_linear_elasticity.hpp"
-
 #include "global_counter.hpp"
 
 namespace PHiLiP {
@@ -14,7 +12,7 @@ ROLObjectiveSimOpt<dim,nstate>::ROLObjectiveSimOpt(
     Functional<dim,nstate,double> &_functional, 
     const FreeFormDeformation<dim> &_ffd,
     std::vector< std::pair< unsigned int, unsigned int > > &_ffd_design_variables_indices_dim,
-    dealii::TrilinosWrappers::SparseMatrix *precomputed_dXvdXp)
+    std::shared_ptr<MeshSensitivityOperator<dim>> shared_dXvdXp)
     : functional(_functional)
     , ffd(_ffd)
     , ffd_design_variables_indices_dim(_ffd_design_variables_indices_dim)
@@ -30,16 +28,11 @@ ROLObjectiveSimOpt<dim,nstate>::ROLObjectiveSimOpt(
     initial_ffd_des_var = ffd_des_var;
     initial_ffd_des_var.update_ghost_values();
 
-    if (precomputed_dXvdXp) {
-        if (precomputed_dXvdXp->m() == functional.dg->high_order_grid->volume_nodes.size() && precomputed_dXvdXp->n() == n_design_variables) {
-            dXvdXp.copy_from(*precomputed_dXvdXp);
-        }
-    } else {
-        ffd.get_dXvdXp ( *(functional.dg->high_order_grid), ffd_design_variables_indices_dim, dXvdXp);
-    }
+    ffd.mesh_mover_type = functional.dg->all_parameters->mesh_mover_type;
+    dXvdXp = shared_dXvdXp;
+    if (!dXvdXp) dXvdXp = std::make_shared<MeshSensitivityOperator<dim>>(ffd, functional.dg->high_order_grid, ffd_design_variables_indices_dim);
 }
 
-
 template <int dim, int nstate>
 void ROLObjectiveSimOpt<dim,nstate>::update(
     const ROL::Vector<double> &des_var_sim,
@@ -63,7 +56,7 @@ void ROLObjectiveSimOpt<dim,nstate>::update(
         dXp -= initial_ffd_des_var;
         dXp.update_ghost_values();
         auto dXv = functional.dg->high_order_grid->volume_nodes;
-        dXvdXp.vmult(dXv, dXp);
+        dXvdXp->apply_dXvdXp(dXp, dXv);
         dXv.update_ghost_values();
         functional.dg->high_order_grid->volume_nodes = functional.dg->high_order_grid->initial_volume_nodes;
         functional.dg->high_order_grid->volume_nodes += dXv;
@@ -123,7 +116,7 @@ void ROLObjectiveSimOpt<dim,nstate>::gradient_2(
     const auto &dIdXv = functional.dIdX;
 
     auto &dealii_output = ROL_vector_to_dealii_vector_reference(gradient_ctl);
-    dXvdXp.Tvmult(dealii_output, dIdXv);
+    dXvdXp->apply_dXvdXp_transpose(dIdXv, dealii_output);
 
     //n_vmult += 1;
 
@@ -210,7 +203,7 @@ void ROLObjectiveSimOpt<dim,nstate>::hessVec_12(
     // }
 
     auto dXvdXp_input = functional.dg->high_order_grid->volume_nodes;
-    dXvdXp.vmult(dXvdXp_input, dealii_input);
+    dXvdXp->apply_dXvdXp(dealii_input, dXvdXp_input);
 
     auto &dealii_output = ROL_vector_to_dealii_vector_reference(output_vector);
     {
@@ -263,7 +256,7 @@ void ROLObjectiveSimOpt<dim,nstate>::hessVec_21(
     // }
 
     auto &dealii_output = ROL_vector_to_dealii_vector_reference(output_vector);
-    dXvdXp.Tvmult(dealii_output, d2IdXdW_input);
+    dXvdXp->apply_dXvdXp_transpose(d2IdXdW_input, dealii_output);
 
     //n_vmult += 2;
 }
@@ -302,7 +295,7 @@ void ROLObjectiveSimOpt<dim,nstate>::hessVec_22(
     // }
 
     auto dXvdXp_input = functional.dg->high_order_grid->volume_nodes;
-    dXvdXp.vmult(dXvdXp_input, dealii_input);
+    dXvdXp->apply_dXvdXp(dealii_input, dXvdXp_input);
 
     auto d2IdXdXp_input = functional.dg->high_order_grid->volume_nodes;
     {
@@ -329,7 +322,7 @@ void ROLObjectiveSimOpt<dim,nstate>::hessVec_22(
     //}
 
     auto &dealii_output = ROL_vector_to_dealii_vector_reference(output_vector);
-    dXvdXp.Tvmult(dealii_output, d2IdXdXp_input);
+    dXvdXp->apply_dXvdXp_transpose(d2IdXdXp_input, dealii_output);
 
     //n_vmult += 3;
 }
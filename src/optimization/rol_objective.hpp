@@ -4,6 +4,7 @@
 #include "ROL_Objective_SimOpt.hpp"
 
 #include "mesh/free_form_deformation.h"
+#include "optimization/mesh_sensitivity_operator.hpp"
 
 #include "functional/functional.h"
 
@@ -35,17 +36,21 @@ private:
     /// Design variables.
     dealii::LinearAlgebra::distributed::Vector<double> initial_ffd_des_var;
 
-public:
+    /// Mesh sensitivities with respect to the design variables.
+    /** Usually shared with the FlowConstraints of the same problem.
+     */
+    std::shared_ptr<MeshSensitivityOperator<dim>> dXvdXp;
 
-    /// Stored mesh sensitivity evaluated at initialization.
-    dealii::TrilinosWrappers::SparseMatrix dXvdXp;
+public:
 
     /// Constructor.
+    /** Uses the @p shared_dXvdXp of the FlowConstraints if given. Otherwise, builds its own mesh sensitivities.
+     */
     ROLObjectiveSimOpt(
         Functional<dim,nstate,double> &_functional, 
         const FreeFormDeformation<dim> &_ffd,
         std::vector< std::pair< unsigned int, unsigned int > > &_ffd_design_variables_indices_dim,
-        dealii::TrilinosWrappers::SparseMatrix *precomputed_dXvdXp = nullptr);
+        std::shared_ptr<MeshSensitivityOperator<dim>> shared_dXvdXp = nullptr);
   
     using ROL::Objective_SimOpt<double>::value;
     using ROL::Objective_SimOpt<double>::update;
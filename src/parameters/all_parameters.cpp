@@ -87,6 +87,41 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       dealii::Patterns::Double(1.0,1e200),
                       "Scaling of Symmetric Interior Penalty term to ensure coercivity.");
 
+    prm.declare_entry("reuse_volume_hessian_tapes", "false",
+                      dealii::Patterns::Bool(),
+                      "Record the volume residual tape once per element type and re-evaluate it for every cell "
+                      "when assembling d2RdWdW, d2RdWdX, and d2RdXdX. Otherwise, re-record the tape for every cell.");
+
+    prm.declare_entry("use_analytic_flux_jacobians", "false",
+                      dealii::Patterns::Bool(),
+                      "Assemble the volume and interior face contributions to dRdW from analytic flux Jacobians. "
+                      "Only used with lax_friedrichs and the euler, advection, or advection_vector PDEs without artificial dissipation. "
+                      "Otherwise, e.g. with roe, l2roe, or viscous physics, and on the boundary faces, automatic differentiation is used.");
+
+    prm.declare_entry("use_face_trace_exchange", "false",
+                      dealii::Patterns::Bool(),
+                      "Exchange the solution values and gradients on the faces shared by two processors "
+                      "instead of the ghost cells' solution when only the residual is assembled. "
+                      "Only used with the weak form, conforming faces between processors, and without artificial dissipation. "
+                      "The ghost values of the solution are then not updated by the residual assembly.");
+
+    prm.declare_entry("use_kokkos_residual", "false",
+                      dealii::Patterns::Bool(),
+                      "Assemble the residual of the unsteady explicit time steps of the strong DG with Kokkos. "
+                      "Only used if PHiLiP is configured with PHILIP_USE_KOKKOS, with a single polynomial degree, a conforming grid, "
+                      "and without the split form nor artificial dissipation. Otherwise, the standard assembly is used.");
+
+    prm.declare_entry("mesh_mover_type", "linear_elasticity",
+                      dealii::Patterns::Selection("linear_elasticity | radial_basis_function"),
+                      "Mesh mover deforming the volume nodes given the surface displacements, "
+                      "used by the free-form deformation and the shape optimization mesh sensitivities. "
+                      "Choices are <linear_elasticity | radial_basis_function>.");
+
+    prm.declare_entry("matrix_free_d2R", "false",
+                      dealii::Patterns::Bool(),
+                      "Evaluate the products with the second derivatives of the dual-weighted residual "
+                      "cell-by-cell through forward-over-reverse AD. Otherwise, assemble d2RdWdW, d2RdWdX, and d2RdXdX.");
+
     prm.declare_entry("test_type", "run_control",
                       dealii::Patterns::Selection(
                       " run_control | "
@@ -251,6 +286,15 @@ void AllParameters::parse_parameters (dealii::ParameterHandler &prm)
     use_L2_norm = prm.get_bool("use_L2_norm");
     use_classical_FR = prm.get_bool("use_classical_Flux_Reconstruction");
     sipg_penalty_factor = prm.get_double("sipg_penalty_factor");
+    reuse_volume_hessian_tapes = prm.get_bool("reuse_volume_hessian_tapes");
+    matrix_free_d2R = prm.get_bool("matrix_free_d2R");
+    use_analytic_flux_jacobians = prm.get_bool("use_analytic_flux_jacobians");
+    use_face_trace_exchange = prm.get_bool("use_face_trace_exchange");
+    use_kokkos_residual = prm.get_bool("use_kokkos_residual");
+
+    const std::string mesh_mover_string = prm.get("mesh_mover_type");
+    if (mesh_mover_string == "linear_elasticity")     mesh_mover_type = linear_elasticity;
+    if (mesh_mover_string == "radial_basis_function") mesh_mover_type = radial_basis_function;
 
     const std::string conv_num_flux_string = prm.get("conv_num_flux");
     if (conv_num_flux_string == "lax_friedrichs") conv_num_flux_type = lax_friedrichs;
@@ -88,6 +88,35 @@ public:
     /// Scaling of Symmetric Interior Penalty term to ensure coercivity.
     double sipg_penalty_factor;
 
+    /// Flag to reuse the recorded volume tapes when assembling second-order derivatives.
+    /** Only valid if the volume residual's control flow does not depend on the solution or geometry.
+     */
+    bool reuse_volume_hessian_tapes;
+
+    /// Flag to evaluate the residual Hessian-vector products without assembling d2RdWdW, d2RdWdX, and d2RdXdX.
+    bool matrix_free_d2R;
+
+    /// Flag to assemble dRdW from hand-derived flux Jacobians instead of automatic differentiation.
+    /** Only used by the weak DG with the Lax-Friedrichs flux and inviscid physics, and only on the cell and interior face terms.
+     *  The Roe-Pike, L2Roe, SIPG and BR2 fluxes and the boundary faces use automatic differentiation.
+     */
+    bool use_analytic_flux_jacobians;
+
+    /// Flag to exchange the face traces instead of the ghost cells' solution when only the residual is assembled.
+    /** Only used by the weak DG when the faces shared by two processors are conforming and without artificial dissipation.
+     */
+    bool use_face_trace_exchange;
+
+    /// Flag to assemble the unsteady explicit residual of the strong DG with Kokkos.
+    /** Only used if PHiLiP is configured with PHILIP_USE_KOKKOS and DGStrong::supports_kokkos_residual().
+     */
+    bool use_kokkos_residual;
+
+    /// Mesh movers deforming the volume nodes given the surface displacements.
+    enum MeshMoverType { linear_elasticity, radial_basis_function };
+    /// Mesh mover used by the free-form deformation and the shape optimization mesh sensitivities.
+    MeshMoverType mesh_mover_type;
+
     /// Number of state variables. Will depend on PDE
     int nstate;
 
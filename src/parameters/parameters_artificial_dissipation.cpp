@@ -42,6 +42,15 @@ void ArtificialDissipationParam::declare_parameters (dealii::ParameterHandler &p
                       dealii::Patterns::Bool(),
                       "By default we calculate the entropy error from the conservative variables. Otherwise, compute the enthalpy error. An example is in Euler Gaussian bump.");
 
+    prm.declare_entry("sensor_update_tolerance", "0.0",
+                      dealii::Patterns::Double(0.0,1e20),
+                      "L2 norm of the solution change below which the discontinuity sensor from the previous residual evaluation is re-used.");
+
+    prm.declare_entry("sensor_update_every_x_steps", "1",
+                      dealii::Patterns::Integer(1,dealii::Patterns::Integer::max_int_value),
+                      "Updates the discontinuity sensor every x nonlinear iterations of the steady state solver. "
+                      "The artificial dissipation coefficients are frozen in between.");
+
     }
     prm.leave_subsection();
 }
@@ -88,6 +97,8 @@ void ArtificialDissipationParam::parse_parameters (dealii::ParameterHandler &prm
 
         mu_artificial_dissipation = prm.get_double("mu_artificial_dissipation");
         kappa_artificial_dissipation = prm.get_double("kappa_artificial_dissipation");
+        sensor_update_tolerance = prm.get_double("sensor_update_tolerance");
+        sensor_update_every_x_steps = prm.get_integer("sensor_update_every_x_steps");
     }
     prm.leave_subsection();
 }
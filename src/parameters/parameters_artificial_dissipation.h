@@ -45,6 +45,16 @@ public:
     ///Flag to calculate enthalpy error 
     bool use_enthalpy_error;
 
+    /// L2 norm of the solution change below which the discontinuity sensor is not re-evaluated.
+    /** The default of zero only re-uses the sensor for an identical solution.
+     */
+    double sensor_update_tolerance;
+
+    /// Number of nonlinear iterations of the steady state solver between updates of the discontinuity sensor.
+    /** In between, the artificial dissipation coefficients are frozen.
+     */
+    int sensor_update_every_x_steps;
+
     /// Constructor
     ArtificialDissipationParam();
 
@@ -25,6 +25,12 @@ void EulerParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("side_slip_angle", "0.0",
                           dealii::Patterns::Double(-180, 180),
                           "Side slip angle in degrees. Required for 3D");
+        prm.declare_entry("two_point_num_flux", "kennedy_gruber",
+                          dealii::Patterns::Selection(
+                          "kennedy_gruber | "
+                          "chandrashekar"),
+                          "Two-point flux used by the split form. "
+                          "Choices are <kennedy_gruber | chandrashekar>.");
     }
     prm.leave_subsection();
 }
@@ -39,6 +45,10 @@ void EulerParam ::parse_parameters (dealii::ParameterHandler &prm)
         const double pi = atan(1.0) * 4.0;
         angle_of_attack = prm.get_double("angle_of_attack") * pi/180.0;
         side_slip_angle = prm.get_double("side_slip_angle") * pi/180.0;
+
+        const std::string two_point_num_flux_string = prm.get("two_point_num_flux");
+        if (two_point_num_flux_string == "kennedy_gruber") two_point_num_flux = kennedy_gruber;
+        if (two_point_num_flux_string == "chandrashekar")  two_point_num_flux = chandrashekar;
     }
     prm.leave_subsection();
 }
@@ -17,6 +17,14 @@ public:
     /// Input file provides in degrees, but the value stored here is in radians
     double side_slip_angle;
 
+    /// Specified choices of two-point flux used by the split form.
+    enum TwoPointNumericalFlux {
+        kennedy_gruber,
+        chandrashekar
+    };
+    /// Selected two-point flux used by the split form.
+    TwoPointNumericalFlux two_point_num_flux;
+
     EulerParam (); ///< Constructor
 
     /// Declares the possible variables and sets the defaults.
@@ -17,6 +17,20 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("output_solution_every_x_steps", "-1",
                           dealii::Patterns::Integer(-1,dealii::Patterns::Integer::max_int_value),
                           "Outputs the solution every x steps in .vtk file");
+        prm.declare_entry("output_format", "vtu",
+                          dealii::Patterns::Selection("vtu|hdf5"),
+                          "File format of the solution output. vtu writes one file per processor. "
+                          "hdf5 writes a single file per output through collective parallel HDF5, "
+                          "along with an .xdmf descriptor, and requires deal.II to be built with HDF5. "
+                          "Choices are <vtu|hdf5>.");
+        prm.declare_entry("output_asynchronous", "true",
+                          dealii::Patterns::Bool(),
+                          "Compress and write the solution files on a background thread such that "
+                          "the solver can keep iterating. The patches are still built synchronously.");
+        prm.declare_entry("output_compression", "best_compression",
+                          dealii::Patterns::Selection("no_compression|best_speed|best_compression|default_compression"),
+                          "Zlib compression level of the solution files. "
+                          "Choices are <no_compression|best_speed|best_compression|default_compression>.");
 
         prm.declare_entry("ode_solver_type", "implicit",
                           dealii::Patterns::Selection("explicit|implicit|pod_galerkin|pod_petrov_galerkin"),
@@ -51,6 +65,19 @@ void ODESolverParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("solutions_table_filename", "solutions_table",
                           dealii::Patterns::Anything(),
                           "Filename to use when outputting solution vectors in a table format.");
+
+        prm.declare_entry("output_checkpoint_every_x_steps", "0",
+                          dealii::Patterns::Integer(0,dealii::Patterns::Integer::max_int_value),
+                          "Writes a checkpoint of the triangulation, grid, solution and ODE solver state "
+                          "every x steps such that the run can be restarted. Set to 0 to disable.");
+        prm.declare_entry("checkpoint_filename", "checkpoint",
+                          dealii::Patterns::Anything(),
+                          "Base filename of the checkpoint files.");
+        prm.declare_entry("restart_from_checkpoint", "false",
+                          dealii::Patterns::Bool(),
+                          "Restarts the ODE solver from the checkpoint stored in checkpoint_filename. "
+                          "The checkpoint is only read by the first solve of the ODE solver. "
+                          "The triangulation must only contain the coarse grid used to write the checkpoint.");
     }
     prm.leave_subsection();
 }
@@ -64,6 +91,17 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
         if (output_string == "verbose") ode_output = OutputEnum::verbose;
 
         output_solution_every_x_steps = prm.get_integer("output_solution_every_x_steps");
+        const std::string format_string = prm.get("output_format");
+        if (format_string == "vtu")  output_format = OutputFormatEnum::vtu;
+        if (format_string == "hdf5") output_format = OutputFormatEnum::hdf5;
+
+        output_asynchronous = prm.get_bool("output_asynchronous");
+
+        const std::string compression_string = prm.get("output_compression");
+        if (compression_string == "no_compression")      output_compression = OutputCompressionEnum::no_compression;
+        if (compression_string == "best_speed")          output_compression = OutputCompressionEnum::best_speed;
+        if (compression_string == "best_compression")    output_compression = OutputCompressionEnum::best_compression;
+        if (compression_string == "default_compression") output_compression = OutputCompressionEnum::default_compression;
 
         const std::string solver_string = prm.get("ode_solver_type");
         if (solver_string == "explicit") ode_solver_type = ODESolverEnum::explicit_solver;
@@ -80,6 +118,10 @@ void ODESolverParam::parse_parameters (dealii::ParameterHandler &prm)
         print_iteration_modulo = prm.get_integer("print_iteration_modulo");
         output_solution_vector_modulo = prm.get_integer("output_solution_vector_modulo");
         solutions_table_filename = prm.get("solutions_table_filename");
+
+        output_checkpoint_every_x_steps = prm.get_integer("output_checkpoint_every_x_steps");
+        checkpoint_filename = prm.get("checkpoint_filename");
+        restart_from_checkpoint = prm.get_bool("restart_from_checkpoint");
     }
     prm.leave_subsection();
 }
@@ -20,16 +20,37 @@ public:
         pod_petrov_galerkin_solver ///Proper Orthogonal Decomposition with Petrov-Galerkin projection (LSPG)
     };
 
+    /// Compression level of the .vtu solution files.
+    enum OutputCompressionEnum {
+        no_compression,
+        best_speed,
+        best_compression,
+        default_compression
+    };
+
+    /// File format of the solution output.
+    enum OutputFormatEnum {
+        vtu, ///< One compressed .vtu per processor and per output, and a .pvtu record.
+        hdf5 ///< One .h5 file per output written with collective parallel HDF5, described by a single .xdmf file.
+    };
+
     OutputEnum ode_output; ///< verbose or quiet.
     ODESolverEnum ode_solver_type; ///< ODE solver type. Note that only implicit has been fully tested for now.
 
     int output_solution_every_x_steps; ///< Outputs the solution every x steps to .vtk file
+    OutputFormatEnum output_format; ///< vtu or hdf5.
+    bool output_asynchronous; ///< Compresses and writes the .vtu files on a background thread.
+    OutputCompressionEnum output_compression; ///< Zlib compression level of the .vtu files.
 
     unsigned int nonlinear_max_iterations; ///< Maximum number of iterations.
     unsigned int print_iteration_modulo; ///< If ode_output==verbose, print every print_iteration_modulo iterations.
     unsigned int output_solution_vector_modulo; ///< Output solution vector every output_solution_vector_modulo iterations of the nonlinear solver
     std::string solutions_table_filename; ///< Filename to write solutions table to
 
+    unsigned int output_checkpoint_every_x_steps; ///< Writes a restart checkpoint every x steps. 0 disables checkpointing.
+    std::string checkpoint_filename; ///< Base filename of the checkpoint files.
+    bool restart_from_checkpoint; ///< Restarts the ODE solver from the checkpoint stored in checkpoint_filename.
+
     double nonlinear_steady_residual_tolerance; ///< Tolerance to determine steady-state convergence.
 
     double initial_time_step; ///< Time step used in ODE solver.
@@ -146,6 +146,35 @@ real ConvectionDiffusion<dim,nstate,real>
     return max_eig;
 }
 
+template <int dim, int nstate, typename real>
+dealii::Tensor<2,nstate,real> ConvectionDiffusion<dim,nstate,real>
+::convective_flux_directional_jacobian (
+    const std::array<real,nstate> &/*solution*/,
+    const dealii::Tensor<1,dim,real> &normal) const
+{
+    const dealii::Tensor<1,dim,real> advection_speed = this->advection_speed();
+    real advection_normal = 0.0;
+    for (int d=0; d<dim; ++d) {
+        advection_normal += advection_speed[d]*normal[d];
+    }
+    dealii::Tensor<2,nstate,real> jacobian;
+    for (int s=0; s<nstate; ++s) {
+        jacobian[s][s] = advection_normal;
+    }
+    return jacobian;
+}
+
+template <int dim, int nstate, typename real>
+std::array<real,nstate> ConvectionDiffusion<dim,nstate,real>
+::max_convective_eigenvalue_gradient (const std::array<real,nstate> &/*soln*/) const
+{
+    std::array<real,nstate> gradient;
+    for (int s=0; s<nstate; ++s) {
+        gradient[s] = 0.0;
+    }
+    return gradient;
+}
+
 template <int dim, int nstate, typename real>
 std::array<dealii::Tensor<1,dim,real>,nstate> ConvectionDiffusion<dim,nstate,real>
 ::dissipative_flux (
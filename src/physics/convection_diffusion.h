@@ -72,6 +72,14 @@ public:
     /// Maximum convective eigenvalue used in Lax-Friedrichs
     real max_convective_eigenvalue (const std::array<real,nstate> &soln) const;
 
+    /// Convective flux Jacobian: \f$ (\mathbf{c} \cdot \mathbf{n}) I \f$
+    dealii::Tensor<2,nstate,real> convective_flux_directional_jacobian (
+        const std::array<real,nstate> &solution,
+        const dealii::Tensor<1,dim,real> &normal) const;
+
+    /// The maximum convective eigenvalue does not depend on the solution.
+    std::array<real,nstate> max_convective_eigenvalue_gradient (const std::array<real,nstate> &soln) const;
+
     //  /// Diffusion matrix is identity
     //  std::array<dealii::Tensor<1,dim,real>,nstate> apply_diffusion_matrix (
     //      const std::array<real,nstate> &solution,
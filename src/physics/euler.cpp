@@ -5,6 +5,7 @@
 
 #include "physics.h"
 #include "euler.h"
+#include "fast_math.h"
 const double BIG_NUMBER = 1e100;
 
 namespace PHiLiP {
@@ -18,11 +19,13 @@ Euler<dim,nstate,real>::Euler (
     const double                                              angle_of_attack,
     const double                                              side_slip_angle,
     const dealii::Tensor<2,3,double>                          input_diffusion_tensor,
-    std::shared_ptr< ManufacturedSolutionFunction<dim,real> > manufactured_solution_function)
+    std::shared_ptr< ManufacturedSolutionFunction<dim,real> > manufactured_solution_function,
+    const Parameters::EulerParam::TwoPointNumericalFlux       two_point_num_flux_type)
     : PhysicsBase<dim,nstate,real>(input_diffusion_tensor, manufactured_solution_function)
     , ref_length(ref_length)
     , gam(gamma_gas)
     , gamm1(gam-1.0)
+    , two_point_num_flux_type(two_point_num_flux_type)
     , density_inf(1.0) // Nondimensional - Free stream values
     , mach_inf(mach_inf)
     , mach_inf_sqr(mach_inf*mach_inf)
@@ -230,7 +233,7 @@ inline real Euler<dim,nstate,real>
     if (density < 0.0) {
         return BIG_NUMBER;
     } else {
-        return pressure*pow(density,-gam);
+        return pressure*FastMath::pow<real>(density,-gam);
     }
 }
 
@@ -346,6 +349,17 @@ template <int dim, int nstate, typename real>
 std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
 ::convective_numerical_split_flux(const std::array<real,nstate> &conservative_soln1,
                                   const std::array<real,nstate> &conservative_soln2) const
+{
+    if (two_point_num_flux_type == Parameters::EulerParam::TwoPointNumericalFlux::chandrashekar) {
+        return convective_numerical_split_flux_chandrashekar(conservative_soln1, conservative_soln2);
+    }
+    return convective_numerical_split_flux_kennedy_gruber(conservative_soln1, conservative_soln2);
+}
+
+template <int dim, int nstate, typename real>
+std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nstate,real>
+::convective_numerical_split_flux_kennedy_gruber(const std::array<real,nstate> &conservative_soln1,
+                                                 const std::array<real,nstate> &conservative_soln2) const
 {
     std::array<dealii::Tensor<1,dim,real>,nstate> conv_num_split_flux;
     const real mean_density = compute_mean_density(conservative_soln1, conservative_soln2);
@@ -369,6 +383,69 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim, nstate, real>
     return conv_num_split_flux;
 }
 
+template <int dim, int nstate, typename real>
+std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nstate,real>
+::convective_numerical_split_flux_chandrashekar(const std::array<real,nstate> &conservative_soln1,
+                                                const std::array<real,nstate> &conservative_soln2) const
+{
+    const real density1 = conservative_soln1[0];
+    const real density2 = conservative_soln2[0];
+    const dealii::Tensor<1,dim,real> vel1 = compute_velocities<real>(conservative_soln1);
+    const dealii::Tensor<1,dim,real> vel2 = compute_velocities<real>(conservative_soln2);
+    // Inverse temperature beta = density/(2 pressure)
+    const real beta1 = 0.5*density1/compute_pressure<real>(conservative_soln1);
+    const real beta2 = 0.5*density2/compute_pressure<real>(conservative_soln2);
+
+    const real density_log_mean = compute_logarithmic_mean(density1, density2);
+    const real beta_log_mean = compute_logarithmic_mean(beta1, beta2);
+    const real mean_density = 0.5*(density1 + density2);
+    const real mean_beta = 0.5*(beta1 + beta2);
+    const real mean_pressure = 0.5*mean_density/mean_beta;
+
+    dealii::Tensor<1,dim,real> mean_velocities;
+    real vel1_squared = 0.0, vel2_squared = 0.0;
+    for (int d=0; d<dim; ++d) {
+        mean_velocities[d] = 0.5*(vel1[d]+vel2[d]);
+        vel1_squared += vel1[d]*vel1[d];
+        vel2_squared += vel2[d]*vel2[d];
+    }
+    // Half the arithmetic mean of the squared velocity magnitudes.
+    const real mean_specific_energy = 0.5/(gamm1*beta_log_mean) - 0.25*(vel1_squared + vel2_squared);
+
+    std::array<dealii::Tensor<1,dim,real>,nstate> conv_num_split_flux;
+    for (int flux_dim = 0; flux_dim < dim; ++flux_dim)
+    {
+        // Density equation
+        const real mass_flux = density_log_mean * mean_velocities[flux_dim];
+        conv_num_split_flux[0][flux_dim] = mass_flux;
+        // Momentum equation
+        for (int velocity_dim=0; velocity_dim<dim; ++velocity_dim){
+            conv_num_split_flux[1+velocity_dim][flux_dim] = mass_flux*mean_velocities[velocity_dim];
+        }
+        conv_num_split_flux[1+flux_dim][flux_dim] += mean_pressure; // Add diagonal of pressure
+        // Energy equation
+        conv_num_split_flux[nstate-1][flux_dim] = mass_flux*mean_specific_energy;
+        for (int velocity_dim=0; velocity_dim<dim; ++velocity_dim){
+            conv_num_split_flux[nstate-1][flux_dim] += conv_num_split_flux[1+velocity_dim][flux_dim]*mean_velocities[velocity_dim];
+        }
+    }
+
+    return conv_num_split_flux;
+}
+
+template <int dim, int nstate, typename real>
+inline real Euler<dim,nstate,real>::
+compute_logarithmic_mean(const real value1, const real value2) const
+{
+    // Ranocha (2018), with zeta = value1/value2, f = (zeta-1)/(zeta+1), and u = f^2.
+    const real u = (value1*(value1-2.0*value2) + value2*value2) / (value1*(value1+2.0*value2) + value2*value2);
+    if (u < 1e-4) {
+        // 2 atanh(f)/f series truncated after the f^6 term.
+        return (value1+value2) * 52.5 / (105.0 + u*(35.0 + u*(21.0 + u*15.0)));
+    }
+    return (value2-value1) / FastMath::log<real>(value2/value1);
+}
+
 
 template <int dim, int nstate, typename real>
 inline real Euler<dim,nstate,real>::
@@ -544,6 +621,44 @@ real Euler<dim,nstate,real>
     return max_eig;
 }
 
+template <int dim, int nstate, typename real>
+std::array<real,nstate> Euler<dim,nstate,real>
+::max_convective_eigenvalue_gradient (const std::array<real,nstate> &conservative_soln) const
+{
+    const real density = conservative_soln[0];
+    const dealii::Tensor<1,dim,real> vel = compute_velocities<real>(conservative_soln);
+    const real vel2 = compute_velocity_squared<real>(vel);
+    const real vel_magnitude = sqrt(vel2);
+    const real pressure = compute_pressure<real>(conservative_soln);
+    const real sound = compute_sound (conservative_soln);
+
+    // Pressure derivatives
+    std::array<real,nstate> dpressure_dsoln;
+    dpressure_dsoln[0] = 0.5*gamm1*vel2;
+    for (int d=0; d<dim; ++d) {
+        dpressure_dsoln[1+d] = -gamm1*vel[d];
+    }
+    dpressure_dsoln[nstate-1] = gamm1;
+
+    // Sound speed c = sqrt(gam*p/rho) such that dc = gam/(2*c*rho) * (dp - p/rho drho)
+    const real dsound_dpressure = gam/(2.0*sound*density);
+    std::array<real,nstate> dmax_eig_dsoln;
+    for (int s=0; s<nstate; ++s) {
+        dmax_eig_dsoln[s] = dsound_dpressure*dpressure_dsoln[s];
+    }
+    dmax_eig_dsoln[0] -= dsound_dpressure*pressure/density;
+
+    // Velocity magnitude |V| = |m|/rho, which is not differentiable at rest
+    if (vel_magnitude > 0.0) {
+        dmax_eig_dsoln[0] -= vel_magnitude/density;
+        for (int d=0; d<dim; ++d) {
+            dmax_eig_dsoln[1+d] += vel[d]/(density*vel_magnitude);
+        }
+    }
+
+    return dmax_eig_dsoln;
+}
+
 
 template <int dim, int nstate, typename real>
 std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nstate,real>
@@ -85,7 +85,8 @@ public:
         const double                                              angle_of_attack,
         const double                                              side_slip_angle,
         const dealii::Tensor<2,3,double>                          input_diffusion_tensor = Parameters::ManufacturedSolutionParam::get_default_diffusion_tensor(),
-        std::shared_ptr< ManufacturedSolutionFunction<dim,real> > manufactured_solution_function = nullptr);
+        std::shared_ptr< ManufacturedSolutionFunction<dim,real> > manufactured_solution_function = nullptr,
+        const Parameters::EulerParam::TwoPointNumericalFlux       two_point_num_flux_type = Parameters::EulerParam::TwoPointNumericalFlux::kennedy_gruber);
 
     /// Destructor
     // virtual ~Euler() =0;
@@ -95,6 +96,9 @@ public:
     const double gam; ///< Constant heat capacity ratio of fluid.
     const double gamm1; ///< Constant heat capacity ratio (Gamma-1.0) used often.
 
+    /// Two-point flux used by convective_numerical_split_flux().
+    const Parameters::EulerParam::TwoPointNumericalFlux two_point_num_flux_type;
+
     /// Non-dimensionalized density* at infinity. density* = density/density_ref
     /// Choose density_ref = density(inf)
     /// density*(inf) = density(inf) / density_ref = density(inf)/density(inf) = 1.0
@@ -149,6 +153,9 @@ public:
     /// Maximum convective eigenvalue used in Lax-Friedrichs
     real max_convective_eigenvalue (const std::array<real,nstate> &soln) const;
 
+    /// Derivatives of the maximum convective eigenvalue \f$ |\mathbf{V}| + c \f$ with respect to the conservative solution.
+    std::array<real,nstate> max_convective_eigenvalue_gradient (const std::array<real,nstate> &conservative_soln) const;
+
     /// Dissipative flux: 0
     virtual std::array<dealii::Tensor<1,dim,real>,nstate> dissipative_flux (
         const std::array<real,nstate> &conservative_soln,
@@ -241,12 +248,31 @@ public:
     /** See the book I do like CFD, sec 4.14.2 */
     real compute_temperature_from_density_pressure ( const real density, const real pressure ) const;
 
+    /// Two-point flux of the split form selected by two_point_num_flux_type.
+    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<real,nstate> &conservative_soln2) const;
+
     /// The Euler split form is that of Kennedy & Gruber.
     /** Refer to Gassner's paper (2016) Eq. 3.10 for more information:  */
-    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux (
+    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_kennedy_gruber (
         const std::array<real,nstate> &conservative_soln1,
         const std::array<real,nstate> &conservative_soln2) const;
 
+    /// Entropy conserving and kinetic energy preserving two-point flux of Chandrashekar.
+    /** Refer to Chandrashekar's paper (2013) Eq. 3.20 for more information.
+     *  The logarithmic means are evaluated with compute_logarithmic_mean().
+     */
+    std::array<dealii::Tensor<1,dim,real>,nstate> convective_numerical_split_flux_chandrashekar (
+        const std::array<real,nstate> &conservative_soln1,
+        const std::array<real,nstate> &conservative_soln2) const;
+
+    /// Logarithmic mean \f$ (b-a)/(\ln b - \ln a) \f$ of two positive values.
+    /** Uses the series expansion of Ranocha (2018) when the two values are close,
+     *  which avoids the cancellation of the direct formula and a logarithm evaluation.
+     */
+    real compute_logarithmic_mean(const real value1, const real value2) const;
+
     /// Mean density given two sets of conservative solutions.
     /** Used in the implementation of the split form.
      */
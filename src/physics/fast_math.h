@@ -0,0 +1,125 @@
+#ifndef __PHYSICS_FAST_MATH__
+#define __PHYSICS_FAST_MATH__
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace PHiLiP {
+namespace Physics {
+
+/// Transcendental functions evaluated in the hot loops of the physics.
+/** The fast_*() kernels only use additions, multiplications, divisions and bit manipulations,
+ *  such that they can be inlined and vectorized by the compiler.
+ *  Arguments outside of the normal floating point range fall back to the standard library.
+ *
+ *  The templated log() and pow() are the ones called by the physics.
+ *  They use the standard library, or the overloads of the AD types, unless PHiLiP is configured
+ *  with -DPHILIP_FAST_MATH=ON, in which case the double precision versions use the fast_*() kernels.
+ *  The AD types always use their own overloads such that the derivatives are unaffected.
+ *  Square roots always use std::sqrt, which is already a single correctly rounded hardware instruction.
+ */
+namespace FastMath {
+
+/// High part of ln(2), exactly representable with the lower bits of the mantissa cleared.
+constexpr double ln2_hi = 6.93147180369123816490e-01;
+/// Low part of ln(2) such that ln2_hi + ln2_lo = ln(2).
+constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+/// Whether @p x is a positive normal floating point number.
+inline bool is_positive_normal (const double x)
+{
+    return x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max();
+}
+
+/// Natural logarithm.
+/** With \f$ x = m 2^e \f$ and \f$ m \in [\sqrt{2}/2, \sqrt{2}) \f$,
+ *  \f$ \ln x = e \ln 2 + 2\,\textrm{atanh}(s) \f$ where \f$ s = (m-1)/(m+1) \f$.
+ *  The series of atanh is truncated once the terms are below the double precision roundoff.
+ */
+inline double fast_log (const double x)
+{
+    if (!is_positive_normal(x)) return std::log(x);
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(double));
+    int exponent = static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+    bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+    double mantissa;
+    std::memcpy(&mantissa, &bits, sizeof(double));
+    if (mantissa > 1.41421356237309504880) {
+        mantissa *= 0.5;
+        ++exponent;
+    }
+
+    const double s = (mantissa - 1.0) / (mantissa + 1.0);
+    const double s2 = s*s;
+    // 1 + s2/3 + s2^2/5 + ... + s2^10/21
+    const double series = 1.0 + s2*(1.0/3.0 + s2*(1.0/5.0 + s2*(1.0/7.0 + s2*(1.0/9.0 + s2*(1.0/11.0
+                        + s2*(1.0/13.0 + s2*(1.0/15.0 + s2*(1.0/17.0 + s2*(1.0/19.0 + s2*(1.0/21.0))))))))));
+
+    const double e = static_cast<double>(exponent);
+    return e*ln2_hi + (2.0*s*series + e*ln2_lo);
+}
+
+/// Exponential.
+/** With \f$ x = k \ln 2 + r \f$ and \f$ |r| \leq \ln(2)/2 \f$, \f$ e^x = 2^k e^r \f$
+ *  where \f$ e^r \f$ is evaluated by its Taylor polynomial of degree 13.
+ */
+inline double fast_exp (const double x)
+{
+    if (!(x > -708.0 && x < 709.0)) return std::exp(x);
+
+    const double k = std::floor(x*(1.0/(ln2_hi+ln2_lo)) + 0.5);
+    const double r = (x - k*ln2_hi) - k*ln2_lo;
+
+    const double taylor = 1.0 + r*(1.0 + r*(1.0/2.0 + r*(1.0/6.0 + r*(1.0/24.0 + r*(1.0/120.0 + r*(1.0/720.0
+                        + r*(1.0/5040.0 + r*(1.0/40320.0 + r*(1.0/362880.0 + r*(1.0/3628800.0
+                        + r*(1.0/39916800.0 + r*(1.0/479001600.0 + r*(1.0/6227020800.0)))))))))))));
+
+    // 2^k is constructed from its exponent bits. k+1023 is within [2,2046].
+    const std::uint64_t bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(k) + 1023) << 52;
+    double scale;
+    std::memcpy(&scale, &bits, sizeof(double));
+    return taylor*scale;
+}
+
+/// Power \f$ x^y = e^{y \ln x} \f$ for a positive base.
+inline double fast_pow (const double x, const double y)
+{
+    if (!is_positive_normal(x)) return std::pow(x, y);
+    return fast_exp(y*fast_log(x));
+}
+
+/// Natural logarithm used by the physics.
+template <typename real>
+inline real log (const real &x)
+{
+    using std::log;
+    return log(x);
+}
+
+/// Power with a constant exponent used by the physics.
+template <typename real>
+inline real pow (const real &x, const double y)
+{
+    using std::pow;
+    return pow(x, y);
+}
+
+#ifdef PHILIP_FAST_MATH
+/// Natural logarithm of a double through fast_log().
+template <>
+inline double log<double> (const double &x) { return fast_log(x); }
+
+/// Power of a double through fast_pow().
+template <>
+inline double pow<double> (const double &x, const double y) { return fast_pow(x, y); }
+#endif
+
+} // FastMath namespace
+} // Physics namespace
+} // PHiLiP namespace
+
+#endif
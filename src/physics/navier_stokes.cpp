@@ -7,6 +7,7 @@
 #include "physics.h"
 #include "euler.h"
 #include "navier_stokes.h"
+#include "fast_math.h"
 
 namespace PHiLiP {
 namespace Physics {
@@ -106,7 +107,7 @@ inline real2 NavierStokes<dim,nstate,real>
      */
     const real2 temperature = this->template compute_temperature<real2>(primitive_soln); // from Euler
 
-    const real2 viscosity_coefficient = ((1.0 + temperature_ratio)/(temperature + temperature_ratio))*pow(temperature,1.5);
+    const real2 viscosity_coefficient = ((1.0 + temperature_ratio)/(temperature + temperature_ratio))*FastMath::pow<real2>(temperature,1.5);
     
     return viscosity_coefficient;
 }
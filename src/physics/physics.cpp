@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <cmath>
 #include <vector>
+#include <iostream>
 
 #include "ADTypes.hpp"
 
@@ -83,6 +84,28 @@ std::array<real,nstate> PhysicsBase<dim,nstate,real>
     return source;
 }
 
+template <int dim, int nstate, typename real>
+dealii::Tensor<2,nstate,real> PhysicsBase<dim,nstate,real>
+::convective_flux_directional_jacobian (
+    const std::array<real,nstate> &/*solution*/,
+    const dealii::Tensor<1,dim,real> &/*normal*/) const
+{
+    std::cout << "The analytic convective flux Jacobian is not available for this physics. "
+              << "Use the automatic differentiation assembly instead." << std::endl;
+    std::abort();
+    return dealii::Tensor<2,nstate,real>();
+}
+
+template <int dim, int nstate, typename real>
+std::array<real,nstate> PhysicsBase<dim,nstate,real>
+::max_convective_eigenvalue_gradient (const std::array<real,nstate> &/*soln*/) const
+{
+    std::cout << "The gradient of the maximum convective eigenvalue is not available for this physics. "
+              << "Use the automatic differentiation assembly instead." << std::endl;
+    std::abort();
+    return std::array<real,nstate>();
+}
+
 template <int dim, int nstate, typename real>
 void PhysicsBase<dim,nstate,real>
 ::boundary_face_values (
@@ -61,6 +61,20 @@ public:
     /// Maximum convective eigenvalue used in Lax-Friedrichs
     virtual real max_convective_eigenvalue (const std::array<real,nstate> &soln) const = 0;
 
+    /// Convective flux Jacobian: \f$ \frac{\partial \mathbf{F}_{conv}}{\partial w} \cdot \mathbf{n} \f$
+    /** Used by the analytic Jacobian assembly.
+     *  The default implementation aborts since not all physics provide it.
+     */
+    virtual dealii::Tensor<2,nstate,real> convective_flux_directional_jacobian (
+        const std::array<real,nstate> &solution,
+        const dealii::Tensor<1,dim,real> &normal) const;
+
+    /// Derivatives of max_convective_eigenvalue() with respect to the solution.
+    /** Used by the analytic Jacobian of the Lax-Friedrichs flux.
+     *  The default implementation aborts since not all physics provide it.
+     */
+    virtual std::array<real,nstate> max_convective_eigenvalue_gradient (const std::array<real,nstate> &soln) const;
+
     // /// Evaluate the diffusion matrix \f$ A \f$ such that \f$F_v = A \nabla u\f$.
     // virtual std::array<dealii::Tensor<1,dim,real>,nstate> apply_diffusion_matrix (
     //     const std::array<real,nstate> &solution,
@@ -0,0 +1,97 @@
+#ifndef __PHYSICS_DISPATCH__
+#define __PHYSICS_DISPATCH__
+
+#include <array>
+#include <type_traits>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/point.h>
+
+namespace PHiLiP {
+namespace Physics {
+
+/// Whether the member functions of PhysicsType are bound at compile time by the dispatch functions below.
+/** The abstract PhysicsBase is called through its virtual functions.
+ *  A concrete PhysicsType is called through a qualified name, which bypasses the virtual table.
+ *  Hence, the dynamic type of the object must be exactly PhysicsType, and not a class derived from it.
+ */
+template <typename PhysicsType>
+constexpr bool is_statically_dispatched = !std::is_abstract<PhysicsType>::value;
+
+/// Convective flux of @p physics.
+template <typename PhysicsType, typename real, std::size_t nstate>
+auto dispatch_convective_flux (
+    const PhysicsType &physics,
+    const std::array<real,nstate> &solution)
+{
+    if constexpr (is_statically_dispatched<PhysicsType>) {
+        return physics.PhysicsType::convective_flux (solution);
+    } else {
+        return physics.convective_flux (solution);
+    }
+}
+
+/// Maximum convective eigenvalue of @p physics.
+template <typename PhysicsType, typename real, std::size_t nstate>
+real dispatch_max_convective_eigenvalue (
+    const PhysicsType &physics,
+    const std::array<real,nstate> &solution)
+{
+    if constexpr (is_statically_dispatched<PhysicsType>) {
+        return physics.PhysicsType::max_convective_eigenvalue (solution);
+    } else {
+        return physics.max_convective_eigenvalue (solution);
+    }
+}
+
+/// Dissipative flux of @p physics.
+template <typename PhysicsType, typename real, std::size_t nstate, int dim>
+auto dispatch_dissipative_flux (
+    const PhysicsType &physics,
+    const std::array<real,nstate> &solution,
+    const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient)
+{
+    if constexpr (is_statically_dispatched<PhysicsType>) {
+        return physics.PhysicsType::dissipative_flux (solution, solution_gradient);
+    } else {
+        return physics.dissipative_flux (solution, solution_gradient);
+    }
+}
+
+/// Source term of @p physics.
+template <typename PhysicsType, typename real, std::size_t nstate, int dim>
+auto dispatch_source_term (
+    const PhysicsType &physics,
+    const dealii::Point<dim,real> &pos,
+    const std::array<real,nstate> &solution)
+{
+    if constexpr (is_statically_dispatched<PhysicsType>) {
+        return physics.PhysicsType::source_term (pos, solution);
+    } else {
+        return physics.source_term (pos, solution);
+    }
+}
+
+/// Boundary values and gradients of @p physics on the other side of the face.
+template <typename PhysicsType, typename real, std::size_t nstate, int dim>
+void dispatch_boundary_face_values (
+    const PhysicsType &physics,
+    const int boundary_type,
+    const dealii::Point<dim,real> &pos,
+    const dealii::Tensor<1,dim,real> &normal,
+    const std::array<real,nstate> &soln_int,
+    const std::array<dealii::Tensor<1,dim,real>,nstate> &soln_grad_int,
+    std::array<real,nstate> &soln_bc,
+    std::array<dealii::Tensor<1,dim,real>,nstate> &soln_grad_bc)
+{
+    if constexpr (is_statically_dispatched<PhysicsType>) {
+        physics.PhysicsType::boundary_face_values (boundary_type, pos, normal, soln_int, soln_grad_int, soln_bc, soln_grad_bc);
+    } else {
+        physics.boundary_face_values (boundary_type, pos, normal, soln_int, soln_grad_int, soln_bc, soln_grad_bc);
+    }
+}
+
+} // Physics namespace
+} // PHiLiP namespace
+
+#endif
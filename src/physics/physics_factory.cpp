@@ -79,7 +79,8 @@ PhysicsFactory<dim,nstate,real>
                 parameters_input->euler_param.angle_of_attack,
                 parameters_input->euler_param.side_slip_angle,
                 diffusion_tensor, 
-                manufactured_solution_function);
+                manufactured_solution_function,
+                parameters_input->euler_param.two_point_num_flux);
         }
     } else if (pde_type == PDE_enum::mhd) {
         if constexpr (nstate == 8) 
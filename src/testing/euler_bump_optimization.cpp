@@ -36,13 +36,13 @@
 namespace PHiLiP {
 namespace Tests {
 
-enum OptimizationAlgorithm { full_space_birosghattas, full_space_composite_step, reduced_space_bfgs, reduced_space_newton };
+enum OptimizationAlgorithm { full_space_birosghattas, full_space_birosghattas_inexact, full_space_composite_step, reduced_space_bfgs, reduced_space_newton };
 enum BirosGhattasPreconditioner { P2, P2A, P4, P4A, identity };
 
 //const std::vector<BirosGhattasPreconditioner> precond_list { P2, P2A, P4, P4A };
 //const std::vector<OptimizationAlgorithm> opt_list { full_space_birosghattas, reduced_space_newton };
 const std::vector<BirosGhattasPreconditioner> precond_list { P2, P2A, P4, P4A };
-const std::vector<OptimizationAlgorithm> opt_list { full_space_birosghattas, reduced_space_bfgs, reduced_space_newton };
+const std::vector<OptimizationAlgorithm> opt_list { full_space_birosghattas, full_space_birosghattas_inexact, reduced_space_bfgs, reduced_space_newton };
 //const std::vector<OptimizationAlgorithm> opt_list { full_space_birosghattas };
 
 const double BUMP_HEIGHT = 0.0625;
@@ -143,6 +143,12 @@ int EulerBumpOptimization<dim,nstate>
             }
             break;
         }
+        case full_space_birosghattas_inexact: {
+            // Eisenstat-Walker forcing terms for the KKT solve and the flow/adjoint solves of the preconditioner.
+            opt_output_name = "full_space_inexact_p4";
+            preconditioner_string = "P4";
+            break;
+        }
         case full_space_composite_step: {
             opt_output_name = "full_space_composite_step";
             break;
@@ -315,8 +321,8 @@ int EulerBumpOptimization<dim,nstate>
         // Reduced space problem
         const bool functional_uses_solution_values = true, functional_uses_solution_gradient = false;
         TargetBoundaryFunctional<dim,nstate,double> target_bump_functional(dg, target_bump_solution, functional_uses_solution_values, functional_uses_solution_gradient);
-        auto obj  = ROL::makePtr<ROLObjectiveSimOpt<dim,nstate>>( target_bump_functional, ffd, ffd_design_variables_indices_dim );
         auto con  = ROL::makePtr<FlowConstraints<dim>>(dg,ffd,ffd_design_variables_indices_dim);
+        auto obj  = ROL::makePtr<ROLObjectiveSimOpt<dim,nstate>>( target_bump_functional, ffd, ffd_design_variables_indices_dim, con->dXvdXp );
         const bool storage = false;
         const bool useFDHessian = false;
         auto robj = ROL::makePtr<ROL::Reduced_Objective_SimOpt<double>>( obj, con, des_var_sim_rol_p, des_var_ctl_rol_p, des_var_adj_rol_p, storage, useFDHessian);
@@ -395,8 +401,8 @@ int EulerBumpOptimization<dim,nstate>
     // Reduced space problem
     const bool functional_uses_solution_values = true, functional_uses_solution_gradient = false;
     TargetBoundaryFunctional<dim,nstate,double> target_ffd_functional(dg, target_ffd_solution, functional_uses_solution_values, functional_uses_solution_gradient);
-    auto obj  = ROL::makePtr<ROLObjectiveSimOpt<dim,nstate>>( target_ffd_functional, ffd, ffd_design_variables_indices_dim );
     auto con  = ROL::makePtr<FlowConstraints<dim>>(dg,ffd,ffd_design_variables_indices_dim);
+    auto obj  = ROL::makePtr<ROLObjectiveSimOpt<dim,nstate>>( target_ffd_functional, ffd, ffd_design_variables_indices_dim, con->dXvdXp );
 
     timing_start = MPI_Wtime();
     // Verbosity setting
@@ -418,6 +424,7 @@ int EulerBumpOptimization<dim,nstate>
     parlist.sublist("General").sublist("Secant").set("Maximum Storage",max_design_cycle);
 
     parlist.sublist("Full Space").set("Preconditioner",preconditioner_string);
+    parlist.sublist("Full Space").sublist("Inexact Solves").set("Use Eisenstat-Walker", opt_type == full_space_birosghattas_inexact);
 
     ROL::Ptr< const ROL::AlgorithmState <double> > algo_state;
     n_vmult = 0;
@@ -484,7 +491,8 @@ int EulerBumpOptimization<dim,nstate>
             algo_state = solver.getAlgorithmState();
             break;
         }
-        case full_space_birosghattas: {
+        case full_space_birosghattas:
+        case full_space_birosghattas_inexact: {
             auto full_space_step = ROL::makePtr<ROL::FullSpace_BirosGhattas<double>>(parlist);
             auto status_test = ROL::makePtr<ROL::StatusTest<double>>(parlist);
             const bool printHeader = true;
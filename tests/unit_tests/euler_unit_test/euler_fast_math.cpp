@@ -0,0 +1,105 @@
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <string>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include "parameters/parameters.h"
+#include "physics/euler.h"
+#include "physics/fast_math.h"
+
+const double TOLERANCE = 1E-13;
+
+/// Relative difference between a value and its reference.
+double relative_difference (const double value, const double reference)
+{
+    return std::abs(value - reference) / std::max(std::abs(reference), 1.0e-300);
+}
+
+/// Aborts if the relative difference exceeds the tolerance.
+void check_relative_difference (const std::string &name, const double x, const double value, const double reference)
+{
+    const double rel_diff = relative_difference(value, reference);
+    if (rel_diff > TOLERANCE) {
+        std::cout << name << "(" << x << ") = " << value
+                  << " while the reference gives " << reference
+                  << ". Relative difference " << rel_diff << " exceeds the tolerance " << TOLERANCE << std::endl;
+        std::cout << "Failing test..." << std::endl;
+        std::abort();
+    }
+}
+
+int main (int /*argc*/, char * /*argv*/[])
+{
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    using namespace PHiLiP::Physics;
+
+    // Fast kernels against the standard library over a wide range of arguments.
+    const int n_samples = 10000;
+    for (int i = 0; i < n_samples; ++i) {
+        const double x = std::exp(-40.0 + 80.0 * i / (n_samples-1));
+        check_relative_difference("fast_pow", x, FastMath::fast_pow(x, 1.5), std::pow(x, 1.5));
+        check_relative_difference("fast_pow", x, FastMath::fast_pow(x, -1.4), std::pow(x, -1.4));
+        // The logarithm is compared in absolute terms close to 1.
+        const double log_value = std::log(x);
+        if (std::abs(FastMath::fast_log(x) - log_value) > TOLERANCE * std::max(std::abs(log_value), 1.0)) {
+            std::cout << "fast_log(" << x << ") = " << FastMath::fast_log(x) << " while the standard library gives " << log_value << std::endl;
+            std::cout << "Failing test..." << std::endl;
+            std::abort();
+        }
+        const double y = -40.0 + 80.0 * i / (n_samples-1);
+        check_relative_difference("fast_exp", y, FastMath::fast_exp(y), std::exp(y));
+    }
+
+    // Euler physics against the same expressions evaluated with the fast kernels.
+    // Whether or not the physics is configured with PHILIP_FAST_MATH, its results must match them to the tolerance.
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    //const double ref_length = 1.0, mach_inf=1.0, angle_of_attack = 0.0, side_slip_angle = 0.0, gamma_gas = 1.4;
+    const double a = 1.0 , b = 0.0, c = 1.4;
+    Euler<dim, nstate, double> euler_physics = Euler<dim, nstate, double>(a,c,a,b,b);
+
+    const double min = 0.0;
+    const double max = 1.0;
+    const int nx = 11;
+
+    std::vector<unsigned int> repetitions(dim, nx);
+    dealii::Point<dim,double> corner1, corner2;
+    for (int d=0; d<dim; d++) { 
+        corner1[d] = min;
+        corner2[d] = max;
+    }
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_rectangle(grid, repetitions, corner1, corner2);
+
+    std::array<double, nstate> conservative_soln, conservative_soln_origin;
+    for (int s=0; s<nstate; s++) {
+        conservative_soln_origin[s] = euler_physics.manufactured_solution_function->value(corner1, s);
+    }
+    for (auto cell : grid.active_cell_iterators()) {
+        for (unsigned int v=0; v < dealii::GeometryInfo<dim>::vertices_per_cell; ++v) {
+            const dealii::Point<dim,double> vertex = cell->vertex(v);
+            for (int s=0; s<nstate; s++) {
+                conservative_soln[s] = euler_physics.manufactured_solution_function->value(vertex, s);
+            }
+            const double density = conservative_soln[0];
+            const double pressure = euler_physics.compute_pressure(conservative_soln);
+
+            const double entropy_measure = pressure*FastMath::fast_pow(density,-c);
+            check_relative_difference("compute_entropy_measure", density, euler_physics.compute_entropy_measure(conservative_soln), entropy_measure);
+
+            // Logarithmic mean of the Chandrashekar flux, away from the series expansion used for close values.
+            const double density_origin = conservative_soln_origin[0];
+            const double density_far = 2.0*density;
+            if (std::abs(density_origin - density) > 0.1*density) {
+                const double log_mean = (density - density_origin) / FastMath::fast_log(density/density_origin);
+                check_relative_difference("compute_logarithmic_mean", density, euler_physics.compute_logarithmic_mean(density_origin, density), log_mean);
+            }
+            const double log_mean_far = (density_far - density) / FastMath::fast_log(density_far/density);
+            check_relative_difference("compute_logarithmic_mean", density, euler_physics.compute_logarithmic_mean(density, density_far), log_mean_far);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include "assert_compare_array.h"
+#include "parameters/parameters.h"
+#include "physics/euler.h"
+
+const double TOLERANCE = 1E-12;
+
+/// Entropy variables of the entropy \f$ U = -\rho s/(\gamma-1) \f$ with \f$ s = \ln(p \rho^{-\gamma}) \f$.
+template <int dim, int nstate>
+std::array<double,nstate> entropy_variables (
+    const PHiLiP::Physics::Euler<dim, nstate, double> &euler_physics,
+    const std::array<double,nstate> &soln)
+{
+    const double density = soln[0];
+    const double pressure = euler_physics.compute_pressure(soln);
+    const dealii::Tensor<1,dim,double> vel = euler_physics.compute_velocities(soln);
+    const double entropy = std::log(pressure) - euler_physics.gam * std::log(density);
+
+    std::array<double,nstate> entropy_var;
+    entropy_var[0] = (euler_physics.gam - entropy) / euler_physics.gamm1 - 0.5 * density * (vel*vel) / pressure;
+    for (int d=0; d<dim; ++d) {
+        entropy_var[1+d] = density * vel[d] / pressure;
+    }
+    entropy_var[nstate-1] = -density / pressure;
+    return entropy_var;
+}
+
+/// Checks the consistency of the two-point flux and, if requested, Tadmor's entropy conservation condition
+/** \f[ (\mathbf{v}_2 - \mathbf{v}_1) \cdot \mathbf{f}^{\#}_d(\mathbf{u}_1,\mathbf{u}_2) = \psi_{2,d} - \psi_{1,d}, \f]
+ *  where the entropy potential flux is \f$ \psi_d = \rho u_d \f$.
+ */
+template <int dim, int nstate>
+void check_two_point_flux (
+    const PHiLiP::Physics::Euler<dim, nstate, double> &euler_physics,
+    const std::array<double,nstate> &soln1,
+    const std::array<double,nstate> &soln2,
+    const bool entropy_conserving)
+{
+    // Consistency: f#(u,u) = f(u)
+    const std::array<dealii::Tensor<1,dim,double>,nstate> conv_flux = euler_physics.convective_flux(soln1);
+    const std::array<dealii::Tensor<1,dim,double>,nstate> split_flux_same = euler_physics.convective_numerical_split_flux(soln1, soln1);
+    for (int d=0; d<dim; ++d) {
+        std::array<double,nstate> flux, split_flux;
+        for (int s=0; s<nstate; ++s) {
+            flux[s] = conv_flux[s][d];
+            split_flux[s] = split_flux_same[s][d];
+        }
+        assert_compare_array<nstate> (flux, split_flux, 1.0, TOLERANCE);
+    }
+
+    if (!entropy_conserving) return;
+
+    const std::array<double,nstate> entropy_var1 = entropy_variables<dim,nstate>(euler_physics, soln1);
+    const std::array<double,nstate> entropy_var2 = entropy_variables<dim,nstate>(euler_physics, soln2);
+    const std::array<dealii::Tensor<1,dim,double>,nstate> split_flux = euler_physics.convective_numerical_split_flux(soln1, soln2);
+    for (int d=0; d<dim; ++d) {
+        std::array<double,1> entropy_jump_dot_flux = {{ 0.0 }};
+        for (int s=0; s<nstate; ++s) {
+            entropy_jump_dot_flux[0] += (entropy_var2[s] - entropy_var1[s]) * split_flux[s][d];
+        }
+        const std::array<double,1> potential_flux_jump = {{ soln2[1+d] - soln1[1+d] }};
+        assert_compare_array<1> (entropy_jump_dot_flux, potential_flux_jump, 1.0, 1e-10);
+    }
+}
+
+int main (int /*argc*/, char * /*argv*/[])
+{
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    const double ref_length = 1.0, gamma_gas = 1.4, mach_inf = 0.5, angle_of_attack = 0.0, side_slip_angle = 0.0;
+    using TwoPointFlux = PHiLiP::Parameters::EulerParam::TwoPointNumericalFlux;
+    const PHiLiP::Physics::Euler<dim, nstate, double> kennedy_gruber(
+        ref_length, gamma_gas, mach_inf, angle_of_attack, side_slip_angle,
+        PHiLiP::Parameters::ManufacturedSolutionParam::get_default_diffusion_tensor(), nullptr, TwoPointFlux::kennedy_gruber);
+    const PHiLiP::Physics::Euler<dim, nstate, double> chandrashekar(
+        ref_length, gamma_gas, mach_inf, angle_of_attack, side_slip_angle,
+        PHiLiP::Parameters::ManufacturedSolutionParam::get_default_diffusion_tensor(), nullptr, TwoPointFlux::chandrashekar);
+
+    const double min = 0;
+    const double max = 1.0;
+    const int nx = 6;
+
+    std::vector<unsigned int> repetitions(dim, nx);
+    dealii::Point<dim,double> corner1, corner2;
+    for (int d=0; d<dim; d++) {
+        corner1[d] = min;
+        corner2[d] = max;
+    }
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_rectangle(grid, repetitions, corner1, corner2);
+
+    // Pairs of states at the vertices of each cell, from nearly identical to largely different states.
+    for (auto cell : grid.active_cell_iterators()) {
+        for (unsigned int v=1; v < dealii::GeometryInfo<dim>::vertices_per_cell; ++v) {
+            const dealii::Point<dim,double> vertex1 = cell->vertex(0);
+            const dealii::Point<dim,double> vertex2 = cell->vertex(v);
+
+            std::array<double,nstate> soln1, soln2, soln_close;
+            for (int s=0; s<nstate; s++) {
+                soln1[s] = chandrashekar.manufactured_solution_function->value(vertex1, s);
+                soln2[s] = chandrashekar.manufactured_solution_function->value(vertex2, s);
+                // Exercises the series expansion of the logarithmic mean.
+                soln_close[s] = soln1[s] * (1.0 + 1e-4*(s+1));
+            }
+
+            check_two_point_flux<dim,nstate>(kennedy_gruber, soln1, soln2, false);
+            check_two_point_flux<dim,nstate>(chandrashekar, soln1, soln2, true);
+            check_two_point_flux<dim,nstate>(chandrashekar, soln1, soln_close, true);
+        }
+    }
+    return 0;
+}
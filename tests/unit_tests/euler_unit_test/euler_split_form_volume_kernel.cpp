@@ -0,0 +1,86 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q_generic.h>
+
+#include "dg/two_point_flux_divergence.hpp"
+#include "parameters/parameters.h"
+#include "physics/euler.h"
+
+const double TOLERANCE = 1E-10;
+
+/// Compares the sum-factorized split form volume kernel of the strong DG to the all-pairs kernel on distorted cells.
+int main (int /*argc*/, char * /*argv*/[])
+{
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    const double ref_length = 1.0, gamma_gas = 1.4, mach_inf = 0.5, angle_of_attack = 0.0, side_slip_angle = 0.0;
+    using TwoPointFlux = PHiLiP::Parameters::EulerParam::TwoPointNumericalFlux;
+    const std::array<TwoPointFlux,2> two_point_fluxes {{ TwoPointFlux::kennedy_gruber, TwoPointFlux::chandrashekar }};
+
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_cube(grid, 2);
+    const double random_factor = 0.2;
+    const bool keep_boundary = false;
+    dealii::GridTools::distort_random (random_factor, grid, keep_boundary);
+    const dealii::MappingQGeneric<dim> mapping(1);
+
+    for (const TwoPointFlux two_point_flux : two_point_fluxes) {
+        const PHiLiP::Physics::Euler<dim, nstate, double> euler_physics(
+            ref_length, gamma_gas, mach_inf, angle_of_attack, side_slip_angle,
+            PHiLiP::Parameters::ManufacturedSolutionParam::get_default_diffusion_tensor(), nullptr, two_point_flux);
+
+        for (unsigned int poly_degree = 1; poly_degree <= 4; ++poly_degree) {
+            // Lagrange basis collocated on the volume nodes, as in DGStrong.
+            const dealii::QGaussLobatto<1> oned_quadrature(poly_degree+1);
+            const dealii::Quadrature<dim> quadrature(oned_quadrature);
+            const dealii::FE_DGQArbitraryNodes<dim> fe_lagrange(oned_quadrature);
+            dealii::FEValues<dim> fe_values(mapping, fe_lagrange, quadrature,
+                dealii::update_gradients | dealii::update_inverse_jacobians | dealii::update_quadrature_points);
+            const dealii::FullMatrix<double> oned_derivative = PHiLiP::build_oned_lagrange_derivative(oned_quadrature);
+
+            for (const auto &cell : grid.active_cell_iterators()) {
+                fe_values.reinit(cell);
+
+                std::vector<std::array<double,nstate>> soln_at_q(quadrature.size());
+                for (unsigned int iquad=0; iquad<quadrature.size(); ++iquad) {
+                    for (int s=0; s<nstate; s++) {
+                        soln_at_q[iquad][s] = euler_physics.manufactured_solution_function->value(fe_values.quadrature_point(iquad), s);
+                    }
+                }
+
+                std::vector<std::array<double,nstate>> divergence_all_pairs, divergence_sum_factorized;
+                PHiLiP::two_point_flux_divergence_all_pairs<dim,nstate,double>(euler_physics, soln_at_q, fe_values, divergence_all_pairs);
+                PHiLiP::two_point_flux_divergence_sum_factorized<dim,nstate,double>(euler_physics, soln_at_q, oned_derivative, fe_values, divergence_sum_factorized);
+
+                // Relative to the largest divergence of the cell, since some entries cancel out.
+                double max_divergence = 0.0, max_difference = 0.0;
+                for (unsigned int iquad=0; iquad<quadrature.size(); ++iquad) {
+                    for (int s=0; s<nstate; s++) {
+                        max_divergence = std::max(max_divergence, std::abs(divergence_all_pairs[iquad][s]));
+                        max_difference = std::max(max_difference, std::abs(divergence_all_pairs[iquad][s] - divergence_sum_factorized[iquad][s]));
+                    }
+                }
+                const double rel_difference = max_difference / std::max(max_divergence, 1.0);
+                std::cout << "Poly degree " << poly_degree << " cell " << cell->active_cell_index()
+                          << " relative difference between the kernels: " << rel_difference << std::endl;
+                if (rel_difference > TOLERANCE) {
+                    std::cout << "Difference too high. Failing test..." << std::endl;
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
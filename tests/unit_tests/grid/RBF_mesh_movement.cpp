@@ -0,0 +1,188 @@
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/convergence_table.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_fe_field.h>
+
+#include "mesh/high_order_grid.h"
+#include "mesh/meshmover_rbf.hpp"
+
+template<int dim>
+dealii::Point<dim> deformation(dealii::Point<dim> point) {
+    const double amplitude = 0.1;
+    dealii::Tensor<1,dim,double> disp;
+    disp[0] = amplitude;
+    disp[0] *= point[0];
+    if(dim>=2) {
+        disp[0] *= std::sin(2.0*dealii::numbers::PI*point[1]);
+    }
+    if(dim>=3) {
+        disp[0] *= std::sin(2.0*dealii::numbers::PI*point[2]);
+    }
+    return point + disp;
+}
+
+/** Tests the RadialBasisFunction mesh movement by moving the mesh and integrating its volume.
+ *  It checks that the surface displacements are recovered exactly, that apply_dXvdXvs()
+ *  reproduces the volume displacements, and that apply_dXvdXvs_transpose() is its transpose.
+ */
+int main (int argc, char * argv[])
+{
+    const int dim = PHILIP_DIM;
+
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    const int initial_n_cells = 3;
+    const unsigned int n_grids = 2;
+    const unsigned int p_start = 1;
+    const unsigned int p_end = 3;
+    const double amplitude = 0.1;
+    const double exact_area = dim>1 ? 1.0 : (amplitude+1.0);
+    const double area_tolerance = 1e-3;
+    const double linear_tolerance = 1e-10;
+    int n_fail = 0;
+
+    dealii::ConvergenceTable convergence_table;
+    for (unsigned int poly_degree = p_start; poly_degree <= p_end; ++poly_degree) {
+        for (unsigned int igrid=0; igrid<n_grids; ++igrid) {
+
+#if PHILIP_DIM==1
+            using Triangulation = dealii::Triangulation<dim>;
+#else
+            using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+#endif
+            std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                MPI_COMM_WORLD,
+#endif
+                typename dealii::Triangulation<dim>::MeshSmoothing(
+                    dealii::Triangulation<dim>::smoothing_on_refinement |
+                    dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+            dealii::GridGenerator::subdivided_hyper_cube(*grid, initial_n_cells);
+
+            HighOrderGrid<dim,double> high_order_grid(poly_degree, grid);
+
+            for (unsigned int i=0; i<igrid; ++i) {
+                high_order_grid.prepare_for_coarsening_and_refinement();
+                grid->refine_global (1);
+                high_order_grid.execute_coarsening_and_refinement();
+            }
+            // Refine half of the cells to introduce hanging nodes.
+            high_order_grid.prepare_for_coarsening_and_refinement();
+            grid->prepare_coarsening_and_refinement();
+            unsigned int icell = 0;
+            for (auto cell = grid->begin_active(); cell!=grid->end(); ++cell) {
+                if (!cell->is_locally_owned()) continue;
+                icell++;
+                if (icell > grid->n_active_cells()/2) cell->set_refine_flag();
+            }
+            grid->execute_coarsening_and_refinement();
+            high_order_grid.execute_coarsening_and_refinement();
+
+            std::function<dealii::Point<dim>(dealii::Point<dim>)> transformation = deformation<dim>;
+            VectorType surface_node_displacements_vector = high_order_grid.transform_surface_nodes(transformation);
+            surface_node_displacements_vector -= high_order_grid.surface_nodes;
+            surface_node_displacements_vector.update_ghost_values();
+
+            MeshMover::RadialBasisFunction<dim, double>
+                meshmover(high_order_grid, surface_node_displacements_vector);
+            VectorType volume_displacements = meshmover.get_volume_displacements();
+
+            const dealii::IndexSet &locally_owned_dofs = high_order_grid.dof_handler_grid.locally_owned_dofs();
+            dealii::IndexSet locally_relevant_dofs;
+            dealii::DoFTools::extract_locally_relevant_dofs(high_order_grid.dof_handler_grid, locally_relevant_dofs);
+            dealii::IndexSet ghost_dofs = locally_relevant_dofs;
+            ghost_dofs.subtract_set(locally_owned_dofs);
+
+            // Surface displacements must be prescribed exactly.
+            VectorType surface_displacements(locally_owned_dofs, ghost_dofs, MPI_COMM_WORLD);
+            bool error = false;
+            const auto &partitioner = surface_node_displacements_vector.get_partitioner();
+            for (unsigned int isurf = 0; isurf < surface_node_displacements_vector.size(); ++isurf) {
+                if (!partitioner->in_local_range(isurf)) continue;
+                const unsigned int idof = high_order_grid.surface_to_volume_indices[isurf];
+                if (!locally_owned_dofs.is_element(idof)) continue;
+                surface_displacements[idof] = surface_node_displacements_vector[isurf];
+                if (meshmover.hanging_node_constraints.is_constrained(idof)) continue;
+                const double surface_displacement_error = std::abs(volume_displacements[idof] - surface_node_displacements_vector[isurf]);
+                if (surface_displacement_error > linear_tolerance) {
+                    std::cout << "Processor " << mpi_rank
+                              << " Surface DoF with global index: " << idof
+                              << " has a computed displacement of " << volume_displacements[idof]
+                              << " instead of the prescribed displacement of " << surface_node_displacements_vector[isurf]
+                              << std::endl;
+                    error = true;
+                }
+            }
+            surface_displacements.update_ghost_values();
+            if (dealii::Utilities::MPI::max(static_cast<int>(error), MPI_COMM_WORLD)) return 1;
+
+            // The mesh movement is linear in the surface displacements.
+            VectorType dXv;
+            meshmover.apply_dXvdXvs(surface_displacements, dXv);
+            dXv -= volume_displacements;
+            const double linear_error = dXv.linfty_norm();
+            pcout << "Error of dXvdXvs applied to the surface displacements: " << linear_error << std::endl;
+            if (linear_error > linear_tolerance) n_fail++;
+
+            // <u, dXvdXvs v> = <dXvdXvs^T u, v> for arbitrary u and surface v.
+            VectorType u(locally_owned_dofs, ghost_dofs, MPI_COMM_WORLD);
+            for (const auto idof : locally_owned_dofs) u[idof] = std::cos(1.0+idof);
+            u.update_ghost_values();
+            VectorType dXvdXvs_v, dXvdXvs_T_u;
+            meshmover.apply_dXvdXvs(surface_displacements, dXvdXvs_v);
+            meshmover.apply_dXvdXvs_transpose(u, dXvdXvs_T_u);
+            const double uAv = u * dXvdXvs_v;
+            const double ATuv = dXvdXvs_T_u * surface_displacements;
+            const double transpose_error = std::abs(uAv - ATuv) / std::max(1.0, std::abs(uAv));
+            pcout << "<u, A v> = " << uAv << " <A^T u, v> = " << ATuv << std::endl;
+            if (transpose_error > linear_tolerance) n_fail++;
+
+            high_order_grid.volume_nodes += volume_displacements;
+            high_order_grid.volume_nodes.update_ghost_values();
+
+            const int overintegrate = 10;
+            dealii::QGauss<dim> quad_extra(high_order_grid.max_degree+1+overintegrate);
+            dealii::FEValues<dim,dim> fe_values_extra(*(high_order_grid.mapping_fe_field), high_order_grid.fe_system, quad_extra, dealii::update_JxW_values);
+            double area = 0;
+            for (auto cell : high_order_grid.dof_handler_grid.active_cell_iterators()) {
+                if (!cell->is_locally_owned()) continue;
+                fe_values_extra.reinit (cell);
+                for (unsigned int iquad=0; iquad<quad_extra.size(); ++iquad) {
+                    area += fe_values_extra.JxW(iquad);
+                }
+            }
+            const double area_mpi_sum = dealii::Utilities::MPI::sum(area, MPI_COMM_WORLD);
+            const double area_error = std::abs(exact_area-area_mpi_sum);
+
+            convergence_table.add_value("p", poly_degree);
+            convergence_table.add_value("cells", grid->n_global_active_cells());
+            convergence_table.add_value("DoFs", high_order_grid.dof_handler_grid.n_dofs());
+            convergence_table.add_value("controls", meshmover.n_control_points());
+            convergence_table.add_value("area_error", area_error);
+
+            if (poly_degree > 1 && area_error > area_tolerance) {
+                pcout << "Integrated area not accurate.. Estimated area is "
+                      << area_mpi_sum << " instead of expected "
+                      << exact_area << " within a tolerance of "
+                      << area_tolerance << std::endl;
+                n_fail++;
+            }
+        }
+    }
+    convergence_table.set_scientific("area_error", true);
+    if (pcout.is_active()) convergence_table.write_text(pcout.get_stream());
+
+    return n_fail;
+}
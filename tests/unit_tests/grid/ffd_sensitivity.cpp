@@ -123,6 +123,22 @@ int main (int argc, char * argv[])
 
                 if (rel_diff_frob_norm > 1e-4) fail_bool = true;
 
+                // Same check through the RBF mesh mover, whose control points reproduce every design mode.
+                {
+                    FreeFormDeformation<dim> ffd_rbf = ffd;
+                    ffd_rbf.mesh_mover_type = Parameters::AllParameters::MeshMoverType::radial_basis_function;
+                    dealii::TrilinosWrappers::SparseMatrix dXvdXp_rbf, dXvdXp_rbf_FD;
+                    ffd_rbf.get_dXvdXp(high_order_grid, ffd_design_variables_indices_dim, dXvdXp_rbf);
+                    ffd_rbf.get_dXvdXp_FD(high_order_grid, ffd_design_variables_indices_dim, dXvdXp_rbf_FD, EPS);
+
+                    const double dXvdXp_rbf_frob_norm = dXvdXp_rbf.frobenius_norm();
+                    dXvdXp_rbf.add(-1.0, dXvdXp_rbf_FD);
+                    const double rel_diff_rbf = dXvdXp_rbf.frobenius_norm() / dXvdXp_rbf_frob_norm;
+
+                    pcout << " RBF dXvdXp error: " << rel_diff_rbf << std::endl;
+                    if (rel_diff_rbf > 1e-4) fail_bool = true;
+                }
+
 
                 std::vector<dealii::LinearAlgebra::distributed::Vector<double>> dXvsdXp_vector_AD = ffd.get_dXvsdXp ( high_order_grid, ffd_design_variables_indices_dim );
                 std::vector<dealii::LinearAlgebra::distributed::Vector<double>> dXvsdXp_vector_FD = ffd.get_dXvsdXp_FD ( high_order_grid, ffd_design_variables_indices_dim, EPS );
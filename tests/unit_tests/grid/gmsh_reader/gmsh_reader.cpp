@@ -16,6 +16,17 @@ int main (int argc, char * argv[])
 
     std::shared_ptr< HighOrderGrid<dim, double> > high_order_grid = read_gmsh <dim, dim> (filename);
 
+    // The binary version of the same mesh should result in the same grid
+    std::string filename_binary = std::to_string(dim) + "D_square_binary.msh";
+
+    std::shared_ptr< HighOrderGrid<dim, double> > high_order_grid_binary = read_gmsh <dim, dim> (filename_binary);
+
+    const double ascii_norm = high_order_grid->volume_nodes.l2_norm();
+    const double binary_norm = high_order_grid_binary->volume_nodes.l2_norm();
+    pcout << "ASCII grid nodes norm: " << ascii_norm << " Binary grid nodes norm: " << binary_norm << std::endl;
+    if (std::abs(ascii_norm - binary_norm) > 1e-12 * ascii_norm) fail_bool = true;
+    if (high_order_grid->triangulation->n_global_active_cells() != high_order_grid_binary->triangulation->n_global_active_cells()) fail_bool = true;
+
 
     dealii::GridOut gridout;
     gridout.write_mesh_per_processor_as_vtu(*(high_order_grid->triangulation), "tria");
@@ -24,7 +35,7 @@ int main (int argc, char * argv[])
 
 
     if (fail_bool) {
-        pcout << "Test failed. The estimated error should be the same for a given p, even after refinement and translation." << std::endl;
+        pcout << "Test failed. The ASCII and binary Gmsh files should result in the same grid." << std::endl;
     } else {
         pcout << "Test successful." << std::endl;
     }
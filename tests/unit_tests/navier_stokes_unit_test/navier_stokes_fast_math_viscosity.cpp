@@ -0,0 +1,76 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include "parameters/parameters.h"
+#include "physics/navier_stokes.h"
+#include "physics/fast_math.h"
+
+const double TOLERANCE = 1E-13;
+
+int main (int /*argc*/, char * /*argv*/[])
+{
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nstate = dim+2;
+
+    //const double ref_length = 1.0, mach_inf=1.0, angle_of_attack = 0.0, side_slip_angle = 0.0, gamma_gas = 1.4;
+    //const double prandtl_number = 0.72, reynolds_number_inf=1.0;
+    const double a = 1.0 , b = 0.0, c = 1.4, d=0.72, e=1.0;
+    PHiLiP::Physics::NavierStokes<dim, nstate, double> navier_stokes_physics = PHiLiP::Physics::NavierStokes<dim, nstate, double>(a,c,a,b,b,d,e);
+
+    const double min = 0;
+    const double max = 1.0;
+    const int nx = 6;
+
+    std::vector<unsigned int> repetitions(dim, nx);
+    dealii::Point<dim,double> corner1, corner2;
+    for (int d=0; d<dim; d++) { 
+        corner1[d] = min;
+        corner2[d] = max;
+    }
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_rectangle(grid, repetitions, corner1, corner2);
+
+    std::array<double, nstate> soln;
+    std::array<double,nstate> primitive_soln;
+
+    const double temperature_ratio = 110.4/273.15;
+    const double reynolds_number_inf = e;
+
+    for (auto cell : grid.active_cell_iterators()) {
+        for (unsigned int v=0; v < dealii::GeometryInfo<dim>::vertices_per_cell; ++v) {
+
+            const dealii::Point<dim,double> vertex = cell->vertex(v);
+
+            for (int s=0; s<nstate; s++) {
+                soln[s] = navier_stokes_physics.manufactured_solution_function->value(vertex, s);
+            }
+            primitive_soln = navier_stokes_physics.convert_conservative_to_primitive(soln); // from Euler
+            const double temperature = navier_stokes_physics.compute_temperature(primitive_soln); // from Euler
+
+            // Sutherland's law evaluated with the fast kernel, which must match the physics whether or not it is configured with PHILIP_FAST_MATH.
+            const double mu_fast = ((1.0 + temperature_ratio)/(temperature + temperature_ratio))*PHiLiP::Physics::FastMath::fast_pow(temperature,1.5)/reynolds_number_inf;
+            // Sutherland's law as evaluated by the physics
+            const double mu_physics = navier_stokes_physics.compute_scaled_viscosity_coefficient(primitive_soln);
+
+            const double rel_diff = std::abs(mu_physics - mu_fast)/std::abs(mu_fast);
+            std::cout
+            << "Fast kernel = " << mu_fast
+            << std::endl
+            << "Physics = " << mu_physics
+            << std::endl
+            << "Relative difference = " << rel_diff
+            << std::endl;
+            std::cout << std::endl;
+            if(rel_diff > TOLERANCE) {
+                std::cout << "Difference too high. rel_diff=" << rel_diff << " and tolerance=" << TOLERANCE << std::endl;
+                std::cout << "Failing test..." << std::endl;
+                std::abort();
+            }
+        }
+    }
+    return 0;
+}
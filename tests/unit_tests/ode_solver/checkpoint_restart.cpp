@@ -0,0 +1,148 @@
+#include <cmath>
+
+#include <deal.II/base/function.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "ode_solver/ode_solver_factory.h"
+#include "dg/dg_factory.hpp"
+#include "parameters/all_parameters.h"
+
+using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+
+const double TIME_STEP = 0.01;
+const unsigned int N_TIME_STEPS = 10;
+const double TOLERANCE = 1e-12;
+
+/// Initial condition advected by the checkpoint/restart runs.
+template <int dim>
+class GaussianPulse : public dealii::Function<dim>
+{
+public:
+    /// Constructor.
+    GaussianPulse() : dealii::Function<dim>(1) {}
+    /// Value of the pulse centered in the unit square.
+    double value (const dealii::Point<dim> &point, const unsigned int /*component*/ = 0) const override
+    {
+        double r2 = 0.0;
+        for (int d = 0; d < dim; ++d) r2 += (point[d]-0.5)*(point[d]-0.5);
+        return std::exp(-20.0*r2);
+    }
+};
+
+/// Creates the DG object on the coarse grid, which is the grid expected by Triangulation::load().
+std::shared_ptr< PHiLiP::DGBase<PHILIP_DIM, double> > create_dg (const PHiLiP::Parameters::AllParameters &parameters)
+{
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+        MPI_COMM_WORLD,
+        typename dealii::Triangulation<PHILIP_DIM>::MeshSmoothing(
+            dealii::Triangulation<PHILIP_DIM>::smoothing_on_refinement |
+            dealii::Triangulation<PHILIP_DIM>::smoothing_on_coarsening));
+    dealii::GridGenerator::subdivided_hyper_cube(*grid, 4);
+
+    const unsigned int poly_degree = 1;
+    std::shared_ptr< PHiLiP::DGBase<PHILIP_DIM, double> > dg = PHiLiP::DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&parameters, poly_degree, grid);
+    dg->allocate_system ();
+    dealii::VectorTools::interpolate(dg->dof_handler, GaussianPulse<PHILIP_DIM>(), dg->solution);
+    return dg;
+}
+
+/// Relative difference between the restarted and the reference solutions.
+double relative_difference (
+    const dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const dealii::LinearAlgebra::distributed::Vector<double> &reference)
+{
+    dealii::LinearAlgebra::distributed::Vector<double> difference(solution);
+    difference -= reference;
+    return difference.l2_norm() / reference.l2_norm();
+}
+
+/** Checks that a run restarted from a checkpoint reaches the same final time and solution
+ *  as an uninterrupted run, both for a single advance_solution_time() call and for a caller
+ *  advancing one time step per call.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    int test_error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    Parameters::AllParameters parameters;
+    parameters.parse_parameters (parameter_handler);
+    parameters.pde_type = Parameters::AllParameters::PartialDifferentialEquation::advection;
+    parameters.ode_solver_param.ode_solver_type = Parameters::ODESolverParam::ODESolverEnum::explicit_solver;
+    parameters.ode_solver_param.initial_time_step = TIME_STEP;
+    parameters.ode_solver_param.print_iteration_modulo = 1000;
+    parameters.ode_solver_param.restart_from_checkpoint = false;
+
+    const double final_time = N_TIME_STEPS*TIME_STEP;
+
+    // Uninterrupted reference.
+    std::shared_ptr< DGBase<PHILIP_DIM, double> > dg_reference = create_dg(parameters);
+    std::shared_ptr< ODE::ODESolverBase<PHILIP_DIM, double> > ode_reference = ODE::ODESolverFactory<PHILIP_DIM, double>::create_ODESolver(dg_reference);
+    ode_reference->advance_solution_time(final_time);
+
+    // Single call interrupted after the last checkpoint, at step 8.
+    {
+        Parameters::AllParameters checkpoint_parameters = parameters;
+        checkpoint_parameters.ode_solver_param.output_checkpoint_every_x_steps = 4;
+        checkpoint_parameters.ode_solver_param.checkpoint_filename = "checkpoint_single_call";
+        std::shared_ptr< DGBase<PHILIP_DIM, double> > dg = create_dg(checkpoint_parameters);
+        std::shared_ptr< ODE::ODESolverBase<PHILIP_DIM, double> > ode_solver = ODE::ODESolverFactory<PHILIP_DIM, double>::create_ODESolver(dg);
+        ode_solver->advance_solution_time(final_time);
+
+        Parameters::AllParameters restart_parameters = checkpoint_parameters;
+        restart_parameters.ode_solver_param.output_checkpoint_every_x_steps = 0;
+        restart_parameters.ode_solver_param.restart_from_checkpoint = true;
+        std::shared_ptr< DGBase<PHILIP_DIM, double> > dg_restart = create_dg(restart_parameters);
+        std::shared_ptr< ODE::ODESolverBase<PHILIP_DIM, double> > ode_restart = ODE::ODESolverFactory<PHILIP_DIM, double>::create_ODESolver(dg_restart);
+        ode_restart->advance_solution_time(final_time);
+
+        const double time_error = std::abs(ode_restart->current_time - final_time);
+        const double solution_error = relative_difference(dg_restart->solution, dg_reference->solution);
+        pcout << " Single call restart: final time " << ode_restart->current_time
+              << " solution relative difference " << solution_error << std::endl;
+        if (time_error > TOLERANCE || solution_error > TOLERANCE) test_error = 1;
+    }
+
+    // One time step per call. The checkpoints are scheduled on the steps taken over all the calls,
+    // so the last one is written after step 9.
+    {
+        Parameters::AllParameters checkpoint_parameters = parameters;
+        checkpoint_parameters.ode_solver_param.output_checkpoint_every_x_steps = 3;
+        checkpoint_parameters.ode_solver_param.checkpoint_filename = "checkpoint_time_step_calls";
+        std::shared_ptr< DGBase<PHILIP_DIM, double> > dg = create_dg(checkpoint_parameters);
+        std::shared_ptr< ODE::ODESolverBase<PHILIP_DIM, double> > ode_solver = ODE::ODESolverFactory<PHILIP_DIM, double>::create_ODESolver(dg);
+        for (unsigned int i = 0; i < N_TIME_STEPS; ++i) ode_solver->advance_solution_time(TIME_STEP);
+
+        Parameters::AllParameters restart_parameters = checkpoint_parameters;
+        restart_parameters.ode_solver_param.output_checkpoint_every_x_steps = 0;
+        restart_parameters.ode_solver_param.restart_from_checkpoint = true;
+        std::shared_ptr< DGBase<PHILIP_DIM, double> > dg_restart = create_dg(restart_parameters);
+        std::shared_ptr< ODE::ODESolverBase<PHILIP_DIM, double> > ode_restart = ODE::ODESolverFactory<PHILIP_DIM, double>::create_ODESolver(dg_restart);
+
+        // The first call completes the interrupted call, which had already reached its final time.
+        ode_restart->advance_solution_time(TIME_STEP);
+        const double checkpoint_time = (N_TIME_STEPS-1)*TIME_STEP;
+        if (std::abs(ode_restart->current_time - checkpoint_time) > TOLERANCE) test_error = 1;
+        while (ode_restart->current_time < final_time - 0.5*TIME_STEP) ode_restart->advance_solution_time(TIME_STEP);
+
+        const double time_error = std::abs(ode_restart->current_time - final_time);
+        const double solution_error = relative_difference(dg_restart->solution, dg_reference->solution);
+        pcout << " Time step calls restart: final time " << ode_restart->current_time
+              << " solution relative difference " << solution_error << std::endl;
+        if (time_error > TOLERANCE || solution_error > TOLERANCE) test_error = 1;
+    }
+
+    if (test_error) {
+        pcout << "Test failed. The restarted run does not match the uninterrupted run." << std::endl;
+    } else {
+        pcout << "Test successful." << std::endl;
+    }
+    return test_error;
+}
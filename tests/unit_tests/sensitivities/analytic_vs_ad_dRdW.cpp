@@ -0,0 +1,158 @@
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType  = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-10;
+
+/** This test checks that dRdW assembled from the analytic flux Jacobians
+ *  matches entry by entry the one obtained through automatic differentiation.
+ */
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+
+    // Each DG holds its own parameters, since use_analytic_flux_jacobians is read at assembly time.
+    Parameters::AllParameters ad_parameters = all_parameters;
+    ad_parameters.use_analytic_flux_jacobians = false;
+    Parameters::AllParameters analytic_parameters = all_parameters;
+    analytic_parameters.use_analytic_flux_jacobians = true;
+
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg_ad = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&ad_parameters, poly_degree, grid);
+    dg_ad->allocate_system ();
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg_analytic = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&analytic_parameters, poly_degree, grid);
+    dg_analytic->allocate_system ();
+
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg_ad->dof_handler.n_dofs() << std::endl;
+
+    using solutionVector = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    solutionVector solution_no_ghost;
+    solution_no_ghost.reinit(dg_ad->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg_ad->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg_ad->solution = solution_no_ghost;
+    for (auto it = dg_ad->solution.begin(); it != dg_ad->solution.end(); ++it) {
+        (*it) += 1.0;
+    }
+    dg_ad->solution.update_ghost_values();
+    dg_analytic->solution = dg_ad->solution;
+    dg_analytic->solution.update_ghost_values();
+
+    // Perturb the solution between assemblies such that each one is actually assembled.
+    const int n_assemblies = 5;
+    const auto time_dRdW = [&](DGBase<PHILIP_DIM,double> &dg) {
+        const double timing_start = MPI_Wtime();
+        for (int i = 0; i < n_assemblies; ++i) {
+            if (dg.locally_owned_dofs.n_elements() > 0) dg.solution[*dg.locally_owned_dofs.begin()] += 1e-8;
+            dg.solution.update_ghost_values();
+            dg.assemble_residual(true, false, false);
+        }
+        return (MPI_Wtime() - timing_start) / n_assemblies;
+    };
+
+    pcout << "Evaluating AD..." << std::endl;
+    const double ad_time = time_dRdW(*dg_ad);
+
+    pcout << "Evaluating analytic Jacobians..." << std::endl;
+    const double analytic_time = time_dRdW(*dg_analytic);
+
+    pcout << "dRdW assembly time per evaluation: AD " << ad_time << " s, analytic " << analytic_time
+          << " s, speedup " << ad_time / analytic_time << std::endl;
+
+    const double dRdW_error = dg_analytic->report_sensitivity_errors(dg_ad->system_matrix, dg_analytic->system_matrix, TOLERANCE);
+
+    solutionVector rhs_ad = dg_ad->right_hand_side;
+    rhs_ad -= dg_analytic->right_hand_side;
+    const double rhs_error = rhs_ad.linfty_norm();
+    pcout << "Right-hand side difference: " << rhs_error << std::endl;
+
+    if (dRdW_error > TOLERANCE || rhs_error > TOLERANCE) return 1;
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    all_parameters.conv_num_flux_type = Parameters::AllParameters::ConvectiveNumericalFlux::lax_friedrichs;
+    std::vector<PDEType> pde_type {
+        PDEType::advection
+        , PDEType::euler
+    };
+    std::vector<std::string> pde_name {
+        " PDEType::advection "
+        , " PDEType::euler "
+    };
+
+    int ipde = -1;
+    for (auto pde = pde_type.begin(); pde != pde_type.end(); pde++) {
+        ipde++;
+        for (unsigned int poly_degree=1; poly_degree<3; ++poly_degree) {
+            for (unsigned int igrid=3; igrid<5; ++igrid) {
+                pcout << "Using " << pde_name[ipde] << std::endl;
+                all_parameters.pde_type = *pde;
+                // Generate grids
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                    MPI_COMM_WORLD,
+#endif
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+                dealii::GridGenerator::subdivided_hyper_cube(*grid, igrid);
+
+                const double random_factor = 0.2;
+                const bool keep_boundary = false;
+                if (random_factor > 0.0) dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+                for (auto &cell : grid->active_cell_iterators()) {
+                    for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                        if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                    }
+                }
+
+                if (*pde==PDEType::euler) {
+                    error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+                } else {
+                    error = test<dim,1>(poly_degree, grid, all_parameters);
+                }
+                if (error) return error;
+            }
+        }
+    }
+
+    return error;
+}
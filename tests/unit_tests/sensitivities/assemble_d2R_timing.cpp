@@ -28,8 +28,9 @@ using PDEType  = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
 const double TOLERANCE = 1E-4;
 const double EPS = 1E-4;
 
-/** This test checks that dRdX evaluated using automatic differentiation
- *  matches with the results obtained using finite-difference.
+/** Times the dRdW and the taped d2R assemblies of DGWeak.
+ *  The AD widths are compile-time constants of the DG library, so the widths are compared
+ *  by configuring separate builds with -DPHILIP_AD_FORWARD_WIDTH and -DPHILIP_AD_REVERSE_WIDTH.
  */
 template<int dim, int nstate>
 int test (
@@ -99,16 +100,25 @@ int test (
     const dealii::IndexSet &col_parallel_partitioning = dg->locally_owned_dofs;
     d2RdWdW_fd.reinit(row_parallel_partitioning, col_parallel_partitioning, sparsity_pattern, MPI_COMM_WORLD);
 
-    pcout << "Evaluating AD..." << std::endl;
+    pcout << "Evaluating dRdW with reverse width " << dimReverseAD << "..." << std::endl;
     double timing_start = MPI_Wtime();
+    const int n_jac = 5;
+    for (int i=0; i < n_jac; ++i) {
+        dg->assemble_residual(true, false, false);
+    }
+    double timing_end = MPI_Wtime();
+    pcout << "dRdW assembly took " << (timing_end - timing_start)/n_jac << " seconds per evaluation." << std::endl;
+
+    pcout << "Evaluating d2R with forward width " << dimForwardAD << "..." << std::endl;
+    timing_start = MPI_Wtime();
     int n = 5;
     for (int i=0; i < n; ++i) {
         std::cout << i << " out of " << n << std::endl;
         *(dg->solution.begin()) += 1e-7;
         dg->assemble_residual(false, false, true);
     }
-    double timing_end = MPI_Wtime();
-    std::cout << "The process took " << timing_end - timing_start << " seconds to run." << std::endl;
+    timing_end = MPI_Wtime();
+    pcout << "d2R assembly took " << (timing_end - timing_start)/n << " seconds per evaluation with forward width " << dimForwardAD << "." << std::endl;
 
     return 0;
 }
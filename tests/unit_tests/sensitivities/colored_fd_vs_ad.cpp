@@ -0,0 +1,144 @@
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType  = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-5;
+const double EPS_W = 1e-5;
+const double EPS_X = 1e-6;
+
+/** This test checks that dRdW and dRdX evaluated using automatic differentiation
+ *  match entry by entry with the colored finite-differences, where all the
+ *  non-interacting columns of a color are perturbed within the same residual evaluation.
+ */
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    // Initialize solution with something
+    using solutionVector = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    solutionVector solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    for (auto it = dg->solution.begin(); it != dg->solution.end(); ++it) {
+        // Stay away from the non-differentiable inflow/outflow switch of the exact boundary state.
+        (*it) += 1.0;
+    }
+    dg->solution.update_ghost_values();
+
+    pcout << "Evaluating AD..." << std::endl;
+    dg->assemble_residual(true, false, false);
+    dg->assemble_residual(false, true, false);
+
+    pcout << "Evaluating colored FD of dRdW..." << std::endl;
+    const dealii::SparsityPattern dRdW_sparsity_pattern = dg->get_dRdW_sparsity_pattern();
+    const dealii::TrilinosWrappers::SparseMatrix dRdW_fd = dg->get_dRdW_finite_differences(dRdW_sparsity_pattern, EPS_W);
+    const double dRdW_error = dg->report_sensitivity_errors(dRdW_fd, dg->system_matrix, TOLERANCE);
+
+    pcout << "Evaluating colored FD of dRdX..." << std::endl;
+    const dealii::SparsityPattern dRdX_sparsity_pattern = dg->get_dRdX_sparsity_pattern();
+    const dealii::TrilinosWrappers::SparseMatrix dRdX_fd = dg->get_dRdX_finite_differences(dRdX_sparsity_pattern, EPS_X);
+    const double dRdX_error = dg->report_sensitivity_errors(dRdX_fd, dg->dRdXv, TOLERANCE);
+
+    if (dRdW_error > TOLERANCE || dRdX_error > TOLERANCE) return 1;
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    std::vector<PDEType> pde_type {
+        PDEType::diffusion
+        , PDEType::advection
+        , PDEType::euler
+        , PDEType::navier_stokes
+    };
+    std::vector<std::string> pde_name {
+         " PDEType::diffusion "
+        , " PDEType::advection "
+        , " PDEType::euler "
+        , " PDEType::navier_stokes "
+    };
+
+    int ipde = -1;
+    for (auto pde = pde_type.begin(); pde != pde_type.end() || error == 1; pde++) {
+        ipde++;
+        for (unsigned int poly_degree=1; poly_degree<3; ++poly_degree) {
+            for (unsigned int igrid=3; igrid<5; ++igrid) {
+                pcout << "Using " << pde_name[ipde] << std::endl;
+                all_parameters.pde_type = *pde;
+                all_parameters.diss_num_flux_type = Parameters::AllParameters::DissipativeNumericalFlux::bassi_rebay_2;
+                // Generate grids
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                    MPI_COMM_WORLD,
+#endif
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+                dealii::GridGenerator::subdivided_hyper_cube(*grid, igrid);
+
+                const double random_factor = 0.2;
+                const bool keep_boundary = false;
+                if (random_factor > 0.0) dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+                for (auto &cell : grid->active_cell_iterators()) {
+                    for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                        if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                    }
+                }
+
+                if ((*pde==PDEType::euler) || (*pde==PDEType::navier_stokes)) {
+                    error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+                } else {
+                    error = test<dim,1>(poly_degree, grid, all_parameters);
+                }
+                if (error) return error;
+            }
+        }
+    }
+
+    return error;
+}
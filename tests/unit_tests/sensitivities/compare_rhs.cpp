@@ -75,6 +75,12 @@ int test (
     compute_dRdW = false; compute_dRdX = false, compute_d2R = false;
     dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
     dealii::LinearAlgebra::distributed::Vector<double> rhs_only(dg->right_hand_side);
+
+    // The residual norms reduced by the assembly must match the ones evaluated by looping over the grid.
+    const double reduced_l2norm = dg->get_residual_l2norm();
+    const double reduced_linfnorm = dg->get_residual_linfnorm();
+    const double l2norm_rel_diff = std::abs(reduced_l2norm - dg->evaluate_residual_l2norm()) / reduced_l2norm;
+    const double linfnorm_rel_diff = std::abs(reduced_linfnorm - dg->evaluate_residual_linfnorm()) / reduced_linfnorm;
     // pcout << "*******************************************************************************" << std::endl;
 
     pcout << "Evaluating RHS with dRdW..." << std::endl;
@@ -113,6 +119,8 @@ int test (
     pcout << "Error: dRdW_vs_rhs_rel_diff1: " << dRdW_vs_rhs_rel_diff1
                     << " dRdX_vs_rhs_rel_diff2: " << dRdX_vs_rhs_rel_diff2
                     << " d2R_vs_rhs_rel_diff2: " << d2R_vs_rhs_rel_diff2
+                    << " l2norm_rel_diff: " << l2norm_rel_diff
+                    << " linfnorm_rel_diff: " << linfnorm_rel_diff
                     << std::endl;
     if (dRdW_vs_rhs_rel_diff1 > tol) {
         return 1;
@@ -120,6 +128,8 @@ int test (
         return 1;
     } if (d2R_vs_rhs_rel_diff2 > tol) {
         return 1;
+    } if (l2norm_rel_diff > tol || linfnorm_rel_diff > tol) {
+        return 1;
     }
 
     return 0;
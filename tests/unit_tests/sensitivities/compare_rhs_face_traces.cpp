@@ -0,0 +1,146 @@
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType  = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/// Compares the residual assembled from the exchanged face traces to the one assembled from the ghost cells' solution.
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+
+    // The DG keeps a pointer to the parameters, such that the exchange is toggled through this copy.
+    Parameters::AllParameters parameters = all_parameters;
+    parameters.use_face_trace_exchange = false;
+
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&parameters, poly_degree, grid);
+    dg->allocate_system ();
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(*(dg->high_order_grid->mapping_fe_field), dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+
+    const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = false;
+
+    pcout << "Evaluating RHS from the ghost cells' solution..." << std::endl;
+    dg->solution = solution_no_ghost;
+    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+    dealii::LinearAlgebra::distributed::Vector<double> rhs_ghost_cells(dg->right_hand_side);
+
+    pcout << "Evaluating RHS from the face traces..." << std::endl;
+    parameters.use_face_trace_exchange = true;
+    dg->allocate_system ();
+    dg->solution = solution_no_ghost;
+    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+    dealii::LinearAlgebra::distributed::Vector<double> rhs_face_traces(dg->right_hand_side);
+
+    const double norm_rhs_ghost_cells = rhs_ghost_cells.l2_norm();
+    rhs_face_traces -= rhs_ghost_cells;
+    const double rel_diff = rhs_face_traces.l2_norm() / norm_rhs_ghost_cells;
+
+    const double tol = 1e-11;
+    pcout << "Error: face_traces_vs_ghost_cells_rel_diff: " << rel_diff << std::endl;
+    if (rel_diff > tol) return 1;
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    std::vector<PDEType> pde_type {
+        PDEType::diffusion,
+        PDEType::advection,
+        PDEType::convection_diffusion,
+        PDEType::advection_vector,
+        PDEType::euler,
+        PDEType::navier_stokes
+    };
+    std::vector<std::string> pde_name {
+        " PDEType::diffusion "
+        , " PDEType::advection "
+        , " PDEType::convection_diffusion "
+        , " PDEType::advection_vector "
+        , " PDEType::euler "
+        , " PDEType::navier_stokes "
+    };
+
+    int ipde = -1;
+    for (auto pde = pde_type.begin(); pde != pde_type.end() && error == 0; pde++) {
+        ipde++;
+        for (unsigned int poly_degree=1; poly_degree<3 && error == 0; ++poly_degree) {
+            for (unsigned int igrid=2; igrid<4 && error == 0; ++igrid) {
+                pcout << "Using " << pde_name[ipde] << std::endl;
+                all_parameters.pde_type = *pde;
+                // Generate grids
+#if PHILIP_DIM==1
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+#else
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+                    MPI_COMM_WORLD,
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+#endif
+                dealii::GridGenerator::subdivided_hyper_cube(*grid, igrid);
+                const double random_factor = 0.3;
+                const bool keep_boundary = false;
+                if (random_factor > 0.0) dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+                for (auto &cell : grid->active_cell_iterators()) {
+                    for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                        if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                    }
+                }
+                // Uniform refinement such that the faces shared by the processors are conforming.
+                grid->refine_global(1);
+
+                if ((*pde==PDEType::euler) || (*pde==PDEType::navier_stokes)) {
+                    error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+                } else if (*pde==PDEType::advection_vector) {
+                    error = test<dim,2>(poly_degree, grid, all_parameters);
+                } else {
+                    error = test<dim,1>(poly_degree, grid, all_parameters);
+                }
+            }
+        }
+    }
+
+    return error;
+}
+
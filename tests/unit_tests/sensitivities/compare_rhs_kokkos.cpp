@@ -0,0 +1,164 @@
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <Kokkos_Core.hpp>
+
+#include "dg/dg_factory.hpp"
+#include "dg/strong_dg.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType  = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/// Compares the strong DG residual assembled by the Kokkos kernels to the one assembled through assemble_residual().
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+
+    Parameters::AllParameters parameters = all_parameters;
+    parameters.use_weak_form = false;
+
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&parameters, poly_degree, grid);
+    std::shared_ptr < DGStrong<dim, nstate, double> > dg_strong = std::dynamic_pointer_cast< DGStrong<dim, nstate, double> >(dg);
+    dg->allocate_system ();
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(*(dg->high_order_grid->mapping_fe_field), dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+
+    // The strong form residual is only assembled along with its derivatives.
+    const bool compute_dRdW = true, compute_dRdX = false, compute_d2R = false;
+
+    pcout << "Evaluating RHS through assemble_residual..." << std::endl;
+    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+    dealii::LinearAlgebra::distributed::Vector<double> rhs_assemble(dg->right_hand_side);
+
+    if (!dg_strong->supports_kokkos_residual()) {
+        pcout << "The Kokkos residual should support a conforming grid with a single polynomial degree." << std::endl;
+        return 1;
+    }
+
+    pcout << "Evaluating RHS with Kokkos..." << std::endl;
+    dg->right_hand_side *= 0.0;
+    dg_strong->assemble_residual_kokkos();
+    dealii::LinearAlgebra::distributed::Vector<double> rhs_kokkos(dg->right_hand_side);
+
+    const double norm_rhs_assemble = rhs_assemble.l2_norm();
+    rhs_kokkos -= rhs_assemble;
+    const double rel_diff = rhs_kokkos.l2_norm() / norm_rhs_assemble;
+
+    const double tol = 1e-11;
+    pcout << "Error: kokkos_vs_assemble_residual_rel_diff: " << rel_diff << std::endl;
+    if (rel_diff > tol) return 1;
+
+    // The split form is not supported, in which case the ODE solvers fall back to assemble_residual().
+    Parameters::AllParameters split_form_parameters = parameters;
+    split_form_parameters.use_split_form = true;
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg_split = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&split_form_parameters, poly_degree, grid);
+    dg_split->allocate_system ();
+    if (std::dynamic_pointer_cast< DGStrong<dim, nstate, double> >(dg_split)->supports_kokkos_residual()) {
+        pcout << "The Kokkos residual should not support the split form." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    Kokkos::ScopeGuard kokkos_guard(argc, argv);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    std::vector<PDEType> pde_type {
+        PDEType::diffusion,
+        PDEType::advection,
+        PDEType::convection_diffusion,
+        PDEType::advection_vector,
+        PDEType::euler,
+        PDEType::navier_stokes
+    };
+    std::vector<std::string> pde_name {
+        " PDEType::diffusion "
+        , " PDEType::advection "
+        , " PDEType::convection_diffusion "
+        , " PDEType::advection_vector "
+        , " PDEType::euler "
+        , " PDEType::navier_stokes "
+    };
+
+    int ipde = -1;
+    for (auto pde = pde_type.begin(); pde != pde_type.end() && error == 0; pde++) {
+        ipde++;
+        for (unsigned int poly_degree=1; poly_degree<3 && error == 0; ++poly_degree) {
+            for (unsigned int igrid=2; igrid<4 && error == 0; ++igrid) {
+                pcout << "Using " << pde_name[ipde] << std::endl;
+                all_parameters.pde_type = *pde;
+                // Generate grids
+#if PHILIP_DIM==1
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+#else
+                std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+                    MPI_COMM_WORLD,
+                    typename dealii::Triangulation<dim>::MeshSmoothing(
+                        dealii::Triangulation<dim>::smoothing_on_refinement |
+                        dealii::Triangulation<dim>::smoothing_on_coarsening));
+#endif
+                dealii::GridGenerator::subdivided_hyper_cube(*grid, igrid);
+                const double random_factor = 0.3;
+                const bool keep_boundary = false;
+                if (random_factor > 0.0) dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+                for (auto &cell : grid->active_cell_iterators()) {
+                    for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                        if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                    }
+                }
+                // Uniform refinement such that every face is conforming.
+                grid->refine_global(1);
+
+                if ((*pde==PDEType::euler) || (*pde==PDEType::navier_stokes)) {
+                    error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+                } else if (*pde==PDEType::advection_vector) {
+                    error = test<dim,2>(poly_degree, grid, all_parameters);
+                } else {
+                    error = test<dim,1>(poly_degree, grid, all_parameters);
+                }
+            }
+        }
+    }
+
+    return error;
+}
+
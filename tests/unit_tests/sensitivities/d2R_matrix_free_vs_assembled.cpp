@@ -0,0 +1,165 @@
+#include <random>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType  = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-10;
+
+/// Fills the locally owned entries of a vector with random values in [-1,1].
+/** Seeded by the global index such that the values do not depend on the number of processors. */
+void fill_random (dealii::LinearAlgebra::distributed::Vector<double> &vector)
+{
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (const auto index : vector.locally_owned_elements()) {
+        std::mt19937 generator(index);
+        vector[index] = distribution(generator);
+    }
+    vector.update_ghost_values();
+}
+
+/** This test checks that the matrix-free products of DGBase::apply_d2R()
+ *  match the products with the assembled d2RdWdW, d2RdWdX and d2RdXdX.
+ */
+template<int dim, int nstate>
+int test (
+    const unsigned int poly_degree,
+    const std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+
+    std::shared_ptr < DGBase<PHILIP_DIM, double> > dg = DGFactory<PHILIP_DIM,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_global_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    using solutionVector = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nstate, double>::create_Physics(&all_parameters);
+    solutionVector solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    fill_random(dg->dual);
+
+    solutionVector direction_w(dg->solution);
+    fill_random(direction_w);
+    solutionVector direction_x(dg->high_order_grid->volume_nodes);
+    fill_random(direction_x);
+
+    pcout << "Evaluating the products with the assembled second derivatives..." << std::endl;
+    dg->assemble_residual(false, false, true);
+
+    solutionVector assembled_w(dg->solution), temp_w(dg->solution);
+    dg->d2RdWdW.vmult(assembled_w, direction_w);
+    dg->d2RdWdX.vmult(temp_w, direction_x);
+    assembled_w += temp_w;
+
+    solutionVector assembled_x(dg->high_order_grid->volume_nodes), temp_x(dg->high_order_grid->volume_nodes);
+    dg->d2RdWdX.Tvmult(assembled_x, direction_w);
+    dg->d2RdXdX.vmult(temp_x, direction_x);
+    assembled_x += temp_x;
+
+    pcout << "Evaluating the matrix-free products..." << std::endl;
+    solutionVector matrix_free_w(dg->solution);
+    solutionVector matrix_free_x(dg->high_order_grid->volume_nodes);
+    dg->apply_d2R(direction_w, direction_x, matrix_free_w, matrix_free_x);
+
+    const double norm_w = std::max(assembled_w.l2_norm(), 1.0);
+    const double norm_x = std::max(assembled_x.l2_norm(), 1.0);
+    matrix_free_w -= assembled_w;
+    matrix_free_x -= assembled_x;
+    const double rel_diff_w = matrix_free_w.l2_norm() / norm_w;
+    const double rel_diff_x = matrix_free_x.l2_norm() / norm_x;
+
+    pcout << "(d2R_w matrix-free - assembled) relative L2-norm = " << rel_diff_w << std::endl;
+    pcout << "(d2R_x matrix-free - assembled) relative L2-norm = " << rel_diff_x << std::endl;
+    if (rel_diff_w > TOLERANCE || rel_diff_x > TOLERANCE) return 1;
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    std::vector<PDEType> pde_type {
+           PDEType::diffusion
+         , PDEType::advection
+         , PDEType::euler
+         , PDEType::navier_stokes
+    };
+    std::vector<std::string> pde_name {
+         " PDEType::diffusion "
+        , " PDEType::advection "
+        , " PDEType::euler "
+        , " PDEType::navier_stokes "
+    };
+
+    int ipde = -1;
+    for (auto pde = pde_type.begin(); pde != pde_type.end() && error == 0; pde++) {
+        ipde++;
+        for (unsigned int poly_degree=1; poly_degree<3 && error == 0; ++poly_degree) {
+            pcout << "Using " << pde_name[ipde] << std::endl;
+            all_parameters.pde_type = *pde;
+            // Generate grids
+            std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                MPI_COMM_WORLD,
+#endif
+                typename dealii::Triangulation<dim>::MeshSmoothing(
+                    dealii::Triangulation<dim>::MeshSmoothing::smoothing_on_refinement |
+                    dealii::Triangulation<dim>::MeshSmoothing::smoothing_on_coarsening));
+
+            const unsigned int n_subdivisions = 3;
+            dealii::GridGenerator::subdivided_hyper_cube(*grid, n_subdivisions);
+
+            const double random_factor = 0.2;
+            const bool keep_boundary = false;
+            if (random_factor > 0.0) dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+            for (auto &cell : grid->active_cell_iterators()) {
+                for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                    if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                }
+            }
+
+            if ((*pde==PDEType::euler) || (*pde==PDEType::navier_stokes)) {
+                error = test<dim,dim+2>(poly_degree, grid, all_parameters);
+            } else {
+                error = test<dim,1>(poly_degree, grid, all_parameters);
+            }
+        }
+    }
+
+    return error;
+}